@@ -1,7 +1,6 @@
 import { Menu } from 'electron/main';
 
 import { EventEmitter } from 'events';
-import * as fs from 'fs';
 
 const bindings = process._linkedBinding('electron_browser_app');
 const commandLine = process._linkedBinding('electron_common_command_line');
@@ -71,43 +70,6 @@ if (process.platform === 'darwin') {
   app.dock!.getMenu = () => dockMenu;
 }
 
-if (process.platform === 'linux') {
-  const patternVmRSS = /^VmRSS:\s*(\d+) kB$/m;
-  const patternVmHWM = /^VmHWM:\s*(\d+) kB$/m;
-
-  const getStatus = (pid: number) => {
-    try {
-      return fs.readFileSync(`/proc/${pid}/status`, 'utf8');
-    } catch {
-      return '';
-    }
-  };
-
-  const getEntry = (file: string, pattern: RegExp) => {
-    const match = file.match(pattern);
-    return match ? parseInt(match[1], 10) : 0;
-  };
-
-  const getProcessMemoryInfo = (pid: number) => {
-    const file = getStatus(pid);
-
-    return {
-      workingSetSize: getEntry(file, patternVmRSS),
-      peakWorkingSetSize: getEntry(file, patternVmHWM)
-    };
-  };
-
-  const nativeFn = app.getAppMetrics;
-  app.getAppMetrics = () => {
-    const metrics = nativeFn.call(app);
-    for (const metric of metrics) {
-      metric.memory = getProcessMemoryInfo(metric.pid);
-    }
-
-    return metrics;
-  };
-}
-
 // Routes the events to webContents.
 const events = ['certificate-error', 'select-client-certificate'];
 for (const name of events) {
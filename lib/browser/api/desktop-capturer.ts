@@ -12,6 +12,32 @@ let currentlyRunning: {
   getSources: Promise<ElectronInternal.GetSourcesResult[]>;
 }[] = [];
 
+let maxConcurrentRequests = Infinity;
+let activeRequests = 0;
+const queuedRequests: (() => void)[] = [];
+
+function startQueuedRequests() {
+  while (activeRequests < maxConcurrentRequests && queuedRequests.length > 0) {
+    activeRequests++;
+    queuedRequests.shift()!();
+  }
+}
+
+// Each request runs its own capturers, so many of them at once compete for
+// the same capture threads. Resolves once the request may start.
+function acquireRequestSlot() {
+  if (activeRequests < maxConcurrentRequests) {
+    activeRequests++;
+    return Promise.resolve();
+  }
+  return new Promise<void>((resolve) => queuedRequests.push(resolve));
+}
+
+function releaseRequestSlot() {
+  activeRequests--;
+  startQueuedRequests();
+}
+
 // |options.types| can't be empty and must be an array
 function isValid(options: Electron.SourcesOptions) {
   return Array.isArray(options?.types);
@@ -19,6 +45,14 @@ function isValid(options: Electron.SourcesOptions) {
 
 export { isDisplayMediaSystemPickerAvailable };
 
+export function setMaxConcurrentRequests(limit: number) {
+  if (limit !== Infinity && (!Number.isInteger(limit) || limit < 1)) {
+    throw new Error('limit must be a positive integer or Infinity');
+  }
+  maxConcurrentRequests = limit;
+  startQueuedRequests();
+}
+
 export async function getSources(args: Electron.SourcesOptions) {
   if (!isValid(args)) throw new Error('Invalid options');
 
@@ -37,19 +71,25 @@ export async function getSources(args: Electron.SourcesOptions) {
 
   const { thumbnailSize = { width: 150, height: 150 } } = args;
   const { fetchWindowIcons = false } = args;
+  const { thumbnailCacheMaxAge = 0, onSource } = args;
 
   const options = {
     captureWindow,
     captureScreen,
     thumbnailSize,
-    fetchWindowIcons
+    fetchWindowIcons,
+    thumbnailCacheMaxAge
   };
 
-  for (const running of currentlyRunning) {
-    if (deepEqual(running.options, options)) {
-      // If a request is currently running for the same options
-      // return that promise
-      return running.getSources;
+  // A request that streams sources must see every one of them, so it can't
+  // share a request that is already underway.
+  if (typeof onSource !== 'function') {
+    for (const running of currentlyRunning) {
+      if (deepEqual(running.options, options)) {
+        // If a request is currently running for the same options
+        // return that promise
+        return running.getSources;
+      }
     }
   }
 
@@ -65,13 +105,17 @@ export async function getSources(args: Electron.SourcesOptions) {
   // completion (e.g. when no capturers are created) can properly clean up.
   currentlyRunning.push({ options, getSources });
 
+  await acquireRequestSlot();
+
   let capturer: ElectronInternal.DesktopCapturer | null = createDesktopCapturer();
 
   const stopRunning = () => {
     if (capturer) {
       delete capturer._onerror;
       delete capturer._onfinished;
+      delete capturer._onsource;
       capturer = null;
+      releaseRequestSlot();
 
       if (process.platform === 'darwin') {
         for (const win of BrowserWindow.getAllWindows()) {
@@ -96,7 +140,20 @@ export async function getSources(args: Electron.SourcesOptions) {
     resolveGetSources(sources);
   };
 
-  capturer.startHandling(captureWindow, captureScreen, thumbnailSize, fetchWindowIcons);
+  if (typeof onSource === 'function') {
+    capturer._onsource = (source: Electron.DesktopCapturerSource) => {
+      onSource(source);
+    };
+  }
+
+  capturer.startHandling(
+    captureWindow,
+    captureScreen,
+    thumbnailSize,
+    fetchWindowIcons,
+    typeof onSource === 'function',
+    thumbnailCacheMaxAge
+  );
 
   return getSources;
 }
@@ -12,11 +12,33 @@ const stopLogging: typeof session.defaultSession.netLog.stopLogging = async () =
   return session.defaultSession.netLog.stopLogging();
 };
 
+const startRingBuffer: typeof session.defaultSession.netLog.startRingBuffer = async (options) => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.startRingBuffer(options);
+};
+
+const dumpRingBuffer: typeof session.defaultSession.netLog.dumpRingBuffer = async (path, options) => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.dumpRingBuffer(path, options);
+};
+
+const stopRingBuffer: typeof session.defaultSession.netLog.stopRingBuffer = async () => {
+  if (!app.isReady()) return;
+  return session.defaultSession.netLog.stopRingBuffer();
+};
+
 export default {
   startLogging,
   stopLogging,
+  startRingBuffer,
+  dumpRingBuffer,
+  stopRingBuffer,
   get currentlyLogging(): boolean {
     if (!app.isReady()) return false;
     return session.defaultSession.netLog.currentlyLogging;
+  },
+  get ringBufferActive(): boolean {
+    if (!app.isReady()) return false;
+    return session.defaultSession.netLog.ringBufferActive;
   }
 };
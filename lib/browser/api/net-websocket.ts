@@ -19,6 +19,8 @@ const kHandlers = Symbol('handlers');
 const kQueuedBytes = Symbol('queuedBytes');
 const kSendQueue = Symbol('sendQueue');
 const kSendQueueDepth = Symbol('sendQueueDepth');
+const kMaxBufferedAmount = Symbol('maxBufferedAmount');
+const kBufferedAmountLowThreshold = Symbol('bufferedAmountLowThreshold');
 
 // RFC 7230 token (HTTP header value element). Used to validate WebSocket
 // subprotocol names per the WHATWG WebSocket spec.
@@ -47,6 +49,7 @@ export interface WebSocketOptions {
   useSessionCookies?: boolean;
   session?: Electron.Session;
   partition?: string;
+  maxBufferedAmount?: number;
 }
 
 export class WebSocket extends EventTarget {
@@ -74,6 +77,8 @@ export class WebSocket extends EventTarget {
   // does not let a later string/ArrayBuffer send overtake it on the wire.
   private [kSendQueue]: Promise<unknown> = Promise.resolve();
   private [kSendQueueDepth] = 0;
+  private [kMaxBufferedAmount] = Infinity;
+  private [kBufferedAmountLowThreshold] = 0;
 
   constructor(url: string | URL, protocolsOrOptions?: string | string[] | WebSocketOptions) {
     super();
@@ -129,6 +134,14 @@ export class WebSocket extends EventTarget {
       seen.add(p);
     }
 
+    if (options.maxBufferedAmount != null) {
+      const max = Number(options.maxBufferedAmount);
+      if (!Number.isFinite(max) || max < 0) {
+        throw new TypeError('maxBufferedAmount must be a non-negative number');
+      }
+      this[kMaxBufferedAmount] = max;
+    }
+
     const wrapper = createWebSocket({
       url: urlRecord.href,
       protocols,
@@ -147,26 +160,37 @@ export class WebSocket extends EventTarget {
       this.dispatchEvent(new Event('open'));
     });
 
-    wrapper.on('message', (_event, isText, data) => {
-      if (this[kReadyState] !== OPEN) return;
-      let payload: string | Buffer | ArrayBuffer | Blob;
-      if (isText) {
-        payload = data.toString('utf8');
-      } else if (this[kBinaryType] === 'arraybuffer') {
-        // electron::Buffer::Copy() backs the Buffer with a fresh ArrayBuffer
-        // sized exactly to the message, so .buffer is safe to expose.
-        payload = data.buffer as ArrayBuffer;
-      } else if (this[kBinaryType] === 'blob') {
-        payload = new Blob([data]);
-      } else {
-        payload = data;
+    // Messages arrive in batches: |data| holds every message back to back and
+    // |entries| holds a (byteLength, isText) pair per message.
+    wrapper.on('messages', (_event, data, entries) => {
+      const origin = new URL(this[kUrl]).origin;
+      let offset = 0;
+      for (let i = 0; i < entries.length; i += 2) {
+        if (this[kReadyState] !== OPEN) return;
+        const length = entries[i];
+        const bytes = data.subarray(offset, offset + length);
+        offset += length;
+        let payload: string | Buffer | ArrayBuffer | Blob;
+        if (entries[i + 1] === 1) {
+          payload = bytes.toString('utf8');
+        } else if (this[kBinaryType] === 'arraybuffer') {
+          // electron::Buffer::Copy() backs the batch with a fresh ArrayBuffer,
+          // so it can be exposed as-is when it holds exactly this message.
+          payload =
+            bytes.byteOffset === 0 && length === bytes.buffer.byteLength
+              ? (bytes.buffer as ArrayBuffer)
+              : (bytes.buffer.slice(bytes.byteOffset, bytes.byteOffset + length) as ArrayBuffer);
+        } else if (this[kBinaryType] === 'blob') {
+          payload = new Blob([bytes]);
+        } else {
+          payload = bytes;
+        }
+        this.dispatchEvent(new MessageEvent('message', { data: payload, origin }));
       }
-      this.dispatchEvent(
-        new MessageEvent('message', {
-          data: payload,
-          origin: new URL(this[kUrl]).origin
-        })
-      );
+    });
+
+    wrapper.on('bufferedamountlow', () => {
+      this.dispatchEvent(new Event('bufferedamountlow'));
     });
 
     wrapper.on('closing', () => {
@@ -203,6 +227,17 @@ export class WebSocket extends EventTarget {
     return this[kWrapper].getBufferedAmount() + this[kQueuedBytes];
   }
 
+  get bufferedAmountLowThreshold(): number {
+    return this[kBufferedAmountLowThreshold];
+  }
+
+  set bufferedAmountLowThreshold(value: number) {
+    // WebIDL unsigned long long, as on RTCDataChannel.
+    const threshold = Math.max(0, Math.floor(Number(value) || 0));
+    this[kBufferedAmountLowThreshold] = threshold;
+    this[kWrapper].setBufferedAmountLowThreshold(threshold);
+  }
+
   get extensions(): string {
     return this[kExtensions];
   }
@@ -227,8 +262,11 @@ export class WebSocket extends EventTarget {
     }
 
     if (typeof data === 'string') {
-      this.#enqueueSend(true, Buffer.from(data, 'utf8'));
+      const bytes = Buffer.from(data, 'utf8');
+      this.#checkBufferedAmount(bytes.length);
+      this.#enqueueSend(true, bytes);
     } else if (data instanceof Blob) {
+      this.#checkBufferedAmount(data.size);
       // Blobs must be read asynchronously. Hold a slot in the send queue so
       // later sends do not overtake this one.
       this.#enqueueAsync(data.size, () =>
@@ -238,15 +276,31 @@ export class WebSocket extends EventTarget {
         )
       );
     } else if (ArrayBuffer.isView(data)) {
+      this.#checkBufferedAmount(data.byteLength);
       this.#enqueueSend(false, new Uint8Array(data.buffer, data.byteOffset, data.byteLength));
     } else if (
       data instanceof ArrayBuffer ||
       (typeof SharedArrayBuffer !== 'undefined' && data instanceof SharedArrayBuffer)
     ) {
+      this.#checkBufferedAmount(data.byteLength);
       this.#enqueueSend(false, new Uint8Array(data));
     } else {
       // Per WebIDL, anything else is coerced to a USVString.
-      this.#enqueueSend(true, Buffer.from(String(data), 'utf8'));
+      const bytes = Buffer.from(String(data), 'utf8');
+      this.#checkBufferedAmount(bytes.length);
+      this.#enqueueSend(true, bytes);
+    }
+  }
+
+  // Enforces the `maxBufferedAmount` option. Only applies while OPEN; once
+  // closing, data is discarded anyway and only counted in bufferedAmount.
+  #checkBufferedAmount(byteSize: number) {
+    if (this[kReadyState] !== OPEN) return;
+    if (this.bufferedAmount + byteSize > this[kMaxBufferedAmount]) {
+      throw new DOMException(
+        `Sending ${byteSize} bytes would exceed maxBufferedAmount (${this[kMaxBufferedAmount]}).`,
+        'QuotaExceededError'
+      );
     }
   }
 
@@ -320,6 +374,12 @@ export class WebSocket extends EventTarget {
   set onclose(fn) {
     setHandler(this, 'close', fn);
   }
+  get onbufferedamountlow() {
+    return this[kHandlers].get('bufferedamountlow') ?? null;
+  }
+  set onbufferedamountlow(fn) {
+    setHandler(this, 'bufferedamountlow', fn);
+  }
 }
 
 function setHandler(target: WebSocket, type: string, fn: EventListener | null | undefined) {
@@ -26,6 +26,10 @@ export function resolveHost(host: string, options?: Electron.ResolveHostOptions)
   return session.defaultSession.resolveHost(host, options);
 }
 
+export function resolveHosts(hosts: string[], options?: Electron.ResolveHostsOptions): Promise<Electron.HostResolution[]> {
+  return session.defaultSession.resolveHosts(hosts, options);
+}
+
 exports.isOnline = isOnline;
 
 Object.defineProperty(exports, 'online', {
@@ -1,7 +1,9 @@
+import MessageChannelMain from '@electron/internal/browser/api/message-channel';
 import { MessagePortMain } from '@electron/internal/browser/message-port-main';
 
 import { EventEmitter } from 'events';
 import { Socket } from 'net';
+import * as os from 'os';
 import { Duplex, PassThrough } from 'stream';
 
 const { _fork } = process._linkedBinding('electron_browser_utility_process');
@@ -10,7 +12,8 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
   #handle: ElectronInternal.UtilityProcessWrapper | null;
   #stdout: Duplex | null = null;
   #stderr: Duplex | null = null;
-  constructor(modulePath: string, args?: string[], options?: Electron.ForkOptions) {
+  #launchTiming: Electron.UtilityProcessLaunchTiming | null = null;
+  constructor(modulePath: string, args?: string[], options?: Electron.ForkOptions, taskPort?: MessagePortMain) {
     super();
 
     if (!modulePath) {
@@ -52,6 +55,12 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       }
     }
 
+    if (options.keepSpare != null) {
+      if (typeof options.keepSpare !== 'boolean') {
+        throw new TypeError('keepSpare must be a boolean.');
+      }
+    }
+
     if (typeof options.stdio === 'string') {
       const stdio: Array<'pipe' | 'ignore' | 'inherit'> = [];
       switch (options.stdio) {
@@ -90,10 +99,11 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
       }
     }
 
-    this.#handle = _fork({ options, modulePath, args });
+    this.#handle = _fork({ options, modulePath, args, taskPort: taskPort?._internalPort });
     this.#handle!.emit = (channel: string | symbol, ...args: any[]) => {
       if (channel === 'exit') {
         try {
+          this.#launchTiming = this.#handle!.getLaunchTiming();
           this.emit('exit', ...args);
         } finally {
           this.#handle = null;
@@ -135,7 +145,25 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
     return this.#handle;
   }
 
-  postMessage(message: any, transfer?: MessagePortMain[]) {
+  getLaunchTiming(): Electron.UtilityProcessLaunchTiming {
+    return this.#handle?.getLaunchTiming() ?? this.#launchTiming!;
+  }
+
+  startCpuProfiler(options?: Electron.CpuProfilerOptions): Promise<boolean> {
+    if (this.#handle === null) {
+      return Promise.reject(new Error('The utility process is not running'));
+    }
+    return this.#handle.startCpuProfiler(options);
+  }
+
+  stopCpuProfiler(filePath: string): Promise<void> {
+    if (this.#handle === null) {
+      return Promise.reject(new Error('The utility process is not running'));
+    }
+    return this.#handle.stopCpuProfiler(filePath);
+  }
+
+  postMessage(message: any, transfer?: (MessagePortMain | ArrayBuffer)[]) {
     if (Array.isArray(transfer)) {
       transfer = transfer.map((o: any) => (o instanceof MessagePortMain ? o._internalPort : o));
       return this.#handle?.postMessage(message, transfer);
@@ -154,3 +182,244 @@ class ForkUtilityProcess extends EventEmitter implements Electron.UtilityProcess
 export function fork(modulePath: string, args?: string[], options?: Electron.ForkOptions) {
   return new ForkUtilityProcess(modulePath, args, options);
 }
+
+interface PoolTask {
+  id: number;
+  data: any;
+  transfer?: (MessagePortMain | ArrayBuffer)[];
+  resolve: (result: any) => void;
+  reject: (error: Error) => void;
+}
+
+interface PoolWorker {
+  process: ForkUtilityProcess;
+  port: MessagePortMain;
+  pid?: number;
+  // Tasks posted to the worker that it has not replied to yet.
+  tasks: Map<number, PoolTask>;
+  spawnTime: number;
+  busySince: number | null;
+  busyTime: number;
+  completedTasks: number;
+  failedTasks: number;
+}
+
+// Workers that exit before completing a task are restarted this many times in
+// a row at most, so that a module that fails to load does not respawn forever.
+const kMaxFailedStarts = 3;
+
+class UtilityProcessPool extends EventEmitter implements Electron.UtilityProcessPool {
+  #modulePath: string;
+  #args: string[];
+  #options: Electron.ForkOptions;
+  #maxTasksPerWorker: number;
+  #workers: PoolWorker[] = [];
+  // Tasks wait here until a worker has room for them rather than in the port
+  // of a worker, so that whichever worker frees up first picks up the next
+  // task instead of it waiting behind a long one.
+  #queue: PoolTask[] = [];
+  #nextTaskId = 0;
+  #failedStarts = 0;
+  #closed = false;
+
+  constructor(modulePath: string, args?: string[], options?: Electron.CreatePoolOptions) {
+    super();
+
+    if (!modulePath) {
+      throw new Error('Missing UtilityProcessPool entry script.');
+    }
+
+    if (args == null) {
+      args = [];
+    } else if (typeof args === 'object' && !Array.isArray(args)) {
+      options = args;
+      args = [];
+    }
+
+    const { size = Math.max(os.availableParallelism() - 1, 1), maxTasksPerWorker = 1, ...forkOptions } = options ?? {};
+    if (!Number.isInteger(size) || size < 1) {
+      throw new TypeError('size must be a positive integer.');
+    }
+    if (!Number.isInteger(maxTasksPerWorker) || maxTasksPerWorker < 1) {
+      throw new TypeError('maxTasksPerWorker must be a positive integer.');
+    }
+    if (forkOptions.stdio != null && forkOptions.stdio !== 'inherit' && forkOptions.stdio !== 'ignore') {
+      throw new TypeError('stdio must be one of the following values: inherit, ignore');
+    }
+
+    this.#modulePath = modulePath;
+    this.#args = args;
+    this.#options = forkOptions;
+    this.#maxTasksPerWorker = maxTasksPerWorker;
+    for (let i = 0; i < size; i++) {
+      this.#spawnWorker();
+    }
+  }
+
+  run(data: any, transfer?: (MessagePortMain | ArrayBuffer)[]): Promise<any> {
+    if (this.#closed) {
+      return Promise.reject(new Error('UtilityProcessPool is closed.'));
+    }
+    if (this.#workers.length === 0) {
+      return Promise.reject(new Error('UtilityProcessPool has no workers left.'));
+    }
+    return new Promise((resolve, reject) => {
+      this.#queue.push({ id: ++this.#nextTaskId, data, transfer, resolve, reject });
+      this.#dispatch();
+    });
+  }
+
+  getStats(): Electron.UtilityProcessPoolStats {
+    const now = performance.now();
+    return {
+      queueDepth: this.#queue.length,
+      workers: this.#workers.map((worker) => {
+        const busyTime = worker.busyTime + (worker.busySince === null ? 0 : now - worker.busySince);
+        const lifetime = now - worker.spawnTime;
+        return {
+          pid: worker.pid,
+          activeTasks: worker.tasks.size,
+          completedTasks: worker.completedTasks,
+          failedTasks: worker.failedTasks,
+          utilization: lifetime > 0 ? busyTime / lifetime : 0
+        };
+      })
+    };
+  }
+
+  close(): Promise<void> {
+    if (!this.#closed) {
+      this.#closed = true;
+      const error = new Error('UtilityProcessPool was closed.');
+      for (const task of this.#queue.splice(0)) {
+        task.reject(error);
+      }
+    }
+    return Promise.all(
+      this.#workers.map((worker) => {
+        const exited = new Promise<void>((resolve) => worker.process.once('exit', () => resolve()));
+        // A worker that has not spawned yet cannot be killed until it has.
+        if (!worker.process.kill()) {
+          worker.process.once('spawn', () => worker.process.kill());
+        }
+        return exited;
+      })
+    ).then(() => {});
+  }
+
+  #spawnWorker() {
+    const { port1, port2 } = new MessageChannelMain();
+    const worker: PoolWorker = {
+      process: new ForkUtilityProcess(this.#modulePath, this.#args, this.#options, port2),
+      port: port1,
+      tasks: new Map(),
+      spawnTime: performance.now(),
+      busySince: null,
+      busyTime: 0,
+      completedTasks: 0,
+      failedTasks: 0
+    };
+    this.#workers.push(worker);
+
+    worker.process.once('spawn', () => {
+      worker.pid = worker.process.pid;
+    });
+    worker.process.once('exit', (code: number) => this.#onWorkerExit(worker, code));
+    worker.port.on('message', ({ data }) => this.#onTaskDone(worker, data));
+    worker.port.start();
+  }
+
+  #onTaskDone(worker: PoolWorker, { id, result, error }: { id: number; result?: any; error?: { message: string; stack?: string } }) {
+    const task = worker.tasks.get(id);
+    if (!task) return;
+    worker.tasks.delete(id);
+    this.#updateBusyTime(worker);
+    this.#failedStarts = 0;
+    if (error) {
+      worker.failedTasks++;
+      const taskError = new Error(error.message);
+      taskError.stack = error.stack;
+      task.reject(taskError);
+    } else {
+      worker.completedTasks++;
+      task.resolve(result);
+    }
+    this.#dispatch();
+  }
+
+  #onWorkerExit(worker: PoolWorker, exitCode: number) {
+    this.#workers.splice(this.#workers.indexOf(worker), 1);
+    worker.port.close();
+
+    const error = new Error(`UtilityProcessPool worker exited with code ${exitCode} before completing the task.`);
+    for (const task of worker.tasks.values()) {
+      task.reject(error);
+    }
+    if (this.#closed) return;
+
+    if (worker.completedTasks === 0 && worker.failedTasks === 0) {
+      this.#failedStarts++;
+    }
+    const restart = this.#failedStarts <= kMaxFailedStarts;
+    this.emit('worker-exit', { pid: worker.pid, exitCode, restarted: restart });
+    if (restart) {
+      this.#spawnWorker();
+      this.#dispatch();
+    } else if (this.#workers.length === 0) {
+      const error = new Error('UtilityProcessPool has no workers left.');
+      for (const task of this.#queue.splice(0)) {
+        task.reject(error);
+      }
+    }
+  }
+
+  #dispatch() {
+    while (this.#queue.length > 0) {
+      const worker = this.#leastLoadedWorker();
+      if (!worker) return;
+      const task = this.#queue.shift()!;
+      worker.tasks.set(task.id, task);
+      worker.busySince ??= performance.now();
+      try {
+        const message = { id: task.id, data: task.data };
+        if (task.transfer) {
+          worker.port.postMessage(message, task.transfer);
+        } else {
+          worker.port.postMessage(message);
+        }
+      } catch (error) {
+        worker.tasks.delete(task.id);
+        this.#updateBusyTime(worker);
+        task.reject(error as Error);
+      }
+    }
+  }
+
+  #updateBusyTime(worker: PoolWorker) {
+    if (worker.tasks.size === 0 && worker.busySince !== null) {
+      worker.busyTime += performance.now() - worker.busySince;
+      worker.busySince = null;
+    }
+  }
+
+  // The worker with the fewest tasks in flight, favoring the one that has
+  // been busy the least so that load also evens out over time.
+  #leastLoadedWorker(): PoolWorker | undefined {
+    let best: PoolWorker | undefined;
+    for (const worker of this.#workers) {
+      if (worker.tasks.size >= this.#maxTasksPerWorker) continue;
+      if (
+        !best ||
+        worker.tasks.size < best.tasks.size ||
+        (worker.tasks.size === best.tasks.size && worker.busyTime < best.busyTime)
+      ) {
+        best = worker;
+      }
+    }
+    return best;
+  }
+}
+
+export function createPool(modulePath: string, args?: string[], options?: Electron.CreatePoolOptions) {
+  return new UtilityProcessPool(modulePath, args, options);
+}
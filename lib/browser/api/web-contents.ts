@@ -6,7 +6,7 @@ import {
 import { IpcMainImpl } from '@electron/internal/browser/ipc-main-impl';
 import * as ipcMainUtils from '@electron/internal/browser/ipc-main-internal-utils';
 import { parseFeatures } from '@electron/internal/browser/parse-features-string';
-import { printToPDF } from '@electron/internal/browser/print-to-pdf';
+import { printToPDF, PrintToPDFQueue } from '@electron/internal/browser/print-to-pdf';
 import * as deprecate from '@electron/internal/common/deprecate';
 import { IPC_MESSAGES } from '@electron/internal/common/ipc-messages';
 
@@ -181,6 +181,24 @@ WebContents.prototype.executeJavaScriptInIsolatedWorld = async function (worldId
   );
 };
 
+WebContents.prototype.executeJavaScriptInAllFrames = async function (scripts, hasUserGesture) {
+  await waitTillCanExecuteJavaScript(this);
+  // Every frame gets its batch at once, so the frames run their scripts in
+  // parallel.
+  return Promise.all(this.mainFrame.framesInSubtree.map(async (frame) => {
+    try {
+      return { frame, ...await frame.executeJavaScriptBatch(scripts, !!hasUserGesture) };
+    } catch (reason) {
+      // The frame went away before the scripts could run.
+      return {
+        frame,
+        results: scripts.map(() => ({ status: 'rejected' as const, reason })),
+        roundTripTime: 0
+      };
+    }
+  }));
+};
+
 WebContents.prototype.printToPDF = async function (options) {
   return printToPDF(this, options);
 };
@@ -521,6 +539,40 @@ WebContents.prototype._init = function () {
 
   this._windowOpenHandler = null;
 
+  // Let the native side know which events have listeners, so that it can skip
+  // building arguments for high-frequency events nobody is listening to.
+  const onNewListener = (name: string | symbol) => {
+    if (typeof name === 'string') this._setEventListened(name, true);
+  };
+  const onRemoveListener = (name: string | symbol) => {
+    if (typeof name === 'string') this._setEventListened(name, this.listenerCount(name) > 0);
+  };
+  const trackListeners = () => {
+    if (!this.listeners('newListener').includes(onNewListener)) this.on('newListener', onNewListener);
+    if (!this.listeners('removeListener').includes(onRemoveListener)) this.on('removeListener', onRemoveListener);
+  };
+  trackListeners();
+  for (const name of this.eventNames()) {
+    if (typeof name === 'string') this._setEventListened(name, true);
+  }
+  // removeAllListeners() would also remove the hooks above, leaving the native
+  // side unaware of listeners added afterwards, and the internal '-' relays
+  // installed below, which public events such as 'console-message' depend on.
+  const { removeAllListeners } = this;
+  this.removeAllListeners = function (this: Electron.WebContents, ...args: [(string | symbol)?]) {
+    if (args.length > 0) {
+      removeAllListeners.apply(this, args);
+    } else {
+      const names = this.eventNames().filter((name) => typeof name !== 'string' || !name.startsWith('-'));
+      for (const name of names) {
+        removeAllListeners.call(this, name);
+        if (typeof name === 'string') this._setEventListened(name, false);
+      }
+    }
+    trackListeners();
+    return this;
+  };
+
   const ipc = new IpcMainImpl();
   Object.defineProperty(this, 'ipc', {
     get() {
@@ -844,17 +896,25 @@ WebContents.prototype._init = function () {
     }
   });
 
-  app.emit(
-    'web-contents-created',
-    {
-      sender: this,
-      preventDefault() {},
-      get defaultPrevented() {
-        return false;
-      }
-    },
-    this
-  );
+  const emitCreated = () => {
+    app.emit(
+      'web-contents-created',
+      {
+        sender: this,
+        preventDefault() {},
+        get defaultPrevented() {
+          return false;
+        }
+      },
+      this
+    );
+  };
+  // Pooled WebContents are only announced once an app adopts them.
+  if (this._isWarmPooled()) {
+    this.once('-warm-pool-adopted' as any, emitCreated);
+  } else {
+    emitCreated();
+  }
 
   // Properties
 
@@ -930,3 +990,11 @@ export function getFocusedWebContents() {
 export function getAllWebContents() {
   return binding.getAllWebContents();
 }
+
+export function createPrintToPDFQueue(options?: ConstructorParameters<typeof PrintToPDFQueue>[0]) {
+  return new PrintToPDFQueue(options);
+}
+
+export function setMemoryPressurePolicy(policy: { availableMemoryThreshold: number, checkInterval?: number } | null) {
+  binding.setMemoryPressurePolicy(policy);
+}
@@ -1,6 +1,14 @@
 // Option translation and job queueing for printToPDF, shared between
 // webContents.printToPDF and webFrameMain.printToPDF.
 
+import { webContents } from 'electron/main';
+
+import * as fs from 'fs';
+import * as os from 'os';
+import * as path from 'path';
+import { Writable } from 'stream';
+import { pipeline } from 'stream/promises';
+
 let nextRequestId = 0;
 
 const paperFormats: Record<string, ElectronInternal.PageSize> = {
@@ -48,7 +56,7 @@ function parsePageSize(pageSize: string | ElectronInternal.PageSize) {
 type PrintToPDFOptions = Parameters<Electron.WebContents['printToPDF']>[0];
 
 interface PrintToPDFTarget {
-  _printToPDF?: (settings: any) => Promise<Buffer>;
+  _printToPDF?: (settings: any) => Promise<Buffer | number>;
   // WebFrameMain#top; used to serialize jobs within a frame tree.
   top?: Electron.WebFrameMain | null;
   // WebContents#mainFrame.
@@ -64,7 +72,9 @@ interface PrintToPDFTarget {
 // are deleted, so the map only holds in-flight frame trees.
 const printToPDFQueues = new Map<number, Promise<unknown>>();
 
-export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOptions): Promise<Buffer> {
+export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOptions): Promise<Buffer>;
+export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOptions, outputPath: string): Promise<number>;
+export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOptions, outputPath?: string): Promise<Buffer | number> {
   const margins = checkType(options.margins ?? {}, 'object', 'margins');
   const pageSize = parsePageSize(options.pageSize ?? 'letter');
 
@@ -92,7 +102,8 @@ export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOp
     preferCSSPageSize: checkType(options.preferCSSPageSize ?? false, 'boolean', 'preferCSSPageSize'),
     generateTaggedPDF: checkType(options.generateTaggedPDF ?? false, 'boolean', 'generateTaggedPDF'),
     generateDocumentOutline: checkType(options.generateDocumentOutline ?? false, 'boolean', 'generateDocumentOutline'),
-    ...pageSize
+    ...pageSize,
+    ...(outputPath === undefined ? {} : { outputPath })
   };
 
   if (!target._printToPDF) {
@@ -111,3 +122,96 @@ export async function printToPDF(target: PrintToPDFTarget, options: PrintToPDFOp
     .catch(() => {});
   return next;
 }
+
+type PrintToPDFQueueOptions = Parameters<typeof Electron.WebContents['createPrintToPDFQueue']>[0];
+type PrintToPDFQueueJobOptions = Parameters<Electron.PrintToPDFQueue['add']>[1];
+
+// Renders documents to PDF in hidden WebContents of their own, so that
+// documents of a batch are laid out and printed in parallel.
+export class PrintToPDFQueue {
+  #concurrency: number;
+  #webPreferences: Electron.WebPreferences;
+  #running = 0;
+  #waiting: (() => void)[] = [];
+
+  constructor(options: PrintToPDFQueueOptions = {}) {
+    const { concurrency = 2, webPreferences = {} } = options;
+    if (!Number.isInteger(concurrency) || concurrency < 1) {
+      throw new Error('concurrency must be a positive integer');
+    }
+    this.#concurrency = concurrency;
+    this.#webPreferences = checkType(webPreferences, 'object', 'webPreferences');
+  }
+
+  get running() {
+    return this.#running;
+  }
+
+  get pending() {
+    return this.#waiting.length;
+  }
+
+  async add(url: string, options: PrintToPDFQueueJobOptions = {}): Promise<Buffer | number> {
+    checkType(url, 'string', 'url');
+    const { output, ...printOptions } = options;
+    if (output !== undefined && typeof output !== 'string' && typeof output !== 'number' &&
+        !(output instanceof Writable)) {
+      throw new TypeError('output must be a path, a file descriptor or a Writable stream');
+    }
+
+    await this.#acquire();
+    let tempDir: string | undefined;
+    try {
+      if (output !== undefined && typeof output !== 'string') {
+        tempDir = await fs.promises.mkdtemp(path.join(os.tmpdir(), 'electron-pdf-'));
+      }
+      const outputPath = typeof output === 'string'
+        ? output
+        : tempDir === undefined ? undefined : path.join(tempDir, 'output.pdf');
+
+      const contents = (webContents as typeof ElectronInternal.WebContents).create(this.#webPreferences);
+      let result: Buffer | number;
+      try {
+        await contents.loadURL(url);
+        result = outputPath === undefined
+          ? await printToPDF(contents, printOptions)
+          : await printToPDF(contents, printOptions, outputPath);
+      } finally {
+        contents.destroy();
+      }
+
+      if (tempDir !== undefined) {
+        // The PDF is copied to the destination in chunks rather than loaded
+        // into memory as a whole.
+        const destination = typeof output === 'number'
+          ? fs.createWriteStream('', { fd: output, autoClose: false })
+          : output as Writable;
+        await pipeline(fs.createReadStream(outputPath!), destination);
+      }
+      return result;
+    } finally {
+      if (tempDir !== undefined) {
+        fs.promises.rm(tempDir, { recursive: true, force: true }).catch(() => {});
+      }
+      this.#release();
+    }
+  }
+
+  #acquire() {
+    if (this.#running < this.#concurrency) {
+      this.#running++;
+      return Promise.resolve();
+    }
+    return new Promise<void>((resolve) => this.#waiting.push(resolve));
+  }
+
+  #release() {
+    const next = this.#waiting.shift();
+    if (next) {
+      // Hand the slot straight to the next job.
+      next();
+    } else {
+      this.#running--;
+    }
+  }
+}
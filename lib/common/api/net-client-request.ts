@@ -335,6 +335,7 @@ export class ClientRequest extends Writable implements Electron.ClientRequest {
   _uploadProgress?: { active: boolean; started: boolean; current: number; total: number };
   _urlLoader?: NodeJS.URLLoader;
   _response?: IncomingMessage;
+  _timing?: Electron.RequestTiming;
 
   constructor(options: ClientRequestConstructorOptions | string, callback?: (message: IncomingMessage) => void) {
     super({ autoDestroy: true });
@@ -455,12 +456,14 @@ export class ClientRequest extends Writable implements Electron.ClientRequest {
     this._urlLoader.on('data', (event, data, resume) => {
       this._response!._storeInternalData(Buffer.from(data), resume);
     });
-    this._urlLoader.on('complete', () => {
+    this._urlLoader.on('complete', (event, timing) => {
+      this._timing = timing;
       if (this._response) {
         this._response._storeInternalData(null, null);
       }
     });
-    this._urlLoader.on('error', (event, netErrorString) => {
+    this._urlLoader.on('error', (event, netErrorString, timing) => {
+      this._timing = timing;
       const error = new Error(netErrorString);
       if (this._response) this._response.destroy(error);
       this._die(error);
@@ -555,4 +558,8 @@ export class ClientRequest extends Writable implements Electron.ClientRequest {
   getUploadProgress(): UploadProgress {
     return this._uploadProgress ? { ...this._uploadProgress } : { active: false, started: false, current: 0, total: 0 };
   }
+
+  getTiming(): Electron.RequestTiming | null {
+    return this._timing ? { ...this._timing } : null;
+  }
 }
@@ -2,6 +2,7 @@ import LanguageModelUtility from '@electron/internal/utility/api/language-model-
 import { ParentPort } from '@electron/internal/utility/parent-port';
 
 import { EventEmitter } from 'events';
+import { enableCompileCache, flushCompileCache } from 'module';
 import { ReadableStream } from 'stream/web';
 import { pathToFileURL } from 'url';
 
@@ -26,7 +27,7 @@ require('@electron/internal/common/init');
 
 process._linkedBinding('electron_browser_event_emitter').setEventEmitterPrototype(EventEmitter.prototype);
 
-const parentPort: ParentPort = new ParentPort();
+const parentPort: ParentPort = new ParentPort(v8Util.getHiddenValue(process, '_taskPort'));
 Object.defineProperty(process, 'parentPort', {
   enumerable: true,
   writable: false,
@@ -46,6 +47,13 @@ parentPort.on('removeListener', (name: string) => {
   }
 });
 
+// Modules compiled by an earlier process of the same session are loaded
+// from the cache it left behind.
+const codeCacheDir: string | undefined = v8Util.getHiddenValue(process, '_codeCacheDir');
+if (codeCacheDir) {
+  enableCompileCache(codeCacheDir);
+}
+
 // Finally load entry script.
 const { runEntryPointWithESMLoader } = __non_webpack_require__(
   'internal/modules/run_main'
@@ -55,6 +63,9 @@ const mainEntry = pathToFileURL(entryScript);
 runEntryPointWithESMLoader(async (cascadedLoader: any) => {
   try {
     await cascadedLoader.import(mainEntry.toString(), undefined, Object.create(null));
+    // Node.js only writes the cache on exit otherwise, which a process that
+    // is killed never gets to.
+    if (codeCacheDir) flushCompileCache();
   } catch (err) {
     // @ts-ignore internalBinding is a secret internal global that we shouldn't
     // really be using, so we ignore the type error instead of declaring it in types
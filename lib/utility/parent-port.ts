@@ -4,10 +4,16 @@ import { EventEmitter } from 'events';
 
 const { createParentPort } = process._linkedBinding('electron_utility_parent_port');
 
+type TaskHandler = (data: any, ports: MessagePortMain[]) => any;
+
 export class ParentPort extends EventEmitter implements Electron.ParentPort {
   #port: ParentPort;
-  constructor() {
+  #taskPort: MessagePortMain | null;
+  #taskHandler: TaskHandler | null = null;
+  constructor(taskPort?: any) {
     super();
+    this.#taskPort = taskPort ? new MessagePortMain(taskPort) : null;
+    this.#taskPort?.on('message', ({ data: { id, data }, ports }) => this.#runTask(id, data, ports));
     this.#port = createParentPort();
     this.#port.emit = (channel: string | symbol, event: { ports: any[] }) => {
       if (channel === 'message') {
@@ -26,7 +32,33 @@ export class ParentPort extends EventEmitter implements Electron.ParentPort {
     this.#port.pause();
   }
 
-  postMessage(message: any): void {
-    this.#port.postMessage(message);
+  postMessage(message: any, transfer?: ArrayBuffer[]): void {
+    if (transfer === undefined) {
+      this.#port.postMessage(message);
+    } else {
+      this.#port.postMessage(message, transfer);
+    }
+  }
+
+  setTaskHandler(handler: TaskHandler | null): void {
+    if (handler !== null && typeof handler !== 'function') {
+      throw new TypeError('handler must be a function or null');
+    }
+    this.#taskHandler = handler;
+    // Tasks are queued by the port until there is a handler to run them.
+    if (handler) this.#taskPort?.start();
+  }
+
+  async #runTask(id: number, data: any, ports: MessagePortMain[]) {
+    try {
+      if (!this.#taskHandler) throw new Error('No task handler is set');
+      const result = await this.#taskHandler(data, ports);
+      this.#taskPort!.postMessage({ id, result });
+    } catch (error) {
+      // The error itself may not be serializable, e.g. when a result failed
+      // to be.
+      const { message, stack } = error instanceof Error ? error : new Error(String(error));
+      this.#taskPort!.postMessage({ id, error: { message, stack } });
+    }
   }
 }
@@ -0,0 +1,185 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/app_metrics_collector.h"
+
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "base/functional/callback.h"
+#include "base/process/process_handle.h"
+#include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
+
+#if BUILDFLAG(IS_MAC)
+#include "content/public/browser/browser_child_process_host.h"
+#endif
+
+namespace electron {
+
+namespace {
+
+std::unique_ptr<base::ProcessMetrics> CreateProcessMetrics(
+    const base::Process& process) {
+  if (process.Pid() == base::GetCurrentProcId())
+    return base::ProcessMetrics::CreateCurrentProcessMetrics();
+#if BUILDFLAG(IS_MAC)
+  return base::ProcessMetrics::CreateProcessMetrics(
+      process.Handle(), content::BrowserChildProcessHost::GetPortProvider());
+#else
+  return base::ProcessMetrics::CreateProcessMetrics(process.Handle());
+#endif
+}
+
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX)
+std::optional<int64_t> Subtract(std::optional<size_t> current,
+                                std::optional<size_t> previous) {
+  if (!current || !previous)
+    return std::nullopt;
+  return static_cast<int64_t>(*current) - static_cast<int64_t>(*previous);
+}
+#endif
+
+}  // namespace
+
+// Lives on a thread pool sequence. base::ProcessMetrics computes CPU usage
+// relative to its previous call, so one is kept per process between samples.
+class AppMetricsCollector::Core {
+ public:
+  Core() = default;
+  ~Core() = default;
+
+  // disable copy
+  Core(const Core&) = delete;
+  Core& operator=(const Core&) = delete;
+
+  std::vector<Sample> Collect(std::vector<ProcessInfo> processes) {
+    const int processor_count = base::SysInfo::NumberOfProcessors();
+    const base::TimeTicks now = base::TimeTicks::Now();
+
+    std::vector<Sample> samples;
+    samples.reserve(processes.size());
+    std::map<content::ChildProcessId, State> states;
+    for (ProcessInfo& info : processes) {
+      State state;
+      if (auto it = states_.find(info.id); it != states_.end()) {
+        state = std::move(it->second);
+      } else {
+        auto metrics = CreateProcessMetrics(info.process);
+        state.metric = std::make_unique<ProcessMetric>(
+            info.type, info.process.Handle(), std::move(metrics),
+            info.service_name, info.name);
+      }
+      const ProcessMetric& metric = *state.metric;
+
+      Sample sample;
+      sample.id = info.id;
+      sample.pid = metric.process.Pid();
+      sample.type = metric.type;
+      sample.service_name = metric.service_name;
+      sample.name = metric.name;
+      sample.creation_time = metric.process.CreationTime();
+      sample.cumulative_cpu_usage = metric.metrics->GetCumulativeCPUUsage();
+      if (sample.cumulative_cpu_usage) {
+        sample.percent_cpu_usage =
+            metric.metrics->GetPlatformIndependentCPUUsage(
+                *sample.cumulative_cpu_usage) /
+            processor_count;
+      }
+#if !BUILDFLAG(IS_WIN)
+      sample.idle_wakeups_per_second =
+          metric.metrics->GetIdleWakeupsPerSecond();
+#endif
+      sample.memory = metric.GetMemoryInfo();
+#if BUILDFLAG(IS_WIN)
+      sample.integrity_level = metric.GetIntegrityLevel();
+      sample.sandboxed = ProcessMetric::IsSandboxed(sample.integrity_level);
+#elif BUILDFLAG(IS_MAC)
+      sample.sandboxed = metric.IsSandboxed();
+#endif
+
+      if (state.previous) {
+        Delta delta;
+        delta.interval = now - state.previous_time;
+        delta.cpu_usage =
+            sample.cumulative_cpu_usage.value_or(base::TimeDelta()) -
+            state.previous->cumulative_cpu_usage.value_or(base::TimeDelta());
+        delta.working_set_size =
+            static_cast<int64_t>(sample.memory.working_set_size) -
+            static_cast<int64_t>(state.previous->memory.working_set_size);
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX)
+        delta.private_bytes = Subtract(sample.memory.private_bytes,
+                                       state.previous->memory.private_bytes);
+#endif
+#if BUILDFLAG(IS_LINUX)
+        delta.proportional_set_size =
+            Subtract(sample.memory.proportional_set_size,
+                     state.previous->memory.proportional_set_size);
+#endif
+        sample.delta = std::move(delta);
+      }
+
+      state.previous = Previous{sample.cumulative_cpu_usage, sample.memory};
+      state.previous_time = now;
+      states.insert_or_assign(info.id, std::move(state));
+      samples.push_back(std::move(sample));
+    }
+    states_ = std::move(states);
+    return samples;
+  }
+
+ private:
+  // The part of a sample that the next delta is computed from.
+  struct Previous {
+    std::optional<base::TimeDelta> cumulative_cpu_usage;
+    ProcessMemoryInfo memory;
+  };
+
+  struct State {
+    std::unique_ptr<ProcessMetric> metric;
+    std::optional<Previous> previous;
+    base::TimeTicks previous_time;
+  };
+
+  std::map<content::ChildProcessId, State> states_;
+};
+
+AppMetricsCollector::ProcessInfo::ProcessInfo(content::ChildProcessId id,
+                                              int type,
+                                              base::Process process,
+                                              std::string service_name,
+                                              std::string name)
+    : id(id),
+      type(type),
+      process(std::move(process)),
+      service_name(std::move(service_name)),
+      name(std::move(name)) {}
+AppMetricsCollector::ProcessInfo::ProcessInfo(ProcessInfo&&) = default;
+AppMetricsCollector::ProcessInfo& AppMetricsCollector::ProcessInfo::operator=(
+    ProcessInfo&&) = default;
+AppMetricsCollector::ProcessInfo::~ProcessInfo() = default;
+
+AppMetricsCollector::Sample::Sample() = default;
+AppMetricsCollector::Sample::Sample(Sample&&) = default;
+AppMetricsCollector::Sample& AppMetricsCollector::Sample::operator=(Sample&&) =
+    default;
+AppMetricsCollector::Sample::~Sample() = default;
+
+AppMetricsCollector::AppMetricsCollector()
+    : core_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN})) {}
+
+AppMetricsCollector::~AppMetricsCollector() = default;
+
+void AppMetricsCollector::Collect(std::vector<ProcessInfo> processes,
+                                  SampleCallback callback) {
+  core_.AsyncCall(&Core::Collect)
+      .WithArgs(std::move(processes))
+      .Then(std::move(callback));
+}
+
+}  // namespace electron
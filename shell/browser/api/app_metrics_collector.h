@@ -0,0 +1,101 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_APP_METRICS_COLLECTOR_H_
+#define ELECTRON_SHELL_BROWSER_API_APP_METRICS_COLLECTOR_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base/functional/callback_forward.h"
+#include "base/process/process.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
+#include "content/public/common/child_process_id.h"
+#include "shell/browser/api/process_metric.h"
+
+namespace electron {
+
+// Samples the CPU and memory usage of the app's processes on a thread pool
+// sequence, so that querying other processes and reading procfs never block
+// the UI thread.
+class AppMetricsCollector {
+ public:
+  struct ProcessInfo {
+    ProcessInfo(content::ChildProcessId id,
+                int type,
+                base::Process process,
+                std::string service_name,
+                std::string name);
+    ProcessInfo(ProcessInfo&&);
+    ProcessInfo& operator=(ProcessInfo&&);
+    ~ProcessInfo();
+
+    content::ChildProcessId id;
+    int type;
+    base::Process process;
+    std::string service_name;
+    std::string name;
+  };
+
+  // Changes since the previous sample of the same process.
+  struct Delta {
+    base::TimeDelta interval;
+    base::TimeDelta cpu_usage;
+    int64_t working_set_size = 0;
+    std::optional<int64_t> private_bytes;
+    std::optional<int64_t> proportional_set_size;
+  };
+
+  struct Sample {
+    Sample();
+    Sample(Sample&&);
+    Sample& operator=(Sample&&);
+    ~Sample();
+
+    content::ChildProcessId id;
+    base::ProcessId pid = base::kNullProcessId;
+    int type = 0;
+    std::string service_name;
+    std::string name;
+    base::Time creation_time;
+    std::optional<base::TimeDelta> cumulative_cpu_usage;
+    double percent_cpu_usage = 0;
+    int idle_wakeups_per_second = 0;
+    ProcessMemoryInfo memory;
+#if BUILDFLAG(IS_WIN)
+    ProcessIntegrityLevel integrity_level = ProcessIntegrityLevel::kUnknown;
+#endif
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_MAC)
+    bool sandboxed = false;
+#endif
+    // Unset for the first sample of a process.
+    std::optional<Delta> delta;
+  };
+
+  using SampleCallback = base::OnceCallback<void(std::vector<Sample>)>;
+
+  AppMetricsCollector();
+  ~AppMetricsCollector();
+
+  // disable copy
+  AppMetricsCollector(const AppMetricsCollector&) = delete;
+  AppMetricsCollector& operator=(const AppMetricsCollector&) = delete;
+
+  // Samples |processes| and replies on the calling sequence. Processes that
+  // are no longer passed in are forgotten, and deltas are relative to the
+  // previous Collect() that included the same process.
+  void Collect(std::vector<ProcessInfo> processes, SampleCallback callback);
+
+ private:
+  class Core;
+
+  base::SequenceBound<Core> core_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_APP_METRICS_COLLECTOR_H_
@@ -0,0 +1,245 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/app_metrics_history.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "base/compiler_specific.h"
+#include "base/containers/flat_set.h"
+#include "base/containers/span.h"
+#include "base/functional/bind.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/common/process_type.h"
+#include "services/service_manager/public/cpp/interface_provider.h"
+#include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "v8/include/v8-array-buffer.h"
+#include "v8/include/v8-isolate.h"
+#include "v8/include/v8-statistics.h"
+#include "v8/include/v8-typed-array.h"
+
+namespace electron {
+
+namespace {
+
+uint32_t ToKilobytes(uint64_t bytes) {
+  return static_cast<uint32_t>(
+      std::min<uint64_t>(bytes >> 10, std::numeric_limits<uint32_t>::max()));
+}
+
+}  // namespace
+
+AppMetricsHistory::AppMetricsHistory(base::TimeDelta interval,
+                                     size_t capacity,
+                                     ProcessesGetter get_processes)
+    : interval_(interval),
+      get_processes_(std::move(get_processes)),
+      records_(capacity) {
+  DCHECK_GT(capacity, 0u);
+}
+
+AppMetricsHistory::~AppMetricsHistory() = default;
+
+void AppMetricsHistory::Start() {
+  timer_.Start(FROM_HERE, interval_,
+               base::BindRepeating(&AppMetricsHistory::Sample,
+                                   base::Unretained(this)));
+  Sample();
+}
+
+void AppMetricsHistory::Stop() {
+  timer_.Stop();
+  renderer_apis_.clear();
+}
+
+void AppMetricsHistory::Sample() {
+  // Skip a tick rather than queueing samples up behind a slow one.
+  if (sample_pending_)
+    return;
+  sample_pending_ = true;
+  RequestRendererHeapStatistics();
+  collector_.Collect(get_processes_.Run(),
+                     base::BindOnce(&AppMetricsHistory::OnSampled,
+                                    weak_factory_.GetWeakPtr(),
+                                    base::Time::Now()));
+}
+
+void AppMetricsHistory::OnSampled(
+    base::Time time,
+    std::vector<AppMetricsCollector::Sample> samples) {
+  sample_pending_ = false;
+  if (!timer_.IsRunning())
+    return;
+
+  base::flat_set<content::ChildProcessId> alive;
+  alive.reserve(samples.size());
+  for (const auto& sample : samples) {
+    alive.insert(sample.id);
+    ProcessEntry& entry = processes_[sample.id];
+    if (entry.pid == base::kNullProcessId) {
+      entry.pid = sample.pid;
+      entry.type = sample.type;
+      entry.service_name = sample.service_name;
+      entry.name = sample.name;
+      entry.creation_time = sample.creation_time;
+    }
+    entry.last_sequence = sequence_;
+
+    Record record;
+    record.time = time.InMillisecondsFSinceUnixEpoch();
+    record.process_id = sample.id.GetUnsafeValue();
+    record.cpu_usage = static_cast<float>(sample.percent_cpu_usage);
+    record.idle_wakeups =
+        static_cast<uint32_t>(std::max(sample.idle_wakeups_per_second, 0));
+    record.working_set_size = ToKilobytes(sample.memory.working_set_size);
+#if BUILDFLAG(IS_WIN)
+    record.private_bytes = ToKilobytes(sample.memory.private_bytes);
+#elif BUILDFLAG(IS_LINUX)
+    record.private_bytes =
+        ToKilobytes(sample.memory.private_bytes.value_or(0));
+    record.proportional_set_size =
+        ToKilobytes(sample.memory.proportional_set_size.value_or(0));
+    record.swap_size = ToKilobytes(sample.memory.swap_size);
+#endif
+
+    if (sample.type == content::PROCESS_TYPE_BROWSER) {
+      v8::HeapStatistics stats;
+      JavascriptEnvironment::GetIsolate()->GetHeapStatistics(&stats);
+      record.heap_used = ToKilobytes(stats.used_heap_size());
+      record.heap_total = ToKilobytes(stats.total_heap_size());
+    } else if (auto it = renderer_heaps_.find(sample.id);
+               it != renderer_heaps_.end()) {
+      record.heap_used = ToKilobytes(it->second.used);
+      record.heap_total = ToKilobytes(it->second.total);
+    }
+    Append(record);
+  }
+
+  base::EraseIf(renderer_heaps_,
+                [&](const auto& it) { return !alive.contains(it.first); });
+  base::EraseIf(renderer_apis_,
+                [&](const auto& it) { return !alive.contains(it.first); });
+  // Forget processes once their last record has been overwritten.
+  const uint64_t oldest_sequence = sequence_ - size_;
+  base::EraseIf(processes_, [&](const auto& it) {
+    return it.second.last_sequence < oldest_sequence;
+  });
+}
+
+void AppMetricsHistory::RequestRendererHeapStatistics() {
+  for (auto it = content::RenderProcessHost::AllHostsIterator(); !it.IsAtEnd();
+       it.Advance()) {
+    content::RenderProcessHost* host = it.GetCurrentValue();
+    if (!host->IsReady())
+      continue;
+
+    const content::ChildProcessId id = host->GetID();
+    auto& renderer_api = renderer_apis_[id];
+    if (!renderer_api) {
+      // Every frame of the process shares the isolate, so any live one can
+      // answer for the whole process.
+      content::RenderFrameHost* frame = nullptr;
+      host->ForEachRenderFrameHost([&frame](content::RenderFrameHost* rfh) {
+        if (!frame && rfh->IsRenderFrameLive())
+          frame = rfh;
+      });
+      if (!frame) {
+        renderer_apis_.erase(id);
+        continue;
+      }
+      frame->GetRemoteInterfaces()->GetInterface(
+          renderer_api.BindNewPipeAndPassReceiver());
+      renderer_api.set_disconnect_handler(
+          base::BindOnce(&AppMetricsHistory::OnRendererDisconnected,
+                         weak_factory_.GetWeakPtr(), id));
+    }
+    renderer_api->GetV8HeapStatistics(
+        base::BindOnce(&AppMetricsHistory::OnRendererHeapStatistics,
+                       weak_factory_.GetWeakPtr(), id));
+  }
+}
+
+void AppMetricsHistory::OnRendererHeapStatistics(
+    content::ChildProcessId id,
+    uint64_t used_heap_size,
+    uint64_t total_heap_size) {
+  renderer_heaps_[id] = {used_heap_size, total_heap_size};
+}
+
+void AppMetricsHistory::OnRendererDisconnected(content::ChildProcessId id) {
+  // The frame went away; the next sample picks another one.
+  renderer_apis_.erase(id);
+}
+
+void AppMetricsHistory::Append(const Record& record) {
+  records_[next_] = record;
+  next_ = (next_ + 1) % records_.size();
+  size_ = std::min(size_ + 1, records_.size());
+  ++sequence_;
+}
+
+const AppMetricsHistory::Record& AppMetricsHistory::RecordAt(
+    size_t index) const {
+  return records_[(next_ + records_.size() - size_ + index) % records_.size()];
+}
+
+template <typename TypedArray, typename T>
+v8::Local<TypedArray> AppMetricsHistory::Column(v8::Isolate* isolate,
+                                                T Record::* field) const {
+  v8::Local<v8::ArrayBuffer> buffer =
+      v8::ArrayBuffer::New(isolate, size_ * sizeof(T));
+  // SAFETY: |buffer| was allocated above to hold |size_| values of T.
+  auto values =
+      UNSAFE_BUFFERS(base::span(static_cast<T*>(buffer->Data()), size_));
+  for (size_t i = 0; i < size_; ++i)
+    values[i] = RecordAt(i).*field;
+  return TypedArray::New(buffer, 0, size_);
+}
+
+v8::Local<v8::Value> AppMetricsHistory::ToV8(v8::Isolate* isolate) const {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("interval", interval_.InMillisecondsF());
+  dict.Set("capacity", static_cast<uint32_t>(records_.size()));
+
+  std::vector<gin_helper::Dictionary> processes;
+  processes.reserve(processes_.size());
+  for (const auto& [id, entry] : processes_) {
+    auto process = gin_helper::Dictionary::CreateEmpty(isolate);
+    process.Set("id", id.GetUnsafeValue());
+    process.Set("pid", entry.pid);
+    process.Set("type", content::GetProcessTypeNameInEnglish(entry.type));
+    process.Set("creationTime",
+                entry.creation_time.InMillisecondsFSinceUnixEpoch());
+    if (!entry.service_name.empty())
+      process.Set("serviceName", entry.service_name);
+    if (!entry.name.empty())
+      process.Set("name", entry.name);
+    processes.push_back(process);
+  }
+  dict.Set("processes", processes);
+
+  dict.Set("time", Column<v8::Float64Array>(isolate, &Record::time));
+  dict.Set("processId",
+           Column<v8::Int32Array>(isolate, &Record::process_id));
+  dict.Set("cpuUsage", Column<v8::Float32Array>(isolate, &Record::cpu_usage));
+  dict.Set("idleWakeups",
+           Column<v8::Uint32Array>(isolate, &Record::idle_wakeups));
+  dict.Set("workingSetSize",
+           Column<v8::Uint32Array>(isolate, &Record::working_set_size));
+  dict.Set("privateBytes",
+           Column<v8::Uint32Array>(isolate, &Record::private_bytes));
+  dict.Set("proportionalSetSize",
+           Column<v8::Uint32Array>(isolate, &Record::proportional_set_size));
+  dict.Set("swapSize", Column<v8::Uint32Array>(isolate, &Record::swap_size));
+  dict.Set("heapUsed", Column<v8::Uint32Array>(isolate, &Record::heap_used));
+  dict.Set("heapTotal",
+           Column<v8::Uint32Array>(isolate, &Record::heap_total));
+  return dict.GetHandle();
+}
+
+}  // namespace electron
@@ -0,0 +1,122 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_APP_METRICS_HISTORY_H_
+#define ELECTRON_SHELL_BROWSER_API_APP_METRICS_HISTORY_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "content/public/common/child_process_id.h"
+#include "electron/shell/common/api/api.mojom.h"
+#include "mojo/public/cpp/bindings/remote.h"
+#include "shell/browser/api/app_metrics_collector.h"
+#include "v8/include/v8-forward.h"
+
+namespace electron {
+
+// Records the CPU, memory and V8 heap usage of every process of the app at a
+// fixed interval into a ring buffer of fixed capacity. Records are plain
+// structs written in place, so the history of the last minutes can be kept
+// around permanently and is only converted to typed arrays on request.
+class AppMetricsHistory {
+ public:
+  using ProcessesGetter = base::RepeatingCallback<
+      std::vector<AppMetricsCollector::ProcessInfo>()>;
+
+  // |capacity| is the number of records kept, one per process and sample.
+  AppMetricsHistory(base::TimeDelta interval,
+                    size_t capacity,
+                    ProcessesGetter get_processes);
+  ~AppMetricsHistory();
+
+  // disable copy
+  AppMetricsHistory(const AppMetricsHistory&) = delete;
+  AppMetricsHistory& operator=(const AppMetricsHistory&) = delete;
+
+  void Start();
+  void Stop();
+
+  // Returns the recorded history, oldest record first, as an object of
+  // typed array columns.
+  v8::Local<v8::Value> ToV8(v8::Isolate* isolate) const;
+
+ private:
+  struct Record {
+    double time = 0;
+    int32_t process_id = 0;
+    float cpu_usage = 0;
+    uint32_t idle_wakeups = 0;
+    // Kilobytes.
+    uint32_t working_set_size = 0;
+    uint32_t private_bytes = 0;
+    uint32_t proportional_set_size = 0;
+    uint32_t swap_size = 0;
+    uint32_t heap_used = 0;
+    uint32_t heap_total = 0;
+  };
+
+  struct ProcessEntry {
+    base::ProcessId pid = base::kNullProcessId;
+    int type = 0;
+    std::string service_name;
+    std::string name;
+    base::Time creation_time;
+    // Sequence number of the newest record of the process.
+    uint64_t last_sequence = 0;
+  };
+
+  struct HeapStatistics {
+    uint64_t used = 0;
+    uint64_t total = 0;
+  };
+
+  void Sample();
+  void OnSampled(base::Time time,
+                 std::vector<AppMetricsCollector::Sample> samples);
+  void RequestRendererHeapStatistics();
+  void OnRendererHeapStatistics(content::ChildProcessId id,
+                                uint64_t used_heap_size,
+                                uint64_t total_heap_size);
+  void OnRendererDisconnected(content::ChildProcessId id);
+  void Append(const Record& record);
+  const Record& RecordAt(size_t index) const;
+
+  template <typename TypedArray, typename T>
+  v8::Local<TypedArray> Column(v8::Isolate* isolate, T Record::* field) const;
+
+  const base::TimeDelta interval_;
+  const ProcessesGetter get_processes_;
+
+  std::vector<Record> records_;
+  // Index in |records_| the next record is written to.
+  size_t next_ = 0;
+  size_t size_ = 0;
+  // Number of records appended so far.
+  uint64_t sequence_ = 0;
+
+  base::flat_map<content::ChildProcessId, ProcessEntry> processes_;
+  // The most recent V8 heap statistics reported by each renderer process.
+  // The request for a sample is answered around the time the sample is
+  // taken, so a record uses whatever arrived before it.
+  base::flat_map<content::ChildProcessId, HeapStatistics> renderer_heaps_;
+  base::flat_map<content::ChildProcessId, mojo::Remote<mojom::ElectronRenderer>>
+      renderer_apis_;
+
+  AppMetricsCollector collector_;
+  base::RepeatingTimer timer_;
+  bool sample_pending_ = false;
+
+  base::WeakPtrFactory<AppMetricsHistory> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_API_APP_METRICS_HISTORY_H_
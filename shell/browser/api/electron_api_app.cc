@@ -20,7 +20,9 @@
 #include "base/functional/callback_helpers.h"
 #include "base/notimplemented.h"
 #include "base/path_service.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/system/sys_info.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "base/win/windows_version.h"
 #include "chrome/browser/browser_process.h"
@@ -553,6 +555,151 @@ void OnIconDataAvailable(gin_helper::Promise<gfx::Image> promise,
   }
 }
 
+// Sampling faster than this costs more than it tells, as reading procfs and
+// querying other processes is not free.
+constexpr base::TimeDelta kMinAppMetricsSamplingInterval =
+    base::Milliseconds(100);
+constexpr base::TimeDelta kDefaultAppMetricsSamplingInterval =
+    base::Seconds(1);
+
+// Enough for ten minutes of 20 processes sampled every second, at 48 bytes
+// per record.
+constexpr size_t kDefaultMetricsHistoryCapacity = 12000;
+constexpr size_t kMaxMetricsHistoryCapacity = 1 << 22;
+
+// Parses the |interval| of |options|, throwing if it is too short.
+std::optional<base::TimeDelta> GetAppMetricsSamplingInterval(
+    gin_helper::ErrorThrower thrower,
+    const gin_helper::Dictionary& options) {
+  base::TimeDelta interval = kDefaultAppMetricsSamplingInterval;
+  double interval_ms = 0;
+  if (options.Get("interval", &interval_ms))
+    interval = base::Milliseconds(interval_ms);
+  if (interval < kMinAppMetricsSamplingInterval) {
+    thrower.ThrowError("'interval' must be at least " +
+                       base::NumberToString(
+                           kMinAppMetricsSamplingInterval.InMilliseconds()) +
+                       "ms");
+    return std::nullopt;
+  }
+  return interval;
+}
+
+// Tasks that block the UI thread for longer than this delay input noticeably.
+constexpr base::TimeDelta kDefaultLongTaskThreshold = base::Milliseconds(50);
+
+// The keys of the per-origin objects of getMainThreadTaskStats() and of the
+// breakdown of 'long-task'.
+std::string_view MainThreadOriginToKey(MainThreadMonitor::Origin origin) {
+  switch (origin) {
+    case MainThreadMonitor::Origin::kPostedTask:
+      return "postedTask";
+    case MainThreadMonitor::Origin::kUvCallback:
+      return "uvCallback";
+    case MainThreadMonitor::Origin::kMicrotaskCheckpoint:
+      return "microtaskCheckpoint";
+    case MainThreadMonitor::Origin::kIpcDispatch:
+      return "ipcDispatch";
+  }
+  NOTREACHED();
+}
+
+// The MemoryInfo of getAppMetrics() and collectAppMetrics(), in kilobytes.
+gin_helper::Dictionary MemoryInfoToDict(v8::Isolate* isolate,
+                                        const ProcessMemoryInfo& memory) {
+  auto memory_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  memory_dict.Set("workingSetSize",
+                  static_cast<double>(memory.working_set_size >> 10));
+  memory_dict.Set("peakWorkingSetSize",
+                  static_cast<double>(memory.peak_working_set_size >> 10));
+#if BUILDFLAG(IS_WIN)
+  memory_dict.Set("privateBytes",
+                  static_cast<double>(memory.private_bytes >> 10));
+#elif BUILDFLAG(IS_LINUX)
+  memory_dict.Set("swapSize", static_cast<double>(memory.swap_size >> 10));
+  if (memory.proportional_set_size) {
+    memory_dict.Set("proportionalSetSize",
+                    static_cast<double>(*memory.proportional_set_size >> 10));
+  }
+  if (memory.private_bytes) {
+    memory_dict.Set("privateBytes",
+                    static_cast<double>(*memory.private_bytes >> 10));
+  }
+#endif
+  return memory_dict;
+}
+
+gin_helper::Dictionary AppMetricsSampleToDict(
+    v8::Isolate* isolate,
+    const AppMetricsCollector::Sample& sample) {
+  auto pid_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  auto cpu_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  if (sample.cumulative_cpu_usage) {
+    cpu_dict.Set("cumulativeCPUUsage",
+                 sample.cumulative_cpu_usage->InSecondsF());
+  }
+  cpu_dict.Set("percentCPUUsage", sample.percent_cpu_usage);
+  cpu_dict.Set("idleWakeupsPerSecond", sample.idle_wakeups_per_second);
+
+  pid_dict.Set("cpu", cpu_dict);
+  pid_dict.Set("pid", sample.pid);
+  pid_dict.Set("type", content::GetProcessTypeNameInEnglish(sample.type));
+  pid_dict.Set("creationTime",
+               sample.creation_time.InMillisecondsFSinceUnixEpoch());
+  if (!sample.service_name.empty())
+    pid_dict.Set("serviceName", sample.service_name);
+  if (!sample.name.empty())
+    pid_dict.Set("name", sample.name);
+
+  pid_dict.Set("memory", MemoryInfoToDict(isolate, sample.memory));
+
+#if BUILDFLAG(IS_MAC)
+  pid_dict.Set("sandboxed", sample.sandboxed);
+#elif BUILDFLAG(IS_WIN)
+  pid_dict.Set("integrityLevel", sample.integrity_level);
+  pid_dict.Set("sandboxed", sample.sandboxed);
+#endif
+
+  if (sample.delta) {
+    const AppMetricsCollector::Delta& delta = *sample.delta;
+    auto delta_dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    delta_dict.Set("interval", delta.interval.InMillisecondsF());
+    delta_dict.Set("cumulativeCPUUsage", delta.cpu_usage.InSecondsF());
+    delta_dict.Set("workingSetSize",
+                   static_cast<double>(delta.working_set_size / 1024));
+    if (delta.private_bytes) {
+      delta_dict.Set("privateBytes",
+                     static_cast<double>(*delta.private_bytes / 1024));
+    }
+    if (delta.proportional_set_size) {
+      delta_dict.Set("proportionalSetSize",
+                     static_cast<double>(*delta.proportional_set_size / 1024));
+    }
+    pid_dict.Set("delta", delta_dict);
+  }
+
+  return pid_dict;
+}
+
+std::vector<gin_helper::Dictionary> AppMetricsSamplesToDicts(
+    v8::Isolate* isolate,
+    const std::vector<AppMetricsCollector::Sample>& samples) {
+  std::vector<gin_helper::Dictionary> result;
+  result.reserve(samples.size());
+  for (const auto& sample : samples)
+    result.push_back(AppMetricsSampleToDict(isolate, sample));
+  return result;
+}
+
+void OnAppMetricsCollected(
+    gin_helper::Promise<std::vector<gin_helper::Dictionary>> promise,
+    std::vector<AppMetricsCollector::Sample> samples) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(AppMetricsSamplesToDicts(isolate, samples));
+}
+
 }  // namespace
 
 App::App() {
@@ -1481,23 +1628,9 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
       pid_dict.Set("name", process_metric.second->name);
     }
 
-#if !BUILDFLAG(IS_LINUX)
-    auto memory_info = process_metric.second->GetMemoryInfo();
-
-    auto memory_dict = gin_helper::Dictionary::CreateEmpty(isolate);
-    memory_dict.Set("workingSetSize",
-                    static_cast<double>(memory_info.working_set_size >> 10));
-    memory_dict.Set(
-        "peakWorkingSetSize",
-        static_cast<double>(memory_info.peak_working_set_size >> 10));
-
-#if BUILDFLAG(IS_WIN)
-    memory_dict.Set("privateBytes",
-                    static_cast<double>(memory_info.private_bytes >> 10));
-#endif
-
-    pid_dict.Set("memory", memory_dict);
-#endif
+    pid_dict.Set("memory",
+                 MemoryInfoToDict(isolate,
+                                  process_metric.second->GetMemoryInfo()));
 
 #if BUILDFLAG(IS_MAC)
     pid_dict.Set("sandboxed", process_metric.second->IsSandboxed());
@@ -1514,6 +1647,163 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+std::vector<AppMetricsCollector::ProcessInfo> App::GetAppMetricsProcesses()
+    const {
+  std::vector<AppMetricsCollector::ProcessInfo> processes;
+  processes.reserve(app_metrics_.size());
+  for (const auto& [id, process_metric] : app_metrics_) {
+    processes.emplace_back(id, process_metric->type,
+                           process_metric->process.Duplicate(),
+                           process_metric->service_name, process_metric->name);
+  }
+  return processes;
+}
+
+v8::Local<v8::Promise> App::CollectAppMetrics(v8::Isolate* isolate) {
+  gin_helper::Promise<std::vector<gin_helper::Dictionary>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  app_metrics_collector_.Collect(
+      GetAppMetricsProcesses(),
+      base::BindOnce(&OnAppMetricsCollected, std::move(promise)));
+  return handle;
+}
+
+void App::StartAppMetricsSampling(gin_helper::ErrorThrower thrower,
+                                  gin::Arguments* args) {
+  gin_helper::Dictionary options =
+      gin_helper::Dictionary::CreateEmpty(args->isolate());
+  args->GetNext(&options);
+  std::optional<base::TimeDelta> interval =
+      GetAppMetricsSamplingInterval(thrower, options);
+  if (!interval)
+    return;
+
+  // Restarting with a new interval keeps the per-process state, so the
+  // deltas of the next sample stay relative to the last one.
+  app_metrics_sampling_timer_.Start(
+      FROM_HERE, *interval,
+      base::BindRepeating(&App::SampleAppMetrics, base::Unretained(this)));
+}
+
+void App::StopAppMetricsSampling() {
+  app_metrics_sampling_timer_.Stop();
+}
+
+void App::SampleAppMetrics() {
+  // Skip a tick rather than queueing samples up behind a slow one.
+  if (app_metrics_sample_pending_)
+    return;
+  app_metrics_sample_pending_ = true;
+  app_metrics_sampling_collector_.Collect(
+      GetAppMetricsProcesses(),
+      base::BindOnce(&App::OnAppMetricsSampled, base::Unretained(this)));
+}
+
+void App::OnAppMetricsSampled(
+    std::vector<AppMetricsCollector::Sample> samples) {
+  app_metrics_sample_pending_ = false;
+  // A sample that was in flight when sampling stopped is dropped.
+  if (!app_metrics_sampling_timer_.IsRunning())
+    return;
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  Emit("app-metrics-sampled", AppMetricsSamplesToDicts(isolate, samples));
+}
+
+void App::StartMetricsHistory(gin_helper::ErrorThrower thrower,
+                              gin::Arguments* args) {
+  gin_helper::Dictionary options =
+      gin_helper::Dictionary::CreateEmpty(args->isolate());
+  args->GetNext(&options);
+  std::optional<base::TimeDelta> interval =
+      GetAppMetricsSamplingInterval(thrower, options);
+  if (!interval)
+    return;
+  double capacity = kDefaultMetricsHistoryCapacity;
+  options.Get("capacity", &capacity);
+  if (capacity < 1 || capacity > kMaxMetricsHistoryCapacity) {
+    thrower.ThrowError("'capacity' must be between 1 and " +
+                       base::NumberToString(kMaxMetricsHistoryCapacity));
+    return;
+  }
+
+  app_metrics_history_ = std::make_unique<AppMetricsHistory>(
+      *interval, static_cast<size_t>(capacity),
+      base::BindRepeating(&App::GetAppMetricsProcesses,
+                          base::Unretained(this)));
+  app_metrics_history_->Start();
+}
+
+void App::StopMetricsHistory() {
+  if (app_metrics_history_)
+    app_metrics_history_->Stop();
+}
+
+v8::Local<v8::Value> App::GetMetricsHistory(v8::Isolate* isolate) {
+  if (!app_metrics_history_)
+    return v8::Null(isolate);
+  return app_metrics_history_->ToV8(isolate);
+}
+
+void App::StartMainThreadMonitoring(gin_helper::ErrorThrower thrower,
+                                    gin::Arguments* args) {
+  gin_helper::Dictionary options =
+      gin_helper::Dictionary::CreateEmpty(args->isolate());
+  args->GetNext(&options);
+  base::TimeDelta threshold = kDefaultLongTaskThreshold;
+  double threshold_ms = 0;
+  if (options.Get("longTaskThreshold", &threshold_ms)) {
+    if (threshold_ms <= 0) {
+      thrower.ThrowError("'longTaskThreshold' must be a positive number");
+      return;
+    }
+    threshold = base::Milliseconds(threshold_ms);
+  }
+
+  if (!main_thread_monitor_) {
+    main_thread_monitor_ = std::make_unique<MainThreadMonitor>(
+        base::BindRepeating(&App::OnLongTask, base::Unretained(this)));
+  }
+  main_thread_monitor_->Start(threshold);
+}
+
+void App::StopMainThreadMonitoring() {
+  if (main_thread_monitor_)
+    main_thread_monitor_->Stop();
+}
+
+v8::Local<v8::Value> App::GetMainThreadTaskStats(v8::Isolate* isolate) {
+  if (!main_thread_monitor_)
+    return v8::Null(isolate);
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  const auto& histograms = main_thread_monitor_->histograms();
+  for (size_t i = 0; i < histograms.size(); ++i) {
+    dict.Set(MainThreadOriginToKey(static_cast<MainThreadMonitor::Origin>(i)),
+             histograms[i].ToV8(isolate));
+  }
+  return dict.GetHandle();
+}
+
+void App::OnLongTask(MainThreadMonitor::LongTask long_task) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  auto details = gin_helper::Dictionary::CreateEmpty(isolate);
+  details.Set("startTime",
+              long_task.start_time.InMillisecondsFSinceUnixEpoch());
+  details.Set("duration", long_task.duration.InMillisecondsF());
+  details.Set("origin", MainThreadMonitor::OriginToString(long_task.origin));
+  if (!long_task.name.empty())
+    details.Set("name", long_task.name);
+  auto breakdown = gin_helper::Dictionary::CreateEmpty(isolate);
+  for (size_t i = 0; i < long_task.breakdown.size(); ++i) {
+    breakdown.Set(
+        MainThreadOriginToKey(static_cast<MainThreadMonitor::Origin>(i)),
+        long_task.breakdown[i].InMillisecondsF());
+  }
+  details.Set("breakdown", breakdown);
+  Emit("long-task", details);
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   return gin::ConvertToV8(isolate, content::GetFeatureStatus());
 }
@@ -2038,6 +2328,15 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  &App::DisableDomainBlockingFor3DAPIs)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("collectAppMetrics", &App::CollectAppMetrics)
+      .SetMethod("startAppMetricsSampling", &App::StartAppMetricsSampling)
+      .SetMethod("stopAppMetricsSampling", &App::StopAppMetricsSampling)
+      .SetMethod("startMetricsHistory", &App::StartMetricsHistory)
+      .SetMethod("stopMetricsHistory", &App::StopMetricsHistory)
+      .SetMethod("getMetricsHistory", &App::GetMetricsHistory)
+      .SetMethod("startMainThreadMonitoring", &App::StartMainThreadMonitoring)
+      .SetMethod("stopMainThreadMonitoring", &App::StopMainThreadMonitoring)
+      .SetMethod("getMainThreadTaskStats", &App::GetMainThreadTaskStats)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if IS_MAS_BUILD()
@@ -11,6 +11,7 @@
 
 #include "base/containers/flat_map.h"
 #include "base/task/cancelable_task_tracker.h"
+#include "base/timer/timer.h"
 #include "chrome/browser/process_singleton.h"
 #include "content/public/browser/browser_child_process_observer.h"
 #include "content/public/browser/gpu_data_manager_observer.h"
@@ -23,10 +24,13 @@
 #include "net/base/completion_repeating_callback.h"
 #include "net/base/features.h"
 #include "net/ssl/client_cert_identity.h"
+#include "shell/browser/api/app_metrics_collector.h"
+#include "shell/browser/api/app_metrics_history.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/browser_observer.h"
 #include "shell/browser/electron_browser_client.h"
 #include "shell/browser/event_emitter_mixin.h"
+#include "shell/browser/main_thread_monitor.h"
 #include "v8/include/cppgc/persistent.h"
 
 #if BUILDFLAG(USE_NSS_CERTS)
@@ -230,6 +234,22 @@ class App final : public gin::Wrappable<App>,
                                      gin::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  v8::Local<v8::Promise> CollectAppMetrics(v8::Isolate* isolate);
+  void StartAppMetricsSampling(gin_helper::ErrorThrower thrower,
+                               gin::Arguments* args);
+  void StopAppMetricsSampling();
+  void SampleAppMetrics();
+  void OnAppMetricsSampled(std::vector<AppMetricsCollector::Sample> samples);
+  std::vector<AppMetricsCollector::ProcessInfo> GetAppMetricsProcesses() const;
+  void StartMetricsHistory(gin_helper::ErrorThrower thrower,
+                           gin::Arguments* args);
+  void StopMetricsHistory();
+  v8::Local<v8::Value> GetMetricsHistory(v8::Isolate* isolate);
+  void StartMainThreadMonitoring(gin_helper::ErrorThrower thrower,
+                                 gin::Arguments* args);
+  void StopMainThreadMonitoring();
+  v8::Local<v8::Value> GetMainThreadTaskStats(v8::Isolate* isolate);
+  void OnLongTask(MainThreadMonitor::LongTask long_task);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
                                     const std::string& info_type);
@@ -295,6 +315,19 @@ class App final : public gin::Wrappable<App>,
                  std::unique_ptr<electron::ProcessMetric>>
       app_metrics_;
 
+  // Sample |app_metrics_| off the UI thread for collectAppMetrics() and the
+  // periodic sampling mode respectively. Each keeps its own per-process
+  // state, so one-off calls do not reset the deltas of the sampling stream.
+  AppMetricsCollector app_metrics_collector_;
+  AppMetricsCollector app_metrics_sampling_collector_;
+  base::RepeatingTimer app_metrics_sampling_timer_;
+  bool app_metrics_sample_pending_ = false;
+  // Kept after stopMetricsHistory() so it can still be queried.
+  std::unique_ptr<AppMetricsHistory> app_metrics_history_;
+  // Kept after stopMainThreadMonitoring() so its histograms can still be
+  // queried.
+  std::unique_ptr<MainThreadMonitor> main_thread_monitor_;
+
   bool disable_hw_acceleration_ = false;
   bool disable_domain_blocking_for_3DAPIs_ = false;
   bool watch_singleton_socket_on_ready_ = false;
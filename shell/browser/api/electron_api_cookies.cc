@@ -4,16 +4,21 @@
 
 #include "shell/browser/api/electron_api_cookies.h"
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/storage_partition.h"
+#include "gin/arguments.h"
 #include "gin/dictionary.h"
 #include "gin/object_template_builder.h"
 #include "net/cookies/canonical_cookie.h"
@@ -281,6 +286,77 @@ std::string StringToCookieSameSite(const std::string* str_ptr,
   return "";
 }
 
+// Builds the cookie described by |details| as for cookies.set(), along with
+// the URL and options to store it with. Returns nullptr and sets |error| if
+// the details are invalid.
+std::unique_ptr<net::CanonicalCookie> CreateCookie(
+    const base::DictValue& details,
+    GURL* url,
+    net::CookieOptions* options,
+    std::string* error) {
+  const std::string* url_string = details.FindString("url");
+  if (!url_string) {
+    *error = "Missing required option 'url'";
+    return nullptr;
+  }
+  const std::string* name = details.FindString("name");
+  const std::string* value = details.FindString("value");
+  const std::string* domain = details.FindString("domain");
+  const std::string* path = details.FindString("path");
+  bool http_only = details.FindBool("httpOnly").value_or(false);
+  const std::string* same_site_string = details.FindString("sameSite");
+  net::CookieSameSite same_site;
+  *error = StringToCookieSameSite(same_site_string, &same_site);
+  if (!error->empty())
+    return nullptr;
+  bool secure = details.FindBool("secure").value_or(
+      same_site == net::CookieSameSite::NO_RESTRICTION);
+
+  *url = GURL(*url_string);
+  if (!url->is_valid()) {
+    net::CookieInclusionStatus cookie_inclusion_status;
+    cookie_inclusion_status.AddExclusionReason(
+        net::CookieInclusionStatus::ExclusionReason::EXCLUDE_INVALID_DOMAIN);
+    *error = InclusionStatusToString(cookie_inclusion_status);
+    return nullptr;
+  }
+
+  net::CookieInclusionStatus status;
+  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
+      *url, name ? *name : "", value ? *value : "", domain ? *domain : "",
+      path ? *path : "", ParseTimeProperty(details.FindDouble("creationDate")),
+      ParseTimeProperty(details.FindDouble("expirationDate")),
+      ParseTimeProperty(details.FindDouble("lastAccessDate")), secure,
+      http_only, same_site, net::COOKIE_PRIORITY_DEFAULT, std::nullopt,
+      &status);
+
+  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
+    net::CookieInclusionStatus cookie_inclusion_status;
+    cookie_inclusion_status.AddExclusionReason(
+        net::CookieInclusionStatus::ExclusionReason::EXCLUDE_FAILURE_TO_STORE);
+    *error = InclusionStatusToString(!status.IsInclude()
+                                         ? status
+                                         : cookie_inclusion_status);
+    return nullptr;
+  }
+
+  if (http_only) {
+    options->set_include_httponly();
+  }
+  options->set_same_site_cookie_context(
+      net::CookieOptions::SameSiteCookieContext::MakeInclusive());
+  return canonical_cookie;
+}
+
+struct SetCookieResult {
+  size_t index;
+  // Empty on success.
+  std::string error;
+};
+
+// Changes beyond this many are flushed without waiting for the interval.
+constexpr size_t kMaxCookieChangeBatchSize = 1000;
+
 bool IsDeletion(net::CookieChangeCause cause) {
   switch (cause) {
     case net::CookieChangeCause::INSERTED:
@@ -368,60 +444,15 @@ v8::Local<v8::Promise> Cookies::Set(v8::Isolate* isolate,
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
-  const std::string* url_string = details.FindString("url");
-  if (!url_string) {
-    promise.RejectWithErrorMessage("Missing required option 'url'");
-    return handle;
-  }
-  const std::string* name = details.FindString("name");
-  const std::string* value = details.FindString("value");
-  const std::string* domain = details.FindString("domain");
-  const std::string* path = details.FindString("path");
-  bool http_only = details.FindBool("httpOnly").value_or(false);
-  const std::string* same_site_string = details.FindString("sameSite");
-  net::CookieSameSite same_site;
-  std::string error = StringToCookieSameSite(same_site_string, &same_site);
-  if (!error.empty()) {
+  GURL url;
+  net::CookieOptions options;
+  std::string error;
+  std::unique_ptr<net::CanonicalCookie> canonical_cookie =
+      CreateCookie(details, &url, &options, &error);
+  if (!canonical_cookie) {
     promise.RejectWithErrorMessage(error);
     return handle;
   }
-  bool secure = details.FindBool("secure").value_or(
-      same_site == net::CookieSameSite::NO_RESTRICTION);
-
-  GURL url(url_string ? *url_string : "");
-  if (!url.is_valid()) {
-    net::CookieInclusionStatus cookie_inclusion_status;
-    cookie_inclusion_status.AddExclusionReason(
-        net::CookieInclusionStatus::ExclusionReason::EXCLUDE_INVALID_DOMAIN);
-    promise.RejectWithErrorMessage(
-        InclusionStatusToString(cookie_inclusion_status));
-    return handle;
-  }
-
-  net::CookieInclusionStatus status;
-  auto canonical_cookie = net::CanonicalCookie::CreateSanitizedCookie(
-      url, name ? *name : "", value ? *value : "", domain ? *domain : "",
-      path ? *path : "", ParseTimeProperty(details.FindDouble("creationDate")),
-      ParseTimeProperty(details.FindDouble("expirationDate")),
-      ParseTimeProperty(details.FindDouble("lastAccessDate")), secure,
-      http_only, same_site, net::COOKIE_PRIORITY_DEFAULT, std::nullopt,
-      &status);
-
-  if (!canonical_cookie || !canonical_cookie->IsCanonical()) {
-    net::CookieInclusionStatus cookie_inclusion_status;
-    cookie_inclusion_status.AddExclusionReason(
-        net::CookieInclusionStatus::ExclusionReason::EXCLUDE_FAILURE_TO_STORE);
-    promise.RejectWithErrorMessage(InclusionStatusToString(
-        !status.IsInclude() ? status : cookie_inclusion_status));
-    return handle;
-  }
-
-  net::CookieOptions options;
-  if (http_only) {
-    options.set_include_httponly();
-  }
-  options.set_same_site_cookie_context(
-      net::CookieOptions::SameSiteCookieContext::MakeInclusive());
 
   auto* storage_partition = browser_context_->GetDefaultStoragePartition();
   auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
@@ -440,6 +471,121 @@ v8::Local<v8::Promise> Cookies::Set(v8::Isolate* isolate,
   return handle;
 }
 
+v8::Local<v8::Promise> Cookies::SetMany(v8::Isolate* isolate,
+                                        base::ListValue details) {
+  gin_helper::Promise<gin_helper::Dictionary> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // The cookie manager has no bulk setter, so every cookie is sent as its own
+  // message; they are all queued on the pipe at once and answered together,
+  // rather than costing a promise and a JS round trip each.
+  std::vector<SetCookieResult> failures;
+  std::vector<std::pair<size_t, std::unique_ptr<net::CanonicalCookie>>>
+      cookies;
+  std::vector<std::pair<GURL, net::CookieOptions>> targets;
+  for (size_t i = 0; i < details.size(); ++i) {
+    std::string error = "Cookie details must be an object";
+    if (const base::DictValue* dict = details[i].GetIfDict()) {
+      GURL url;
+      net::CookieOptions options;
+      if (auto cookie = CreateCookie(*dict, &url, &options, &error)) {
+        cookies.emplace_back(i, std::move(cookie));
+        targets.emplace_back(std::move(url), std::move(options));
+        continue;
+      }
+    }
+    failures.push_back({i, std::move(error)});
+  }
+
+  auto on_all_set = base::BindOnce(
+      [](gin_helper::Promise<gin_helper::Dictionary> promise, size_t total,
+         std::vector<SetCookieResult> failures,
+         std::vector<SetCookieResult> results) {
+        for (auto& result : results) {
+          if (!result.error.empty())
+            failures.push_back(std::move(result));
+        }
+        std::ranges::sort(failures, {}, &SetCookieResult::index);
+
+        v8::Isolate* isolate = promise.isolate();
+        v8::HandleScope handle_scope(isolate);
+        std::vector<gin_helper::Dictionary> failure_dicts;
+        failure_dicts.reserve(failures.size());
+        for (const auto& failure : failures) {
+          auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+          dict.Set("index", static_cast<uint32_t>(failure.index));
+          dict.Set("error", failure.error);
+          failure_dicts.push_back(std::move(dict));
+        }
+        auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+        result.Set("succeeded",
+                   static_cast<uint32_t>(total - failures.size()));
+        result.Set("failures", failure_dicts);
+        promise.Resolve(result);
+      },
+      std::move(promise), details.size(), std::move(failures));
+  auto barrier = base::BarrierCallback<SetCookieResult>(cookies.size(),
+                                                        std::move(on_all_set));
+
+  auto* storage_partition = browser_context_->GetDefaultStoragePartition();
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+  for (size_t i = 0; i < cookies.size(); ++i) {
+    manager->SetCanonicalCookie(
+        *cookies[i].second, targets[i].first, targets[i].second,
+        base::BindOnce(
+            [](base::RepeatingCallback<void(SetCookieResult)> barrier,
+               size_t index, net::CookieAccessResult r) {
+              barrier.Run({index, r.status.IsInclude()
+                                      ? std::string()
+                                      : InclusionStatusToString(r.status)});
+            },
+            barrier, cookies[i].first));
+  }
+
+  return handle;
+}
+
+v8::Local<v8::Promise> Cookies::RemoveMany(v8::Isolate* isolate,
+                                           base::ListValue cookies) {
+  gin_helper::Promise<uint32_t> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  std::vector<network::mojom::CookieDeletionFilterPtr> filters;
+  for (const auto& item : cookies) {
+    const base::DictValue* dict = item.GetIfDict();
+    const std::string* url = dict ? dict->FindString("url") : nullptr;
+    const std::string* name = dict ? dict->FindString("name") : nullptr;
+    if (!url || !name) {
+      promise.RejectWithErrorMessage(
+          "Each cookie to remove must have a 'url' and a 'name'");
+      return handle;
+    }
+    auto filter = network::mojom::CookieDeletionFilter::New();
+    filter->url = GURL(*url);
+    filter->cookie_name = *name;
+    filters.push_back(std::move(filter));
+  }
+
+  auto barrier = base::BarrierCallback<uint32_t>(
+      filters.size(),
+      base::BindOnce(
+          [](gin_helper::Promise<uint32_t> promise,
+             std::vector<uint32_t> num_deleted) {
+            uint32_t total = 0;
+            for (uint32_t n : num_deleted)
+              total += n;
+            promise.Resolve(total);
+          },
+          std::move(promise)));
+
+  auto* storage_partition = browser_context_->GetDefaultStoragePartition();
+  auto* manager = storage_partition->GetCookieManagerForBrowserProcess();
+  for (auto& filter : filters)
+    manager->DeleteCookies(std::move(filter), barrier);
+
+  return handle;
+}
+
 v8::Local<v8::Promise> Cookies::FlushStore(v8::Isolate* isolate) {
   gin_helper::Promise<void> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
@@ -453,7 +599,34 @@ v8::Local<v8::Promise> Cookies::FlushStore(v8::Isolate* isolate) {
   return handle;
 }
 
+double Cookies::GetChangeBatchInterval() const {
+  return change_batch_interval_.InMillisecondsF();
+}
+
+void Cookies::SetChangeBatchInterval(gin::Arguments* args) {
+  double interval_ms = 0;
+  if (!args->GetNext(&interval_ms) || !(interval_ms >= 0)) {
+    args->ThrowTypeError("changeBatchInterval must be a non-negative number");
+    return;
+  }
+  change_batch_interval_ = base::Milliseconds(interval_ms);
+  if (change_batch_interval_.is_zero())
+    FlushCookieChanges();
+}
+
 void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
+  if (change_batch_interval_.is_positive()) {
+    pending_changes_.push_back(change);
+    if (pending_changes_.size() >= kMaxCookieChangeBatchSize) {
+      FlushCookieChanges();
+    } else if (!change_batch_timer_.IsRunning()) {
+      change_batch_timer_.Start(FROM_HERE, change_batch_interval_,
+                                base::BindOnce(&Cookies::FlushCookieChanges,
+                                               base::Unretained(this)));
+    }
+    return;
+  }
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
   bool is_deletion = IsDeletion(change.cause);
@@ -462,6 +635,28 @@ void Cookies::OnCookieChanged(const net::CookieChangeInfo& change) {
        gin::ConvertToV8(isolate, is_deletion));
 }
 
+void Cookies::FlushCookieChanges() {
+  change_batch_timer_.Stop();
+  if (pending_changes_.empty())
+    return;
+
+  std::vector<net::CookieChangeInfo> changes;
+  changes.swap(pending_changes_);
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> list = v8::Array::New(isolate, changes.size());
+  for (size_t i = 0; i < changes.size(); ++i) {
+    gin::Dictionary dict(isolate, v8::Object::New(isolate));
+    dict.Set("cookie", changes[i].cookie);
+    dict.Set("cause", changes[i].cause);
+    dict.Set("removed", IsDeletion(changes[i].cause));
+    list->Set(context, i, dict.GetHandle()).Check();
+  }
+  Emit("changed-batch", list.As<v8::Value>());
+}
+
 // static
 Cookies* Cookies::Create(v8::Isolate* isolate,
                          ElectronBrowserContext* browser_context) {
@@ -476,7 +671,11 @@ gin::ObjectTemplateBuilder Cookies::GetObjectTemplateBuilder(
       .SetMethod("get", &Cookies::Get)
       .SetMethod("remove", &Cookies::Remove)
       .SetMethod("set", &Cookies::Set)
-      .SetMethod("flushStore", &Cookies::FlushStore);
+      .SetMethod("flushStore", &Cookies::FlushStore)
+      .SetMethod("setMany", &Cookies::SetMany)
+      .SetMethod("removeMany", &Cookies::RemoveMany)
+      .SetProperty("changeBatchInterval", &Cookies::GetChangeBatchInterval,
+                   &Cookies::SetChangeBatchInterval);
 }
 
 const gin::WrapperInfo* Cookies::wrapper_info() const {
@@ -6,15 +6,22 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_COOKIES_H_
 
 #include <string>
+#include <vector>
 
 #include "base/callback_list.h"
 #include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "gin/wrappable.h"
 #include "shell/browser/event_emitter_mixin.h"
 
 class GURL;
 
+namespace gin {
+class Arguments;
+}  // namespace gin
+
 namespace gin_helper {
 class Dictionary;
 }  // namespace gin_helper
@@ -59,12 +66,24 @@ class Cookies final : public gin::Wrappable<Cookies>,
                                 const GURL& url,
                                 const std::string& name);
   v8::Local<v8::Promise> FlushStore(v8::Isolate*);
+  v8::Local<v8::Promise> SetMany(v8::Isolate*, base::ListValue details);
+  v8::Local<v8::Promise> RemoveMany(v8::Isolate*, base::ListValue cookies);
+
+  double GetChangeBatchInterval() const;
+  void SetChangeBatchInterval(gin::Arguments* args);
 
   // CookieChangeNotifier subscription:
   void OnCookieChanged(const net::CookieChangeInfo& change);
+  void FlushCookieChanges();
 
   base::CallbackListSubscription cookie_change_subscription_;
 
+  // When non-zero, changes are collected and emitted together as a single
+  // 'changed-batch' event at most once per interval.
+  base::TimeDelta change_batch_interval_;
+  std::vector<net::CookieChangeInfo> pending_changes_;
+  base::OneShotTimer change_batch_timer_;
+
   // Weak reference; ElectronBrowserContext is guaranteed to outlive us.
   raw_ptr<ElectronBrowserContext> browser_context_;
 };
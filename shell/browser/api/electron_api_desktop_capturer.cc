@@ -4,12 +4,16 @@
 
 #include "shell/browser/api/electron_api_desktop_capturer.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/containers/flat_set.h"
+#include "base/containers/lru_cache.h"
 #include "base/memory/raw_ptr.h"
+#include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/time/time.h"
@@ -200,6 +204,48 @@ BOOL CALLBACK EnumDisplayMonitorsCallback(HMONITOR monitor,
 // password manager window that's marked as uncapturable).
 constexpr base::TimeDelta kDesktopCapturerReadyTimeout = base::Seconds(3);
 
+// Thumbnails kept for reuse by later getSources() calls, keyed by source.
+constexpr size_t kMaxCachedThumbnails = 256;
+
+struct CachedThumbnail {
+  gfx::ImageSkia image;
+  gfx::Size size;
+  base::TimeTicks captured;
+};
+
+using ThumbnailCache = base::LRUCache<content::DesktopMediaID, CachedThumbnail>;
+
+ThumbnailCache& GetThumbnailCache() {
+  static base::NoDestructor<ThumbnailCache> cache(kMaxCachedThumbnails);
+  return *cache;
+}
+
+// Returns a thumbnail of |id| at |size| no older than |max_age|, if any.
+const gfx::ImageSkia* GetCachedThumbnail(const content::DesktopMediaID& id,
+                                         const gfx::Size& size,
+                                         base::TimeDelta max_age) {
+  if (!max_age.is_positive())
+    return nullptr;
+  auto& cache = GetThumbnailCache();
+  auto it = cache.Peek(id);
+  if (it == cache.end() || it->second.size != size ||
+      base::TimeTicks::Now() - it->second.captured > max_age) {
+    return nullptr;
+  }
+  return &it->second.image;
+}
+
+// Fills in a cached thumbnail when |source| has not been captured yet.
+DesktopMediaList::Source WithCachedThumbnail(DesktopMediaList::Source source,
+                                             const gfx::Size& size,
+                                             base::TimeDelta max_age) {
+  if (source.thumbnail.isNull()) {
+    if (const auto* cached = GetCachedThumbnail(source.id, size, max_age))
+      source.thumbnail = *cached;
+  }
+  return source;
+}
+
 }  // namespace
 
 namespace gin {
@@ -243,12 +289,16 @@ class DesktopCapturer::ListObserver : public DesktopMediaListObserver {
  public:
   ListObserver(DesktopCapturer* capturer,
                DesktopMediaList* list,
-               bool need_thumbnails)
+               bool need_thumbnails,
+               bool stream_sources)
       : capturer_{capturer->WeakCallbackTarget()},
         list_{list},
         list_type_{list->GetMediaListType()},
         is_delegated_{list->IsSourceListDelegated()},
-        need_thumbnails_{need_thumbnails} {}
+        need_thumbnails_{need_thumbnails},
+        stream_sources_{stream_sources},
+        thumbnail_size_{capturer->thumbnail_size_},
+        cache_max_age_{capturer->thumbnail_cache_max_age_} {}
   ~ListObserver() override = default;
 
   [[nodiscard]] bool IsReady() const {
@@ -260,12 +310,24 @@ class DesktopCapturer::ListObserver : public DesktopMediaListObserver {
 
     // are all the thumbnails ready?
     for (int i = 0; i < list_->GetSourceCount(); ++i) {
-      if (list_->GetSource(i).thumbnail.isNull())
+      const auto& source = list_->GetSource(i);
+      if (source.thumbnail.isNull() &&
+          !GetCachedThumbnail(source.id, thumbnail_size_, cache_max_age_)) {
         return false;
+      }
     }
     return true;
   }
 
+  // Takes in the sources of a list that DesktopMediaList::Update() has
+  // enumerated without capturing them. Returns true if they all have a
+  // cached thumbnail, so that the list is ready without a capture.
+  bool OnSourcesEnumerated() {
+    for (int i = 0; i < list_->GetSourceCount(); ++i)
+      OnSourceAdded(i);
+    return notified_;
+  }
+
  private:
   // Post OnListReady to the message loop when sources & thumbnails are done.
   void MaybeNotifyReady() {
@@ -277,17 +339,42 @@ class DesktopCapturer::ListObserver : public DesktopMediaListObserver {
         base::BindOnce(&DesktopCapturer::OnListReady, capturer_, list_type_));
   }
 
+  // Hands the source at |index| to the capturer once it has a thumbnail, so
+  // that callers can show it without waiting for the rest of the list.
+  void MaybeStreamSource(int index) {
+    if (!stream_sources_)
+      return;
+    DesktopMediaList::Source source = WithCachedThumbnail(
+        list_->GetSource(index), thumbnail_size_, cache_max_age_);
+    if (need_thumbnails_ && source.thumbnail.isNull())
+      return;
+    if (!streamed_.insert(source.id).second)
+      return;
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, base::BindOnce(&DesktopCapturer::OnSourceReady, capturer_,
+                                  list_type_, std::move(source)));
+  }
+
   // DesktopMediaListObserver:
   void OnSourceAdded(int index) override {
     // Rely on OnDelegatedSourceListSelection for delegated source lists.
     if (!is_delegated_)
       has_sources_ = true;
+    MaybeStreamSource(index);
     MaybeNotifyReady();
   }
   void OnSourceRemoved(int index) override { MaybeNotifyReady(); }
   void OnSourceMoved(int old_index, int new_index) override {}
   void OnSourceNameChanged(int index) override {}
-  void OnSourceThumbnailChanged(int index) override { MaybeNotifyReady(); }
+  void OnSourceThumbnailChanged(int index) override {
+    if (cache_max_age_.is_positive()) {
+      const auto& source = list_->GetSource(index);
+      GetThumbnailCache().Put(source.id, {source.thumbnail, thumbnail_size_,
+                                          base::TimeTicks::Now()});
+    }
+    MaybeStreamSource(index);
+    MaybeNotifyReady();
+  }
   void OnSourcePreviewChanged(size_t index) override {}
   void OnDelegatedSourceListSelection() override {
     // For delegated source lists (e.g. PipeWire), the selection event means
@@ -305,6 +392,10 @@ class DesktopCapturer::ListObserver : public DesktopMediaListObserver {
   DesktopMediaList::Type list_type_;
   bool is_delegated_ = false;
   bool need_thumbnails_ = false;
+  bool stream_sources_ = false;
+  gfx::Size thumbnail_size_;
+  base::TimeDelta cache_max_age_;
+  base::flat_set<content::DesktopMediaID> streamed_;
   bool has_sources_ = false;
   bool notified_ = false;
 };
@@ -339,8 +430,13 @@ void DesktopCapturer::FinalizeList(std::unique_ptr<ListObserver>& observer,
 void DesktopCapturer::StartHandling(bool capture_window,
                                     bool capture_screen,
                                     const gfx::Size& thumbnail_size,
-                                    bool fetch_window_icons) {
+                                    bool fetch_window_icons,
+                                    bool stream_sources,
+                                    double thumbnail_cache_max_age_ms) {
   fetch_window_icons_ = fetch_window_icons;
+  thumbnail_size_ = thumbnail_size;
+  thumbnail_cache_max_age_ =
+      base::Milliseconds(std::max(thumbnail_cache_max_age_ms, 0.0));
 #if BUILDFLAG(IS_WIN)
   if (content::desktop_capture::CreateDesktopCaptureOptions()
           .allow_directx_capturer()) {
@@ -396,8 +492,8 @@ void DesktopCapturer::StartHandling(bool capture_window,
           /* auto_show_delegated_source_list = */ use_generic);
       window_capturer_->SetThumbnailSize(thumbnail_size);
       window_observer_ = std::make_unique<ListObserver>(
-          this, window_capturer_.get(), need_thumbnails);
-      window_capturer_->StartUpdating(window_observer_.get());
+          this, window_capturer_.get(), need_thumbnails, stream_sources);
+      StartList(window_capturer_.get(), window_observer_.get());
       pending_lists_++;
     }
   }
@@ -409,8 +505,8 @@ void DesktopCapturer::StartHandling(bool capture_window,
           DesktopMediaList::Type::kScreen, std::move(capturer));
       screen_capturer_->SetThumbnailSize(thumbnail_size);
       screen_observer_ = std::make_unique<ListObserver>(
-          this, screen_capturer_.get(), need_thumbnails);
-      screen_capturer_->StartUpdating(screen_observer_.get());
+          this, screen_capturer_.get(), need_thumbnails, stream_sources);
+      StartList(screen_capturer_.get(), screen_observer_.get());
       pending_lists_++;
     }
   }
@@ -432,6 +528,36 @@ void DesktopCapturer::StartHandling(bool capture_window,
   }
 }
 
+void DesktopCapturer::StartList(DesktopMediaList* list,
+                                ListObserver* observer) {
+  // Thumbnails can only be reused once the sources are known, so enumerate
+  // them without capturing first and only capture if one is not cached.
+  if (thumbnail_cache_max_age_.is_positive() && !thumbnail_size_.IsEmpty() &&
+      !list->IsSourceListDelegated()) {
+    list->Update(base::BindOnce(&DesktopCapturer::OnListEnumerated,
+                                WeakCallbackTarget(),
+                                list->GetMediaListType()));
+    return;
+  }
+  list->StartUpdating(observer);
+}
+
+void DesktopCapturer::OnListEnumerated(DesktopMediaList::Type type) {
+  if (finished_)
+    return;
+
+  const bool is_window = type == DesktopMediaList::Type::kWindow;
+  DesktopMediaList* list =
+      is_window ? window_capturer_.get() : screen_capturer_.get();
+  ListObserver* observer =
+      is_window ? window_observer_.get() : screen_observer_.get();
+  if (!list || !observer)
+    return;
+
+  if (!observer->OnSourcesEnumerated())
+    list->StartUpdating(observer);
+}
+
 void DesktopCapturer::OnListReady(const DesktopMediaList::Type type) {
   if (finished_)
     return;
@@ -450,6 +576,28 @@ void DesktopCapturer::OnListReady(const DesktopMediaList::Type type) {
   }
 }
 
+void DesktopCapturer::OnSourceReady(DesktopMediaList::Type type,
+                                    DesktopMediaList::Source source) {
+  if (finished_)
+    return;
+
+  const bool is_window = type == DesktopMediaList::Type::kWindow;
+  DesktopCapturer::Source streamed{std::move(source), std::string(),
+                                   is_window && fetch_window_icons_};
+#if BUILDFLAG(IS_MAC)
+  // On Mac, the IDs across the APIs match. Elsewhere the display id needs
+  // the whole screen list and is only part of the final result.
+  if (!is_window) {
+    streamed.display_id =
+        base::NumberToString(streamed.media_list_source.id.id);
+  }
+#endif
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  gin_helper::CallMethod(this, "_onsource", streamed);
+}
+
 void DesktopCapturer::OnReadyTimeout() {
   if (finished_)
     return;
@@ -473,8 +621,10 @@ void DesktopCapturer::CollectSourcesFrom(DesktopMediaList* list) {
     std::vector<DesktopCapturer::Source> window_sources;
     window_sources.reserve(list->GetSourceCount());
     for (int i = 0; i < list->GetSourceCount(); i++) {
-      window_sources.emplace_back(list->GetSource(i), std::string(),
-                                  fetch_window_icons_);
+      window_sources.emplace_back(
+          WithCachedThumbnail(list->GetSource(i), thumbnail_size_,
+                              thumbnail_cache_max_age_),
+          std::string(), fetch_window_icons_);
     }
     std::move(window_sources.begin(), window_sources.end(),
               std::back_inserter(captured_sources_));
@@ -484,7 +634,10 @@ void DesktopCapturer::CollectSourcesFrom(DesktopMediaList* list) {
     std::vector<DesktopCapturer::Source> screen_sources;
     screen_sources.reserve(list->GetSourceCount());
     for (int i = 0; i < list->GetSourceCount(); i++) {
-      screen_sources.emplace_back(list->GetSource(i), std::string());
+      screen_sources.emplace_back(
+          WithCachedThumbnail(list->GetSource(i), thumbnail_size_,
+                              thumbnail_cache_max_age_),
+          std::string());
     }
 #if BUILDFLAG(IS_WIN)
     // Gather the same unique screen IDs used by the electron.screen API in
@@ -9,11 +9,13 @@
 #include <string>
 #include <vector>
 
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "chrome/browser/media/webrtc/desktop_media_list.h"
 #include "gin/weak_cell.h"
 #include "gin/wrappable.h"
 #include "shell/common/gin_helper/self_keep_alive.h"
+#include "ui/gfx/geometry/size.h"
 
 namespace electron::api {
 
@@ -32,10 +34,16 @@ class DesktopCapturer final : public gin::Wrappable<DesktopCapturer> {
 
   static bool IsDisplayMediaSystemPickerAvailable();
 
+  // When |stream_sources| is set, each source is also passed to `_onsource`
+  // as soon as its thumbnail is available. Thumbnails captured by earlier
+  // calls within |thumbnail_cache_max_age_ms| are used instead of waiting
+  // for a new capture.
   void StartHandling(bool capture_window,
                      bool capture_screen,
                      const gfx::Size& thumbnail_size,
-                     bool fetch_window_icons);
+                     bool fetch_window_icons,
+                     bool stream_sources,
+                     double thumbnail_cache_max_age_ms);
 
   // gin::Wrappable
   static const gin::WrapperInfo kWrapperInfo;
@@ -60,7 +68,13 @@ class DesktopCapturer final : public gin::Wrappable<DesktopCapturer> {
 
   void FinalizeList(std::unique_ptr<ListObserver>& observer,
                     std::unique_ptr<DesktopMediaList>& list);
+  // Starts capturing the sources of |list|, unless they all have a cached
+  // thumbnail.
+  void StartList(DesktopMediaList* list, ListObserver* observer);
+  void OnListEnumerated(DesktopMediaList::Type type);
   void OnListReady(DesktopMediaList::Type type);
+  void OnSourceReady(DesktopMediaList::Type type,
+                     DesktopMediaList::Source source);
   void OnReadyTimeout();
   void CollectSourcesFrom(DesktopMediaList* list);
   void HandleFailure();
@@ -74,6 +88,8 @@ class DesktopCapturer final : public gin::Wrappable<DesktopCapturer> {
   int pending_lists_ = 0;
   bool finished_ = false;
   bool fetch_window_icons_ = false;
+  gfx::Size thumbnail_size_;
+  base::TimeDelta thumbnail_cache_max_age_;
   base::OneShotTimer deadline_;
 #if BUILDFLAG(IS_WIN)
   bool using_directx_capturer_ = false;
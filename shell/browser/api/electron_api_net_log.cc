@@ -4,12 +4,25 @@
 
 #include "shell/browser/api/electron_api_net_log.h"
 
+#include <algorithm>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include "base/command_line.h"
+#include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
+#include "base/files/file_util.h"
 #include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/task/thread_pool.h"
 #include "chrome/browser/browser_process.h"
 #include "components/net_log/chrome_net_log.h"
@@ -17,9 +30,11 @@
 #include "electron/electron_version.h"
 #include "gin/object_template_builder.h"
 #include "gin/persistent.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "net/log/file_net_log_observer.h"
 #include "net/log/net_log_capture_mode.h"
 #include "shell/browser/electron_browser_context.h"
+#include "shell/browser/javascript_environment.h"
 #include "shell/browser/net/system_network_context_manager.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -79,6 +94,139 @@ void ResolvePromiseWithNetError(gin_helper::Promise<void> promise,
   }
 }
 
+void ResolvePromiseWithError(gin_helper::Promise<void> promise,
+                             std::string error) {
+  if (error.empty()) {
+    promise.Resolve();
+  } else {
+    promise.RejectWithErrorMessage(error);
+  }
+}
+
+// A new ring segment is started every 1/kRingBufferSegments of the ring's
+// duration, and each segment holds 1/kRingBufferSegments of its size.
+constexpr size_t kRingBufferSegments = 6;
+constexpr uint64_t kDefaultRingBufferMaxSize = 10 * 1024 * 1024;
+constexpr base::TimeDelta kDefaultRingBufferDuration = base::Seconds(60);
+
+int64_t GetRingSegmentSize(const base::FilePath& path) {
+  return base::GetFileSize(path).value_or(0);
+}
+
+base::FilePath CreateRingDirectory() {
+  base::FilePath dir;
+  if (!base::CreateNewTempDirectory("electron-net-log-", &dir))
+    return {};
+  return dir;
+}
+
+// Resolves event or source type names against a net log's constants table
+// (e.g. constants.logEventTypes) into the numeric ids used by its events.
+std::optional<base::flat_set<int>> ResolveTypeIds(
+    const base::DictValue& constants,
+    std::string_view table_name,
+    const std::vector<std::string>& names,
+    std::string* error) {
+  if (names.empty())
+    return std::nullopt;
+  const base::DictValue* table = constants.FindDict(table_name);
+  base::flat_set<int> ids;
+  for (const auto& name : names) {
+    const std::optional<int> id =
+        table ? table->FindInt(name) : std::optional<int>();
+    if (!id) {
+      *error = base::StringPrintf("Unknown net log type '%s'", name.c_str());
+      return std::nullopt;
+    }
+    ids.insert(*id);
+  }
+  return ids;
+}
+
+// Merges the finished ring segments (oldest first) into a single net log at
+// |dump_path|, keeping only events that match |filter|. Returns an error
+// message on failure. Runs on the file task runner.
+std::string MergeRingSegments(std::vector<base::FilePath> segments,
+                              base::FilePath dump_path,
+                              api::NetLog::RingBufferFilter filter) {
+  std::optional<base::DictValue> merged;
+  base::ListValue events;
+  for (const auto& segment : segments) {
+    std::string contents;
+    if (!base::ReadFileToString(segment, &contents))
+      continue;
+    std::optional<base::DictValue> log =
+        base::JSONReader::ReadDict(contents, base::JSON_PARSE_RFC);
+    if (!log)
+      continue;
+    if (base::ListValue* segment_events = log->FindList("events")) {
+      for (auto& event : *segment_events)
+        events.Append(std::move(event));
+    }
+    // Keep the constants and polled data of the most recent segment.
+    log->Remove("events");
+    merged = std::move(log);
+  }
+  if (!merged)
+    return "The net log ring buffer is empty";
+
+  std::string error;
+  const base::DictValue* constants = merged->FindDict("constants");
+  const base::DictValue empty_constants;
+  const auto event_ids = ResolveTypeIds(
+      constants ? *constants : empty_constants, "logEventTypes",
+      filter.event_types, &error);
+  const auto source_ids = ResolveTypeIds(
+      constants ? *constants : empty_constants, "logSourceType",
+      filter.source_types, &error);
+  if (!error.empty())
+    return error;
+
+  // Event times are milliseconds on the TimeTicks clock, serialized as
+  // strings. Age is measured from the newest event in the ring.
+  const auto event_time = [](const base::Value& event) -> int64_t {
+    int64_t time = 0;
+    if (const std::string* str = event.GetDict().FindString("time"))
+      base::StringToInt64(*str, &time);
+    return time;
+  };
+  int64_t newest = 0;
+  if (filter.max_age) {
+    for (const auto& event : events) {
+      if (event.is_dict())
+        newest = std::max(newest, event_time(event));
+    }
+  }
+
+  base::ListValue filtered;
+  for (auto& event : events) {
+    if (!event.is_dict())
+      continue;
+    const base::DictValue& dict = event.GetDict();
+    if (event_ids) {
+      const std::optional<int> type = dict.FindInt("type");
+      if (!type || !base::Contains(*event_ids, *type))
+        continue;
+    }
+    if (source_ids) {
+      const std::optional<int> type = dict.FindIntByDottedPath("source.type");
+      if (!type || !base::Contains(*source_ids, *type))
+        continue;
+    }
+    if (filter.max_age &&
+        event_time(event) < newest - filter.max_age->InMilliseconds()) {
+      continue;
+    }
+    filtered.Append(std::move(event));
+  }
+  merged->Set("events", std::move(filtered));
+
+  const std::optional<std::string> json = base::WriteJson(*merged);
+  if (!json || !base::WriteFile(dump_path, *json))
+    return "Failed to write net log to " + dump_path.AsUTF8Unsafe();
+  return {};
+}
+
 }  // namespace
 
 namespace api {
@@ -93,6 +241,12 @@ NetLog::NetLog(ElectronBrowserContext* const browser_context)
 
 NetLog::~NetLog() = default;
 
+NetLog::RingBufferFilter::RingBufferFilter() = default;
+NetLog::RingBufferFilter::RingBufferFilter(const RingBufferFilter&) = default;
+NetLog::RingBufferFilter& NetLog::RingBufferFilter::operator=(
+    const RingBufferFilter&) = default;
+NetLog::RingBufferFilter::~RingBufferFilter() = default;
+
 v8::Local<v8::Promise> NetLog::StartLogging(base::FilePath log_path,
                                             gin::Arguments* args) {
   if (log_path.empty()) {
@@ -223,12 +377,368 @@ v8::Local<v8::Promise> NetLog::StopLogging(v8::Isolate* const isolate) {
   return handle;
 }
 
+v8::Local<v8::Promise> NetLog::StartRingBuffer(gin::Arguments* args) {
+  net::NetLogCaptureMode capture_mode = net::NetLogCaptureMode::kDefault;
+  uint64_t max_size = kDefaultRingBufferMaxSize;
+  base::TimeDelta duration = kDefaultRingBufferDuration;
+
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    v8::Local<v8::Value> capture_mode_v8;
+    if (dict.Get("captureMode", &capture_mode_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), capture_mode_v8,
+                              &capture_mode)) {
+        args->ThrowTypeError("Invalid value for captureMode");
+        return {};
+      }
+    }
+    v8::Local<v8::Value> max_size_v8;
+    if (dict.Get("maxSize", &max_size_v8)) {
+      if (!gin::ConvertFromV8(args->isolate(), max_size_v8, &max_size) ||
+          max_size < kRingBufferSegments) {
+        args->ThrowTypeError("Invalid value for maxSize");
+        return {};
+      }
+    }
+    v8::Local<v8::Value> duration_v8;
+    if (dict.Get("duration", &duration_v8)) {
+      double seconds = 0;
+      if (!gin::ConvertFromV8(args->isolate(), duration_v8, &seconds) ||
+          !(seconds >= 1)) {
+        args->ThrowTypeError("Invalid value for duration");
+        return {};
+      }
+      duration = base::Seconds(seconds);
+    }
+  }
+
+  if (ring_active_) {
+    args->ThrowTypeError("There is already a net log ring buffer running");
+    return {};
+  }
+
+  gin_helper::Promise<void> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  ring_active_ = true;
+  ring_capture_mode_ = capture_mode;
+  ring_segment_size_ = max_size / kRingBufferSegments;
+  ring_duration_ = duration;
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&CreateRingDirectory),
+      base::BindOnce(&NetLog::OnRingDirectoryCreated, WeakRef(),
+                     std::move(promise)));
+  return handle;
+}
+
+cppgc::Persistent<gin::WeakCell<NetLog>> NetLog::WeakRef() {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  return gin::WrapPersistent(
+      weak_factory_.GetWeakCell(isolate->GetCppHeap()->GetAllocationHandle()));
+}
+
+void NetLog::OnRingDirectoryCreated(gin_helper::Promise<void> promise,
+                                    base::FilePath dir) {
+  if (!ring_active_) {
+    // Stopped before the directory was created.
+    if (!dir.empty()) {
+      file_task_runner_->PostTask(
+          FROM_HERE,
+          base::BindOnce(base::IgnoreResult(&base::DeletePathRecursively),
+                         dir));
+    }
+    promise.RejectWithErrorMessage("The net log ring buffer was stopped");
+    return;
+  }
+  if (dir.empty()) {
+    ring_active_ = false;
+    promise.RejectWithErrorMessage(
+        "Failed to create a directory for the net log ring buffer");
+    return;
+  }
+  ring_dir_ = std::move(dir);
+  StartRingSegment(base::BindOnce(&NetLog::OnRingBufferStarted, WeakRef(),
+                                  std::move(promise)));
+  ring_rotate_timer_.Start(
+      FROM_HERE, ring_duration_ / kRingBufferSegments,
+      base::BindRepeating(
+          [](NetLog* self) { self->RotateRingSegment(base::OnceClosure()); },
+          base::Unretained(this)));
+}
+
+void NetLog::OnRingBufferStarted(gin_helper::Promise<void> promise,
+                                 int32_t error) {
+  if (error != net::OK && ring_active_) {
+    ring_active_ = false;
+    ring_rotate_timer_.Stop();
+    ring_exporter_.reset();
+    file_task_runner_->PostTask(
+        FROM_HERE,
+        base::BindOnce(base::IgnoreResult(&base::DeletePathRecursively),
+                       std::exchange(ring_dir_, base::FilePath())));
+  }
+  ResolvePromiseWithNetError(std::move(promise), error);
+}
+
+void NetLog::StartRingSegment(StartedCallback started) {
+  ring_segment_pending_ = true;
+  base::FilePath path = ring_dir_.AppendASCII(
+      "segment-" + base::NumberToString(ring_next_segment_id_++) + ".json");
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(OpenFileForWriting, path),
+      base::BindOnce(&NetLog::OnRingSegmentFileCreated, WeakRef(), path,
+                     std::move(started)));
+}
+
+void NetLog::OnRingSegmentFileCreated(base::FilePath path,
+                                      StartedCallback started,
+                                      base::File file) {
+  ring_segment_pending_ = false;
+  if (!ring_active_) {
+    std::move(started).Run(net::ERR_ABORTED);
+    return;
+  }
+  if (!file.IsValid()) {
+    std::move(started).Run(net::ERR_FILE_NOT_FOUND);
+    return;
+  }
+
+  auto command_line_string =
+      base::CommandLine::ForCurrentProcess()->GetCommandLineString();
+  auto channel_string = std::string("Electron " ELECTRON_VERSION);
+  base::DictValue custom_constants = net_log::GetPlatformConstantsForNetLog(
+      command_line_string, channel_string);
+
+  ring_current_segment_ = std::move(path);
+  browser_context_->GetDefaultStoragePartition()
+      ->GetNetworkContext()
+      ->CreateNetLogExporter(ring_exporter_.BindNewPipeAndPassReceiver());
+  ring_exporter_.set_disconnect_handler(base::BindOnce(
+      &NetLog::OnRingConnectionError, base::Unretained(this)));
+  // Runs with ERR_ABORTED if the network service goes away first.
+  ring_exporter_->Start(
+      std::move(file), std::move(custom_constants), ring_capture_mode_,
+      net::NetLogFileFormat::kJson, ring_segment_size_,
+      mojo::WrapCallbackWithDefaultInvokeIfNotRun(std::move(started),
+                                                  net::ERR_ABORTED));
+}
+
+void NetLog::RotateRingSegment(base::OnceClosure done) {
+  if (!ring_active_ || ring_segment_pending_ || !ring_exporter_) {
+    // Nothing to finish yet; whatever has been finished so far is all there
+    // is.
+    if (done)
+      std::move(done).Run();
+    return;
+  }
+
+  // The current segment is only stopped once the next one is recording, so
+  // that no events are missed in between; the few events in the overlap are
+  // recorded by both. The finishing exporter no longer feeds the ring, so
+  // losing it must not trigger a restart.
+  mojo::Remote<network::mojom::NetLogExporter> finishing =
+      std::move(ring_exporter_);
+  finishing.reset_on_disconnect();
+  base::FilePath finishing_path = std::move(ring_current_segment_);
+  StartRingSegment(base::BindOnce(
+      &NetLog::OnRingSegmentRotated, WeakRef(), std::move(finishing),
+      std::move(finishing_path), std::move(done)));
+}
+
+void NetLog::OnRingSegmentRotated(
+    mojo::Remote<network::mojom::NetLogExporter> finishing,
+    base::FilePath finishing_path,
+    base::OnceClosure done,
+    int32_t error) {
+  OnRingSegmentRestarted(error);
+
+  // As in StopLogging(), the remote is moved into its own callback so that it
+  // lives long enough for Stop() to complete.
+  auto* exporter = finishing.get();
+  exporter->Stop(
+      base::DictValue(),
+      mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+          base::BindOnce(
+              [](mojo::Remote<network::mojom::NetLogExporter>,
+                 base::OnceClosure finished, int32_t error) {
+                std::move(finished).Run();
+              },
+              std::move(finishing),
+              base::BindOnce(&NetLog::OnRingSegmentFinished, WeakRef(),
+                             std::move(finishing_path),
+                             base::TimeTicks::Now(), std::move(done))),
+          net::ERR_ABORTED));
+}
+
+void NetLog::OnRingSegmentFinished(base::FilePath path,
+                                   base::TimeTicks finished,
+                                   base::OnceClosure done) {
+  if (!ring_active_) {
+    if (done)
+      std::move(done).Run();
+    return;
+  }
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&GetRingSegmentSize, path),
+      base::BindOnce(&NetLog::AddRingSegment, WeakRef(), std::move(path),
+                     finished, std::move(done)));
+}
+
+void NetLog::AddRingSegment(base::FilePath path,
+                            base::TimeTicks finished,
+                            base::OnceClosure done,
+                            int64_t size) {
+  if (ring_active_) {
+    ring_segments_.push_back({std::move(path), finished, size});
+    ring_segments_size_ += size;
+    // Segments are discarded by age and total size rather than by count, so
+    // the short segments finished early by dumps do not erode the history.
+    const base::TimeTicks horizon = base::TimeTicks::Now() - ring_duration_;
+    const int64_t max_size = ring_segment_size_ * kRingBufferSegments;
+    while (ring_segments_.size() > 1 &&
+           (ring_segments_.front().finished < horizon ||
+            ring_segments_size_ > max_size)) {
+      ring_segments_size_ -= ring_segments_.front().size;
+      file_task_runner_->PostTask(
+          FROM_HERE, base::BindOnce(base::IgnoreResult(&base::DeleteFile),
+                                    std::move(ring_segments_.front().path)));
+      ring_segments_.pop_front();
+    }
+  }
+  if (done)
+    std::move(done).Run();
+}
+
+void NetLog::OnRingSegmentRestarted(int32_t error) {
+  // ERR_ABORTED means the network service went away before the segment
+  // started, which OnRingConnectionError() recovers from.
+  if (error == net::OK || error == net::ERR_ABORTED || !ring_active_)
+    return;
+  LOG(ERROR) << "Stopping the net log ring buffer: "
+             << net::ErrorToString(error);
+  ring_active_ = false;
+  ring_rotate_timer_.Stop();
+  ring_exporter_.reset();
+  ring_segments_.clear();
+  ring_segments_size_ = 0;
+  file_task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(base::IgnoreResult(&base::DeletePathRecursively),
+                     std::exchange(ring_dir_, base::FilePath())));
+}
+
+v8::Local<v8::Promise> NetLog::DumpRingBuffer(base::FilePath dump_path,
+                                              gin::Arguments* args) {
+  if (dump_path.empty()) {
+    args->ThrowTypeError("The first parameter must be a valid string");
+    return {};
+  }
+
+  RingBufferFilter filter;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    dict.Get("eventTypes", &filter.event_types);
+    dict.Get("sourceTypes", &filter.source_types);
+    double seconds = 0;
+    if (dict.Get("duration", &seconds) && seconds > 0)
+      filter.max_age = base::Seconds(seconds);
+  }
+
+  gin_helper::Promise<void> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!ring_active_) {
+    promise.RejectWithErrorMessage("No net log ring buffer in progress");
+    return handle;
+  }
+
+  // A segment is only written out once its exporter stops, so finish the
+  // current one to include the latest events; recording continues in a fresh
+  // segment and no history is discarded.
+  RotateRingSegment(base::BindOnce(&NetLog::WriteRingDump, WeakRef(),
+                                   std::move(dump_path), std::move(filter),
+                                   std::move(promise)));
+  return handle;
+}
+
+void NetLog::WriteRingDump(base::FilePath dump_path,
+                           RingBufferFilter filter,
+                           gin_helper::Promise<void> promise) {
+  // Segment deletions are posted to the same sequence, so the files listed
+  // here stay valid until the merge has finished.
+  std::vector<base::FilePath> segments;
+  segments.reserve(ring_segments_.size());
+  for (const auto& segment : ring_segments_)
+    segments.push_back(segment.path);
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&MergeRingSegments, std::move(segments),
+                     std::move(dump_path), std::move(filter)),
+      base::BindOnce(&ResolvePromiseWithError, std::move(promise)));
+}
+
+v8::Local<v8::Promise> NetLog::StopRingBuffer(v8::Isolate* const isolate) {
+  gin_helper::Promise<void> promise{isolate};
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!ring_active_) {
+    promise.RejectWithErrorMessage("No net log ring buffer in progress");
+    return handle;
+  }
+
+  ring_active_ = false;
+  ring_rotate_timer_.Stop();
+  ring_segments_.clear();
+  ring_segments_size_ = 0;
+  auto delete_dir =
+      base::BindOnce(base::IgnoreResult(&base::DeletePathRecursively),
+                     std::exchange(ring_dir_, base::FilePath()));
+
+  if (ring_exporter_) {
+    ring_exporter_->Stop(
+        base::DictValue(),
+        base::BindOnce(
+            [](mojo::Remote<network::mojom::NetLogExporter>,
+               scoped_refptr<base::TaskRunner> file_task_runner,
+               base::OnceClosure delete_dir, gin_helper::Promise<void> promise,
+               int32_t error) {
+              file_task_runner->PostTask(FROM_HERE, std::move(delete_dir));
+              promise.Resolve();
+            },
+            std::move(ring_exporter_), file_task_runner_, std::move(delete_dir),
+            std::move(promise)));
+  } else {
+    file_task_runner_->PostTask(FROM_HERE, std::move(delete_dir));
+    promise.Resolve();
+  }
+  return handle;
+}
+
+void NetLog::OnRingConnectionError() {
+  // The network service went away, taking the unfinished segment with it.
+  // Keep the finished history and carry on in a fresh segment once the
+  // network context has been recreated.
+  ring_exporter_.reset();
+  if (!ring_current_segment_.empty()) {
+    file_task_runner_->PostTask(
+        FROM_HERE, base::BindOnce(base::IgnoreResult(&base::DeleteFile),
+                                  std::exchange(ring_current_segment_,
+                                                base::FilePath())));
+  }
+  if (ring_active_ && !ring_segment_pending_) {
+    StartRingSegment(
+        base::BindOnce(&NetLog::OnRingSegmentRestarted, WeakRef()));
+  }
+}
+
 gin::ObjectTemplateBuilder NetLog::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
   return gin::Wrappable<NetLog>::GetObjectTemplateBuilder(isolate)
       .SetProperty("currentlyLogging", &NetLog::IsCurrentlyLogging)
       .SetMethod("startLogging", &NetLog::StartLogging)
-      .SetMethod("stopLogging", &NetLog::StopLogging);
+      .SetMethod("stopLogging", &NetLog::StopLogging)
+      .SetProperty("ringBufferActive", &NetLog::IsRingBufferActive)
+      .SetMethod("startRingBuffer", &NetLog::StartRingBuffer)
+      .SetMethod("dumpRingBuffer", &NetLog::DumpRingBuffer)
+      .SetMethod("stopRingBuffer", &NetLog::StopRingBuffer);
 }
 
 const gin::WrapperInfo* NetLog::wrapper_info() const {
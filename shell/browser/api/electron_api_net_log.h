@@ -6,8 +6,16 @@
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_NET_LOG_H_
 
 #include <optional>
+#include <string>
+#include <vector>
 
+#include "base/containers/circular_deque.h"
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback_forward.h"
 #include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "gin/weak_cell.h"
 #include "gin/wrappable.h"
@@ -16,9 +24,9 @@
 #include "services/network/public/mojom/net_log.mojom.h"
 #include "shell/common/gc_plugin.h"
 #include "shell/common/gin_helper/promise.h"
+#include "v8/include/cppgc/persistent.h"
 
 namespace base {
-class FilePath;
 class TaskRunner;
 }  // namespace base
 
@@ -64,6 +72,26 @@ class NetLog final : public gin::Wrappable<NetLog> {
   v8::Local<v8::Promise> StopLogging(v8::Isolate* isolate);
   bool IsCurrentlyLogging() const;
 
+  // Ring-buffer mode: keeps only the most recent network events so that they
+  // can be dumped on demand, e.g. when a request stalls.
+  v8::Local<v8::Promise> StartRingBuffer(gin::Arguments* args);
+  v8::Local<v8::Promise> DumpRingBuffer(base::FilePath dump_path,
+                                        gin::Arguments* args);
+  v8::Local<v8::Promise> StopRingBuffer(v8::Isolate* isolate);
+  bool IsRingBufferActive() const { return ring_active_; }
+
+  // Event/source type names and age limit applied when dumping the ring.
+  struct RingBufferFilter {
+    RingBufferFilter();
+    RingBufferFilter(const RingBufferFilter&);
+    RingBufferFilter& operator=(const RingBufferFilter&);
+    ~RingBufferFilter();
+
+    std::vector<std::string> event_types;
+    std::vector<std::string> source_types;
+    std::optional<base::TimeDelta> max_age;
+  };
+
  protected:
   void OnConnectionError();
 
@@ -74,6 +102,39 @@ class NetLog final : public gin::Wrappable<NetLog> {
   void NetLogStarted(int32_t error);
 
  private:
+  using StartedCallback = base::OnceCallback<void(int32_t)>;
+
+  cppgc::Persistent<gin::WeakCell<NetLog>> WeakRef();
+
+  void OnRingDirectoryCreated(gin_helper::Promise<void> promise,
+                              base::FilePath dir);
+  void OnRingBufferStarted(gin_helper::Promise<void> promise, int32_t error);
+  void StartRingSegment(StartedCallback started);
+  void OnRingSegmentFileCreated(base::FilePath path,
+                                StartedCallback started,
+                                base::File file);
+  // Finishes the current segment and starts a new one. |done| runs once the
+  // finished segment has been flushed and added to |ring_segments_|.
+  void RotateRingSegment(base::OnceClosure done);
+  void OnRingSegmentRotated(
+      mojo::Remote<network::mojom::NetLogExporter> finishing,
+      base::FilePath finishing_path,
+      base::OnceClosure done,
+      int32_t error);
+  void OnRingSegmentFinished(base::FilePath path,
+                             base::TimeTicks finished,
+                             base::OnceClosure done);
+  void AddRingSegment(base::FilePath path,
+                      base::TimeTicks finished,
+                      base::OnceClosure done,
+                      int64_t size);
+  // Stops the ring buffer if a replacement segment could not be started.
+  void OnRingSegmentRestarted(int32_t error);
+  void WriteRingDump(base::FilePath dump_path,
+                     RingBufferFilter filter,
+                     gin_helper::Promise<void> promise);
+  void OnRingConnectionError();
+
   raw_ptr<ElectronBrowserContext> browser_context_;
 
   GC_PLUGIN_IGNORE(
@@ -84,6 +145,31 @@ class NetLog final : public gin::Wrappable<NetLog> {
 
   scoped_refptr<base::TaskRunner> file_task_runner_;
 
+  // Ring-buffer state. Events are written by the network service into a
+  // series of size-bounded segment files under |ring_dir_|; a new segment is
+  // started every |ring_duration_| / kRingBufferSegments, and finished
+  // segments are deleted once they are older than |ring_duration_| or the
+  // history outgrows the configured size, so disk and memory use stay bounded.
+  bool ring_active_ = false;
+  bool ring_segment_pending_ = false;
+  GC_PLUGIN_IGNORE(
+      "Context tracking of remote is not needed in the browser process.")
+  mojo::Remote<network::mojom::NetLogExporter> ring_exporter_;
+  base::FilePath ring_dir_;
+  base::FilePath ring_current_segment_;
+  struct RingSegment {
+    base::FilePath path;
+    base::TimeTicks finished;
+    int64_t size = 0;
+  };
+  base::circular_deque<RingSegment> ring_segments_;
+  int64_t ring_segments_size_ = 0;
+  uint64_t ring_next_segment_id_ = 0;
+  net::NetLogCaptureMode ring_capture_mode_ = net::NetLogCaptureMode::kDefault;
+  uint64_t ring_segment_size_ = 0;
+  base::TimeDelta ring_duration_;
+  base::RepeatingTimer ring_rotate_timer_;
+
   gin::WeakCellFactory<NetLog> weak_factory_{this};
 };
 
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/command_line.h"
 #include "base/containers/fixed_flat_map.h"
 #include "base/containers/map_util.h"
@@ -71,6 +72,7 @@
 #include "shell/browser/api/electron_api_utility_process.h"
 #include "shell/browser/api/electron_api_web_frame_main.h"
 #include "shell/browser/api/electron_api_web_request.h"
+#include "shell/browser/api/warm_web_contents_pool.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/electron_browser_main_parts.h"
@@ -1004,6 +1006,37 @@ v8::Local<v8::Promise> Session::ClearAuthCache() {
   return handle;
 }
 
+v8::Local<v8::Value> Session::GetNetworkStatistics(v8::Isolate* isolate) {
+  const NetworkStatistics& stats = browser_context_->network_statistics();
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("requests", stats.requests);
+  dict.Set("failedRequests", stats.failed_requests);
+  dict.Set("cacheHits", stats.cache_hits);
+  dict.Set("reusedConnections", stats.reused_connections);
+  dict.Set("encodedBytesReceived", stats.encoded_bytes_received);
+  dict.Set("decodedBytesReceived", stats.decoded_bytes_received);
+  dict.Set("totalDuration", stats.total_duration.InMillisecondsF());
+  dict.Set("totalTimeToFirstByte",
+           stats.total_time_to_first_byte.InMillisecondsF());
+  return dict.GetHandle();
+}
+
+void Session::ClearNetworkStatistics() {
+  browser_context_->network_statistics() = NetworkStatistics();
+}
+
+void Session::StartIpcProfiling() {
+  ipc_profiler_.Start();
+}
+
+void Session::StopIpcProfiling() {
+  ipc_profiler_.Stop();
+}
+
+v8::Local<v8::Value> Session::GetIpcProfile(v8::Isolate* isolate) {
+  return ipc_profiler_.ToV8(isolate);
+}
+
 void Session::AllowNTLMCredentialsForDomains(const std::string& domains) {
   auto* command_line = base::CommandLine::ForCurrentProcess();
   network::mojom::HttpAuthDynamicParamsPtr auth_dynamic_params =
@@ -1439,6 +1472,153 @@ void Session::Preconnect(const gin_helper::Dictionary& options,
                      url, num_sockets_to_preconnect));
 }
 
+namespace {
+
+struct HostResolution {
+  size_t index;
+  std::string host;
+  int error;
+  std::vector<net::IPEndPoint> endpoints;
+  base::TimeDelta latency;
+};
+
+}  // namespace
+
+v8::Local<v8::Promise> Session::ResolveHosts(std::vector<std::string> hosts,
+                                             gin::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+
+  network::mojom::ResolveHostParametersPtr params =
+      network::mojom::ResolveHostParameters::New();
+  bool preconnect = false;
+  int num_sockets_to_preconnect = 1;
+  v8::Local<v8::Value> options_v8;
+  if (args->GetNext(&options_v8) && !options_v8->IsUndefined()) {
+    gin_helper::Dictionary options;
+    if (!gin::ConvertFromV8(isolate, options_v8, &options) ||
+        !gin::ConvertFromV8(isolate, options_v8, &params)) {
+      args->ThrowTypeError("Invalid options");
+      return {};
+    }
+    options.Get("preconnect", &preconnect);
+    if (options.Get("numSockets", &num_sockets_to_preconnect) &&
+        (num_sockets_to_preconnect < 1 || num_sockets_to_preconnect > 6)) {
+      args->ThrowTypeError("numSockets is outside range [1,6]");
+      return {};
+    }
+  }
+
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // All lookups are issued at once; results are reported in |hosts| order
+  // once the last one has completed.
+  auto on_all_resolved = base::BindOnce(
+      [](gin_helper::Promise<v8::Local<v8::Value>> promise,
+         std::vector<HostResolution> resolutions) {
+        std::ranges::sort(resolutions, {}, &HostResolution::index);
+        v8::Isolate* isolate = promise.isolate();
+        v8::HandleScope handle_scope(isolate);
+        std::vector<gin_helper::Dictionary> results;
+        results.reserve(resolutions.size());
+        for (const auto& resolution : resolutions) {
+          auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+          dict.Set("host", resolution.host);
+          dict.Set("endpoints", resolution.endpoints);
+          if (resolution.error != net::OK)
+            dict.Set("error", net::ErrorToString(resolution.error));
+          dict.Set("latency", resolution.latency.InMillisecondsF());
+          results.push_back(std::move(dict));
+        }
+        promise.Resolve(gin::ConvertToV8(isolate, results));
+      },
+      std::move(promise));
+  auto barrier = base::BarrierCallback<HostResolution>(
+      hosts.size(), std::move(on_all_resolved));
+
+  for (size_t i = 0; i < hosts.size(); ++i) {
+    auto fn = base::MakeRefCounted<ResolveHostFunction>(
+        browser_context(), hosts[i], params.Clone(),
+        base::BindOnce(
+            [](base::RepeatingCallback<void(HostResolution)> barrier,
+               base::WeakPtr<ElectronBrowserContext> browser_context,
+               size_t index, std::string host, base::TimeTicks start,
+               int num_sockets_to_preconnect, int64_t net_error,
+               const std::optional<net::AddressList>& addrs) {
+              HostResolution resolution{index, std::move(host),
+                                        static_cast<int>(net_error),
+                                        {}, base::TimeTicks::Now() - start};
+              if (net_error >= 0 && addrs)
+                resolution.endpoints = addrs->endpoints();
+              // With the address now cached, open sockets to the host so the
+              // first request skips the TCP/TLS handshake too.
+              if (num_sockets_to_preconnect > 0 && net_error >= 0 &&
+                  browser_context) {
+                StartPreconnectOnUI(browser_context.get(),
+                                    GURL("https://" + resolution.host),
+                                    num_sockets_to_preconnect);
+              }
+              barrier.Run(std::move(resolution));
+            },
+            barrier, browser_context_->GetWeakPtr(), i, hosts[i],
+            base::TimeTicks::Now(),
+            preconnect ? num_sockets_to_preconnect : 0));
+    fn->Run();
+  }
+
+  return handle;
+}
+
+void Session::SetWarmWebContentsPool(gin::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  v8::Local<v8::Value> value;
+  gin_helper::Dictionary options;
+  int size = 0;
+  if (args->GetNext(&value) && !value->IsNullOrUndefined()) {
+    if (!gin::ConvertFromV8(isolate, value, &options) ||
+        !options.Get("size", &size)) {
+      args->ThrowTypeError("Must pass an object with a 'size' or null");
+      return;
+    }
+    constexpr int kMaxWarmWebContents = 8;
+    if (size < 0 || size > kMaxWarmWebContents) {
+      args->ThrowTypeError(absl::StrFormat("size is outside range [0,%d]",
+                                           kMaxWarmWebContents));
+      return;
+    }
+  }
+
+  base::DictValue web_preferences;
+  if (options.Has("webPreferences") &&
+      !options.Get("webPreferences", &web_preferences)) {
+    args->ThrowTypeError("webPreferences must be serializable");
+    return;
+  }
+
+  warm_web_contents_pool_.reset();
+  if (size == 0)
+    return;
+  warm_web_contents_pool_ = std::make_unique<WarmWebContentsPool>(
+      this, static_cast<size_t>(size), std::move(web_preferences));
+  warm_web_contents_pool_->Fill();
+}
+
+v8::Local<v8::Value> Session::GetWarmWebContentsPoolStats(
+    v8::Isolate* isolate) const {
+  WarmWebContentsPool::Stats stats;
+  if (warm_web_contents_pool_)
+    stats = warm_web_contents_pool_->GetStats();
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("size", static_cast<uint32_t>(stats.size));
+  dict.Set("ready", static_cast<uint32_t>(stats.ready));
+  dict.Set("adopted", static_cast<double>(stats.adopted));
+  dict.Set("misses", static_cast<double>(stats.misses));
+  dict.Set("averageWarmupTime", stats.average_warmup_time.InMillisecondsF());
+  dict.Set("averageAdoptionTime",
+           stats.average_adoption_time.InMillisecondsF());
+  return dict.GetHandle();
+}
+
 v8::Local<v8::Promise> Session::CloseAllConnections() {
   gin_helper::Promise<void> promise(isolate_);
   auto handle = promise.GetHandle();
@@ -1806,6 +1986,7 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                                  v8::Local<v8::ObjectTemplate> templ) {
   gin::ObjectTemplateBuilder(isolate, GetClassName(), templ)
       .SetMethod("resolveHost", &Session::ResolveHost)
+      .SetMethod("resolveHosts", &Session::ResolveHosts)
       .SetMethod("resolveProxy", &Session::ResolveProxy)
       .SetMethod("getCacheSize", &Session::GetCacheSize)
       .SetMethod("clearCache", &Session::ClearCache)
@@ -1831,6 +2012,11 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                  &Session::SetBluetoothPairingHandler)
       .SetMethod("clearHostResolverCache", &Session::ClearHostResolverCache)
       .SetMethod("clearAuthCache", &Session::ClearAuthCache)
+      .SetMethod("getNetworkStatistics", &Session::GetNetworkStatistics)
+      .SetMethod("clearNetworkStatistics", &Session::ClearNetworkStatistics)
+      .SetMethod("startIpcProfiling", &Session::StartIpcProfiling)
+      .SetMethod("stopIpcProfiling", &Session::StopIpcProfiling)
+      .SetMethod("getIpcProfile", &Session::GetIpcProfile)
       .SetMethod("allowNTLMCredentialsForDomains",
                  &Session::AllowNTLMCredentialsForDomains)
       .SetMethod("isPersistent", &Session::IsPersistent)
@@ -1870,6 +2056,9 @@ void Session::FillObjectTemplate(v8::Isolate* isolate,
                    &Session::SetSpellCheckerEnabled)
 #endif
       .SetMethod("preconnect", &Session::Preconnect)
+      .SetMethod("setWarmWebContentsPool", &Session::SetWarmWebContentsPool)
+      .SetMethod("getWarmWebContentsPoolStats",
+                 &Session::GetWarmWebContentsPoolStats)
       .SetMethod("closeAllConnections", &Session::CloseAllConnections)
       .SetMethod("getStoragePath", &Session::GetPath)
       .SetMethod("setCodeCachePath", &Session::SetCodeCachePath)
@@ -1909,6 +2098,7 @@ const char* Session::GetHumanReadableName() const {
 void Session::OnBeforeMicrotasksRunnerDispose(v8::Isolate* isolate) {
   gin::PerIsolateData* data = gin::PerIsolateData::From(isolate);
   data->RemoveDisposeObserver(this);
+  warm_web_contents_pool_.reset();
   Dispose();
   weak_factory_.Invalidate();
   browser_context_ = nullptr;
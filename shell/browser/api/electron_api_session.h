@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_SESSION_H_
 
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "services/network/public/mojom/ssl_config.mojom-forward.h"
 #include "shell/browser/api/ipc_dispatcher.h"
 #include "shell/browser/event_emitter_mixin.h"
+#include "shell/browser/ipc_profiler.h"
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/self_keep_alive.h"
 
@@ -59,6 +61,7 @@ class NetLog;
 class Protocol;
 class ServiceWorkerContext;
 class UtilityProcessWrapper;
+class WarmWebContentsPool;
 class WebRequest;
 
 class Session final : public gin::Wrappable<Session>,
@@ -105,6 +108,8 @@ class Session final : public gin::Wrappable<Session>,
     return browser_context_;
   }
 
+  IpcProfiler* ipc_profiler() { return &ipc_profiler_; }
+
   // gin::Wrappable
   static gin::WrapperInfo kWrapperInfo;
   void Trace(cppgc::Visitor*) const override;
@@ -121,6 +126,8 @@ class Session final : public gin::Wrappable<Session>,
   v8::Local<v8::Promise> ResolveHost(
       std::string host,
       std::optional<network::mojom::ResolveHostParametersPtr> params);
+  v8::Local<v8::Promise> ResolveHosts(std::vector<std::string> hosts,
+                                      gin::Arguments* args);
   v8::Local<v8::Promise> ResolveProxy(gin::Arguments* args);
   v8::Local<v8::Promise> GetCacheSize();
   v8::Local<v8::Promise> ClearCache();
@@ -144,6 +151,11 @@ class Session final : public gin::Wrappable<Session>,
                                   gin::Arguments* args);
   v8::Local<v8::Promise> ClearHostResolverCache(gin::Arguments* args);
   v8::Local<v8::Promise> ClearAuthCache();
+  v8::Local<v8::Value> GetNetworkStatistics(v8::Isolate* isolate);
+  void ClearNetworkStatistics();
+  void StartIpcProfiling();
+  void StopIpcProfiling();
+  v8::Local<v8::Value> GetIpcProfile(v8::Isolate* isolate);
   void AllowNTLMCredentialsForDomains(const std::string& domains);
   void SetUserAgent(const std::string& user_agent, gin::Arguments* args);
   std::string GetUserAgent();
@@ -174,6 +186,11 @@ class Session final : public gin::Wrappable<Session>,
   base::CallbackListSubscription AddAIHandlerChangedCallback(
       base::RepeatingClosure callback);
   void Preconnect(const gin_helper::Dictionary& options, gin::Arguments* args);
+  void SetWarmWebContentsPool(gin::Arguments* args);
+  v8::Local<v8::Value> GetWarmWebContentsPoolStats(v8::Isolate* isolate) const;
+  WarmWebContentsPool* warm_web_contents_pool() const {
+    return warm_web_contents_pool_.get();
+  }
   v8::Local<v8::Promise> CloseAllConnections();
   v8::Local<v8::Value> GetPath(v8::Isolate* isolate);
   void SetCodeCachePath(gin::Arguments* args);
@@ -236,6 +253,10 @@ class Session final : public gin::Wrappable<Session>,
 
   raw_ptr<ElectronBrowserContext> browser_context_;
 
+  std::unique_ptr<WarmWebContentsPool> warm_web_contents_pool_;
+
+  IpcProfiler ipc_profiler_;
+
   gin::WeakCellFactory<Session> weak_factory_{this};
 
   gin_helper::SelfKeepAlive<Session> keep_alive_{this};
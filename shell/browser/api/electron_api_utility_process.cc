@@ -13,6 +13,7 @@
 #include "base/process/kill.h"
 #include "base/process/launch.h"
 #include "base/process/process.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/browser/browser_process.h"
 #include "content/browser/network_service_instance_impl.h"  // nogncheck
 #include "content/public/browser/child_process_host.h"
@@ -22,6 +23,7 @@
 #include "electron/buildflags/buildflags.h"
 #include "gin/object_template_builder.h"
 #include "gin/persistent.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "services/network/public/cpp/originating_process_id.h"
 #include "shell/browser/api/electron_api_session.h"
@@ -31,11 +33,13 @@
 #include "shell/browser/electron_child_process_host_flags.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/browser/net/system_network_context_manager.h"
+#include "shell/common/cpu_profiler.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/handle.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/gin_helper/wrappable_pointer_tags.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_util.h"
@@ -84,6 +88,35 @@ UtilityProcessRegistry& GetAllUtilityProcessWrappers() {
   return *registry;
 }
 
+// Shared by the utility processes of a session, so that the modules one of
+// them compiled are loaded from the cache by the next. Like the cache of
+// preload scripts, off-the-record sessions get none.
+base::FilePath GetCodeCacheDir(api::Session* session) {
+  ElectronBrowserContext* browser_context =
+      session ? session->browser_context()
+              : ElectronBrowserContext::GetDefaultBrowserContext();
+  if (browser_context->IsOffTheRecord())
+    return {};
+  return browser_context->GetPath()
+      .AppendASCII("Code Cache")
+      .AppendASCII("electron-utility");
+}
+
+// The process launched for the next fork() with keepSpare to adopt. There is
+// at most one, as each spare holds a whole V8 and Node.js instance.
+cppgc::WeakPersistent<api::UtilityProcessWrapper>& GetSpare() {
+  static base::NoDestructor<cppgc::WeakPersistent<api::UtilityProcessWrapper>>
+      spare;
+  return *spare;
+}
+
+// The number of running processes forked with keepSpare. The spare is only
+// kept while there is one, as nothing else would adopt it.
+size_t& GetKeepSpareProcessCount() {
+  static size_t count = 0;
+  return count;
+}
+
 }  // namespace
 
 namespace api {
@@ -91,17 +124,16 @@ namespace api {
 const gin::WrapperInfo UtilityProcessWrapper::kWrapperInfo =
     electron::MakeWrapperInfo(electron::kElectronUtilityProcess);
 
-UtilityProcessWrapper::UtilityProcessWrapper(
-    node::mojom::NodeServiceParamsPtr params,
-    std::u16string display_name,
-    std::map<IOHandle, IOType> stdio,
-    base::EnvironmentMap env_map,
-    base::FilePath current_working_directory,
-    bool use_plugin_helper,
-    bool create_network_observer,
-    bool disclaim_responsibility,
-    Session* session)
-    : create_network_observer_(create_network_observer), session_(session) {
+UtilityProcessWrapper::LaunchOptions::LaunchOptions() = default;
+UtilityProcessWrapper::LaunchOptions::LaunchOptions(const LaunchOptions&) =
+    default;
+UtilityProcessWrapper::LaunchOptions&
+UtilityProcessWrapper::LaunchOptions::operator=(const LaunchOptions&) = default;
+UtilityProcessWrapper::LaunchOptions::~LaunchOptions() = default;
+
+UtilityProcessWrapper::UtilityProcessWrapper(LaunchOptions options)
+    : launch_options_(std::move(options)),
+      launch_time_(base::TimeTicks::Now()) {
   auto& allocation_handle =
       JavascriptEnvironment::GetIsolate()->GetCppHeap()->GetAllocationHandle();
 #if BUILDFLAG(IS_WIN)
@@ -110,7 +142,7 @@ UtilityProcessWrapper::UtilityProcessWrapper(
 #elif BUILDFLAG(IS_POSIX)
   base::FileHandleMappingVector fds_to_remap;
 #endif
-  for (const auto& [io_handle, io_type] : stdio) {
+  for (const auto& [io_handle, io_type] : launch_options_.stdio) {
     if (io_handle == IOHandle::STDIN)
       continue;
 
@@ -197,15 +229,15 @@ UtilityProcessWrapper::UtilityProcessWrapper(
   content::ServiceProcessHost::Launch(
       std::move(receiver),
       content::ServiceProcessHost::Options()
-          .WithDisplayName(display_name.empty()
+          .WithDisplayName(launch_options_.display_name.empty()
                                ? std::u16string(u"Node Utility Process")
-                               : display_name)
-          .WithExtraCommandLineSwitches(params->exec_args)
-          .WithCurrentDirectory(current_working_directory)
+                               : launch_options_.display_name)
+          .WithExtraCommandLineSwitches(launch_options_.exec_args)
+          .WithCurrentDirectory(launch_options_.current_working_directory)
           // Inherit parent process environment when there is no custom
           // environment provided by the user.
-          .WithEnvironment(env_map,
-                           env_map.empty() ? false : true /*clear_environment*/)
+          .WithEnvironment(launch_options_.env_map,
+                           !launch_options_.env_map.empty() /*clear_env*/)
 #if BUILDFLAG(IS_WIN)
           .WithStdoutHandle(std::move(stdout_write))
           .WithStderrHandle(std::move(stderr_write))
@@ -214,11 +246,11 @@ UtilityProcessWrapper::UtilityProcessWrapper(
           .WithAdditionalFds(std::move(fds_to_remap))
 #endif
 #if BUILDFLAG(IS_MAC)
-          .WithChildFlags(use_plugin_helper
+          .WithChildFlags(launch_options_.use_plugin_helper
                               ? static_cast<int>(ElectronChildProcessHostFlags::
                                                      kChildProcessHelperPlugin)
                               : content::ChildProcessHost::CHILD_NORMAL)
-          .WithDisclaimResponsibility(disclaim_responsibility)
+          .WithDisclaimResponsibility(launch_options_.disclaim_responsibility)
 #endif
           .WithProcessCallback(
               base::BindOnce(&UtilityProcessWrapper::OnServiceProcessLaunch,
@@ -230,6 +262,69 @@ UtilityProcessWrapper::UtilityProcessWrapper(
       &UtilityProcessWrapper::OnServiceProcessDisconnected,
       gin::WrapPersistent(weak_factory_.GetWeakCell(allocation_handle))));
 
+  node_service_remote_->Prepare();
+}
+
+UtilityProcessWrapper::~UtilityProcessWrapper() {
+  content::ServiceProcessHost::RemoveObserver(this);
+}
+
+// static
+UtilityProcessWrapper* UtilityProcessWrapper::TakeSpare(
+    const LaunchOptions& options) {
+  UtilityProcessWrapper* spare = GetSpare().Get();
+  GetSpare().Clear();
+  if (!spare || spare->terminated_)
+    return nullptr;
+  if (spare->launch_options_ != options ||
+      !spare->node_service_remote_.is_connected()) {
+    spare->Shutdown(0 /* exit_code */);
+    return nullptr;
+  }
+  return spare;
+}
+
+// static
+void UtilityProcessWrapper::LaunchSpare(const LaunchOptions& options) {
+  UtilityProcessWrapper* spare = GetSpare().Get();
+  if (spare && !spare->terminated_ && spare->launch_options_ == options)
+    return;
+  if (spare)
+    spare->Shutdown(0 /* exit_code */);
+  GetSpare() = cppgc::MakeGarbageCollected<UtilityProcessWrapper>(
+      JavascriptEnvironment::GetIsolate()->GetCppHeap()->GetAllocationHandle(),
+      options);
+}
+
+// static
+void UtilityProcessWrapper::ReleaseSpare() {
+  UtilityProcessWrapper* spare = GetSpare().Get();
+  GetSpare().Clear();
+  if (spare)
+    spare->Shutdown(0 /* exit_code */);
+}
+
+void UtilityProcessWrapper::Start(node::mojom::NodeServiceParamsPtr params,
+                                  bool create_network_observer,
+                                  bool keep_spare,
+                                  Session* session) {
+  DCHECK(!started_);
+  auto& allocation_handle =
+      JavascriptEnvironment::GetIsolate()->GetCppHeap()->GetAllocationHandle();
+  started_ = true;
+  start_time_ = base::TimeTicks::Now();
+  create_network_observer_ = create_network_observer;
+  session_ = session;
+  // The launch failed before getting anywhere.
+  if (!node_service_remote_.is_bound())
+    return;
+  keep_spare_ = keep_spare;
+  if (keep_spare_)
+    ++GetKeepSpareProcessCount();
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("electron", "UtilityProcess::Start",
+                                    TRACE_ID_LOCAL(this), "fromSpare",
+                                    from_spare_);
+
   // We use a separate message pipe to support postMessage API
   // instead of the existing receiver interface so that we can
   // support queuing of messages without having to block other
@@ -246,6 +341,7 @@ UtilityProcessWrapper::UtilityProcessWrapper(
       &UtilityProcessWrapper::CloseConnectorPort,
       gin::WrapPersistent(weak_factory_.GetWeakCell(allocation_handle))));
 
+  params->exec_args = launch_options_.exec_args;
   params->url_loader_factory_params = CreateURLLoaderFactoryParams();
   node_service_remote_->Initialize(std::move(params),
                                    receiver_.BindNewPipeAndPassRemote());
@@ -255,17 +351,34 @@ UtilityProcessWrapper::UtilityProcessWrapper(
       content::RegisterNetworkServiceProcessGoneHandler(base::BindRepeating(
           &UtilityProcessWrapper::CreateAndSendURLLoaderFactory,
           gin::WrapPersistent(weak_factory_.GetWeakCell(allocation_handle))));
-}
 
-UtilityProcessWrapper::~UtilityProcessWrapper() {
-  content::ServiceProcessHost::RemoveObserver(this);
+  // A spare that has already launched announces it once the caller of fork()
+  // had a chance to listen.
+  if (pid_ != base::kNullProcessId) {
+    base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&UtilityProcessWrapper::DidLaunch,
+                       gin::WrapPersistent(
+                           weak_factory_.GetWeakCell(allocation_handle))));
+  }
 }
 
 void UtilityProcessWrapper::OnServiceProcessLaunch(
     const base::Process& process) {
+  // A spare can be replaced or released before its launch completes.
+  if (terminated_)
+    return;
   DCHECK(node_service_remote_.is_connected());
   pid_ = process.Pid();
+  launched_time_ = base::TimeTicks::Now();
   GetAllUtilityProcessWrappers().Add(pid_, this);
+  if (started_)
+    DidLaunch();
+}
+
+void UtilityProcessWrapper::DidLaunch() {
+  if (terminated_)
+    return;
   if (stdout_read_fd_ != -1)
     EmitWithoutEvent("stdout", stdout_read_fd_);
   if (stderr_read_fd_ != -1)
@@ -288,6 +401,15 @@ void UtilityProcessWrapper::HandleTermination(uint32_t exit_code) {
 
   pid_ = base::kNullProcessId;
   content::ServiceProcessHost::RemoveObserver(this);
+  if (!started_) {
+    // Nothing listens to a spare.
+    if (GetSpare().Get() == this)
+      GetSpare().Clear();
+    keep_alive_.Clear();
+    return;
+  }
+  if (keep_spare_ && --GetKeepSpareProcessCount() == 0)
+    ReleaseSpare();
   CloseConnectorPort();
   if (killed_) {
 #if BUILDFLAG(IS_POSIX)
@@ -337,7 +459,7 @@ void UtilityProcessWrapper::OnServiceProcessCrashed(
 }
 
 void UtilityProcessWrapper::CloseConnectorPort() {
-  if (!connector_closed_ && connector_->is_valid()) {
+  if (!connector_closed_ && connector_ && connector_->is_valid()) {
     host_port_.GiveDisentangledHandle(connector_->PassMessagePipe());
     connector_ = nullptr;
     host_port_.Reset();
@@ -359,37 +481,22 @@ void UtilityProcessWrapper::PostMessage(gin::Arguments* const args) {
 
   // |message| is any value that can be serialized to StructuredClone.
   v8::Local<v8::Value> message_value;
-  if (args->GetNext(&message_value)) {
-    if (!electron::SerializeV8Value(isolate, message_value,
-                                    &transferable_message)) {
-      // SerializeV8Value sets an exception.
-      return;
-    }
-  }
+  args->GetNext(&message_value);
 
   v8::Local<v8::Value> transferables;
   std::vector<gin_helper::Handle<MessagePort>> wrapped_ports;
-  if (args->GetNext(&transferables)) {
-    std::vector<v8::Local<v8::Value>> wrapped_port_values;
-    if (!gin::ConvertFromV8(isolate, transferables, &wrapped_port_values)) {
-      args->ThrowTypeError("transferables must be an array of MessagePorts");
-      return;
-    }
-
-    for (size_t i = 0; i < wrapped_port_values.size(); ++i) {
-      if (!gin_helper::IsValidWrappable(wrapped_port_values[i],
-                                        &MessagePort::kWrapperInfo)) {
-        args->ThrowTypeError(
-            base::StrCat({"Port at index ", base::NumberToString(i),
-                          " is not a valid port"}));
-        return;
-      }
-    }
+  std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+  if (args->GetNext(&transferables) &&
+      !MessagePort::GetTransferables(isolate, transferables, &wrapped_ports,
+                                     &array_buffers)) {
+    return;
+  }
 
-    if (!gin::ConvertFromV8(isolate, transferables, &wrapped_ports)) {
-      args->ThrowTypeError("Passed an invalid MessagePort");
-      return;
-    }
+  if (!message_value.IsEmpty() &&
+      !electron::SerializeV8Value(isolate, message_value, array_buffers,
+                                  &transferable_message)) {
+    // SerializeV8Value sets an exception.
+    return;
   }
 
   bool threw_exception = false;
@@ -427,6 +534,75 @@ v8::Local<v8::Value> UtilityProcessWrapper::GetOSProcessId(
   return gin::ConvertToV8(isolate, pid_);
 }
 
+v8::Local<v8::Value> UtilityProcessWrapper::GetLaunchTiming(
+    v8::Isolate* isolate) const {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("fromSpare", from_spare_);
+  if (!launched_time_.is_null()) {
+    dict.Set("launchDuration",
+             (launched_time_ - launch_time_).InMillisecondsF());
+  }
+  if (!ready_time_.is_null())
+    dict.Set("readyDuration", (ready_time_ - start_time_).InMillisecondsF());
+  return dict.GetHandle();
+}
+
+v8::Local<v8::Promise> UtilityProcessWrapper::StartCpuProfiler(
+    gin::Arguments* args) {
+  gin_helper::Promise<bool> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  CpuProfilerOptions options;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    if (auto error = ParseCpuProfilerOptions(dict, &options)) {
+      promise.RejectWithErrorMessage(*error);
+      return handle;
+    }
+  }
+  if (!started_ || !node_service_remote_.is_connected()) {
+    promise.RejectWithErrorMessage("The utility process is not running");
+    return handle;
+  }
+
+  // Resolves with false if the process goes away before it replies.
+  node_service_remote_->StartCpuProfiler(
+      options.sampling_interval, options.max_samples,
+      mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+          base::BindOnce(
+              [](gin_helper::Promise<bool> promise, bool started) {
+                promise.Resolve(started);
+              },
+              std::move(promise)),
+          false));
+  return handle;
+}
+
+v8::Local<v8::Promise> UtilityProcessWrapper::StopCpuProfiler(
+    v8::Isolate* isolate,
+    const base::FilePath& file_path) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!started_ || !node_service_remote_.is_connected()) {
+    promise.RejectWithErrorMessage("The utility process is not running");
+    return handle;
+  }
+
+  node_service_remote_->StopCpuProfiler(
+      file_path, mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+                     base::BindOnce(
+                         [](gin_helper::Promise<void> promise, bool success) {
+                           if (success) {
+                             promise.Resolve();
+                           } else {
+                             promise.RejectWithErrorMessage(
+                                 "Failed to write the CPU profile");
+                           }
+                         },
+                         std::move(promise)),
+                     false));
+  return handle;
+}
+
 bool UtilityProcessWrapper::Accept(mojo::Message* mojo_message) {
   blink::TransferableMessage message;
   if (!blink::mojom::TransferableMessage::DeserializeFromMessage(
@@ -447,6 +623,18 @@ void UtilityProcessWrapper::OnV8FatalError(const std::string& location,
   EmitWithoutEvent("error", "FatalError", location, report);
 }
 
+void UtilityProcessWrapper::OnReady() {
+  if (!ready_time_.is_null())
+    return;
+  ready_time_ = base::TimeTicks::Now();
+  TRACE_EVENT_NESTABLE_ASYNC_END0("electron", "UtilityProcess::Start",
+                                  TRACE_ID_LOCAL(this));
+  // Launching the next spare is held off until now so that it does not slow
+  // down the startup of this process.
+  if (keep_spare_ && !terminated_)
+    LaunchSpare(launch_options_);
+}
+
 void UtilityProcessWrapper::CreateAndSendURLLoaderFactory(bool /* crashed */) {
   if (!node_service_remote_.is_connected())
     return;
@@ -541,14 +729,11 @@ UtilityProcessWrapper* UtilityProcessWrapper::Create(
     return nullptr;
   }
 
-  std::u16string display_name;
-  bool use_plugin_helper = false;
+  LaunchOptions launch_options;
   bool create_network_observer = false;
-  bool disclaim_responsibility = false;
+  bool keep_spare = false;
+  bool code_cache = true;
   api::Session* session = nullptr;
-  std::map<IOHandle, IOType> stdio;
-  base::FilePath current_working_directory;
-  base::EnvironmentMap env_map;
   node::mojom::NodeServiceParamsPtr params =
       node::mojom::NodeServiceParams::New();
   dict.Get("modulePath", &params->script);
@@ -557,21 +742,37 @@ UtilityProcessWrapper* UtilityProcessWrapper::Create(
     return nullptr;
   }
 
+  // Set by utilityProcess pools, see lib/browser/api/utility-process.ts.
+  gin_helper::Handle<MessagePort> task_port;
+  if (dict.Get("taskPort", &task_port)) {
+    bool threw_exception = false;
+    std::vector<blink::MessagePortChannel> channels =
+        MessagePort::DisentanglePorts(args->isolate(), {task_port},
+                                      &threw_exception);
+    if (threw_exception)
+      return nullptr;
+    params->task_port =
+        node::mojom::TaskPort::New(channels.front().ReleaseHandle());
+  }
+
   gin_helper::Dictionary opts;
   if (dict.Get("options", &opts)) {
-    if (opts.Has("env") && !opts.Get("env", &env_map)) {
+    if (opts.Has("env") && !opts.Get("env", &launch_options.env_map)) {
       args->ThrowTypeError("Invalid value for env");
       return nullptr;
     }
 
-    if (opts.Has("execArgv") && !opts.Get("execArgv", &params->exec_args)) {
+    if (opts.Has("execArgv") &&
+        !opts.Get("execArgv", &launch_options.exec_args)) {
       args->ThrowTypeError("Invalid value for execArgv");
       return nullptr;
     }
 
-    opts.Get("serviceName", &display_name);
-    opts.Get("cwd", &current_working_directory);
+    opts.Get("serviceName", &launch_options.display_name);
+    opts.Get("cwd", &launch_options.current_working_directory);
     opts.Get("respondToAuthRequestsFromMainProcess", &create_network_observer);
+    opts.Get("keepSpare", &keep_spare);
+    opts.Get("codeCache", &code_cache);
 
     std::vector<std::string> stdio_arr{"ignore", "inherit", "inherit"};
     opts.Get("stdio", &stdio_arr);
@@ -584,12 +785,13 @@ UtilityProcessWrapper* UtilityProcessWrapper::Create(
       else if (stdio_arr[i] == "pipe")
         type = IOType::IO_PIPE;
 
-      stdio.emplace(static_cast<IOHandle>(i), type);
+      launch_options.stdio.emplace(static_cast<IOHandle>(i), type);
     }
 
 #if BUILDFLAG(IS_MAC)
-    opts.Get("allowLoadingUnsignedLibraries", &use_plugin_helper);
-    opts.Get("disclaim", &disclaim_responsibility);
+    opts.Get("allowLoadingUnsignedLibraries",
+             &launch_options.use_plugin_helper);
+    opts.Get("disclaim", &launch_options.disclaim_responsibility);
 #endif
 
     std::string partition;
@@ -598,12 +800,21 @@ UtilityProcessWrapper* UtilityProcessWrapper::Create(
       session = Session::FromPartition(args->isolate(), partition);
     }
   }
+  if (code_cache)
+    params->code_cache_dir = GetCodeCacheDir(session);
+
   v8::Isolate* isolate = args->isolate();
-  return cppgc::MakeGarbageCollected<UtilityProcessWrapper>(
-      isolate->GetCppHeap()->GetAllocationHandle(), std::move(params),
-      display_name, std::move(stdio), env_map, current_working_directory,
-      use_plugin_helper, create_network_observer, disclaim_responsibility,
-      session);
+  UtilityProcessWrapper* wrapper =
+      keep_spare ? TakeSpare(launch_options) : nullptr;
+  if (wrapper) {
+    wrapper->from_spare_ = true;
+  } else {
+    wrapper = cppgc::MakeGarbageCollected<UtilityProcessWrapper>(
+        isolate->GetCppHeap()->GetAllocationHandle(), launch_options);
+  }
+  wrapper->Start(std::move(params), create_network_observer, keep_spare,
+                 session);
+  return wrapper;
 }
 
 gin::ObjectTemplateBuilder UtilityProcessWrapper::GetObjectTemplateBuilder(
@@ -612,6 +823,9 @@ gin::ObjectTemplateBuilder UtilityProcessWrapper::GetObjectTemplateBuilder(
              UtilityProcessWrapper>::GetObjectTemplateBuilder(isolate)
       .SetMethod("postMessage", &UtilityProcessWrapper::PostMessage)
       .SetMethod("kill", &UtilityProcessWrapper::Kill)
+      .SetMethod("getLaunchTiming", &UtilityProcessWrapper::GetLaunchTiming)
+      .SetMethod("startCpuProfiler", &UtilityProcessWrapper::StartCpuProfiler)
+      .SetMethod("stopCpuProfiler", &UtilityProcessWrapper::StopCpuProfiler)
       .SetProperty("pid", &UtilityProcessWrapper::GetOSProcessId);
 }
 
@@ -8,10 +8,12 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/callback_list.h"
 #include "base/environment.h"
 #include "base/process/process_handle.h"
+#include "base/time/time.h"
 #include "content/public/browser/service_process_host.h"
 #include "electron/buildflags/buildflags.h"
 #include "gin/weak_cell.h"
@@ -56,15 +58,28 @@ class UtilityProcessWrapper final
   enum class IOHandle : size_t { STDIN = 0, STDOUT = 1, STDERR = 2 };
   enum class IOType { IO_PIPE, IO_INHERIT, IO_IGNORE };
 
-  UtilityProcessWrapper(node::mojom::NodeServiceParamsPtr params,
-                        std::u16string display_name,
-                        std::map<IOHandle, IOType> stdio,
-                        base::EnvironmentMap env_map,
-                        base::FilePath current_working_directory,
-                        bool use_plugin_helper,
-                        bool create_network_observer,
-                        bool disclaim_responsibility,
-                        Session* session);
+  // How the process is launched. A spare process is only adopted by a fork()
+  // that would have launched it with the same options.
+  struct LaunchOptions {
+    LaunchOptions();
+    LaunchOptions(const LaunchOptions&);
+    LaunchOptions& operator=(const LaunchOptions&);
+    ~LaunchOptions();
+
+    bool operator==(const LaunchOptions&) const = default;
+
+    std::u16string display_name;
+    std::map<IOHandle, IOType> stdio;
+    base::EnvironmentMap env_map;
+    base::FilePath current_working_directory;
+    std::vector<std::string> exec_args;
+    bool use_plugin_helper = false;
+    bool disclaim_responsibility = false;
+  };
+
+  // Launches the process and starts V8 and Node.js in it. The entry script is
+  // not run until Start() is called.
+  explicit UtilityProcessWrapper(LaunchOptions options);
   ~UtilityProcessWrapper() override;
 
   static UtilityProcessWrapper* Create(gin::Arguments* args);
@@ -94,7 +109,22 @@ class UtilityProcessWrapper final
       v8::Isolate* isolate) override;
 
  private:
+  // Returns the spare process if it was launched with |options|, and kills it
+  // otherwise.
+  static UtilityProcessWrapper* TakeSpare(const LaunchOptions& options);
+  static void LaunchSpare(const LaunchOptions& options);
+  // Kills the spare process, once no process forked with keepSpare is left.
+  static void ReleaseSpare();
+
+  // Runs the entry script of |params| in the process.
+  void Start(node::mojom::NodeServiceParamsPtr params,
+             bool create_network_observer,
+             bool keep_spare,
+             Session* session);
+
   void OnServiceProcessLaunch(const base::Process& process);
+  // Announces the launch of a process that has been started.
+  void DidLaunch();
   void CloseConnectorPort();
 
   void HandleTermination(uint32_t exit_code);
@@ -102,6 +132,10 @@ class UtilityProcessWrapper final
   void PostMessage(gin::Arguments* args);
   bool Kill();
   v8::Local<v8::Value> GetOSProcessId(v8::Isolate* isolate) const;
+  v8::Local<v8::Value> GetLaunchTiming(v8::Isolate* isolate) const;
+  v8::Local<v8::Promise> StartCpuProfiler(gin::Arguments* args);
+  v8::Local<v8::Promise> StopCpuProfiler(v8::Isolate* isolate,
+                                         const base::FilePath& file_path);
 
   // mojo::MessageReceiver
   bool Accept(mojo::Message* mojo_message) override;
@@ -109,6 +143,7 @@ class UtilityProcessWrapper final
   // node::mojom::NodeServiceClient
   void OnV8FatalError(const std::string& location,
                       const std::string& report) override;
+  void OnReady() override;
 
   // content::ServiceProcessHost::Observer
   void OnServiceProcessTerminatedNormally(
@@ -137,6 +172,16 @@ class UtilityProcessWrapper final
   bool terminated_ = false;
   bool killed_ = false;
   bool create_network_observer_ = false;
+  // Whether the entry script was given to the process. Until then it is a
+  // spare, and its launch is not announced.
+  bool started_ = false;
+  bool from_spare_ = false;
+  bool keep_spare_ = false;
+  const LaunchOptions launch_options_;
+  const base::TimeTicks launch_time_;
+  base::TimeTicks launched_time_;
+  base::TimeTicks start_time_;
+  base::TimeTicks ready_time_;
   std::unique_ptr<mojo::Connector> connector_;
   blink::MessagePortDescriptor host_port_;
   GC_PLUGIN_IGNORE(
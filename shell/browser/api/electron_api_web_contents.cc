@@ -12,6 +12,7 @@
 #include <string>
 #include <string_view>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "base/base64.h"
@@ -23,10 +24,12 @@
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
 #include "base/no_destructor.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/current_thread.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/threading/scoped_blocking_call.h"
 #include "base/unguessable_token.h"
 #include "base/values.h"
@@ -88,6 +91,7 @@
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/remote.h"
+#include "mojo/public/cpp/bindings/self_owned_receiver.h"
 #include "mojo/public/cpp/system/platform_handle.h"
 #include "printing/buildflags/buildflags.h"
 #include "services/network/public/cpp/web_sandbox_flags.h"
@@ -101,8 +105,10 @@
 #include "shell/browser/api/frame_subscriber.h"
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/api/save_page_handler.h"
+#include "shell/browser/api/warm_web_contents_pool.h"
 #include "shell/browser/browser.h"
 #include "shell/browser/child_web_contents_tracker.h"
+#include "shell/browser/console_message_recorder.h"
 #include "shell/browser/electron_autofill_driver_factory.h"
 #include "shell/browser/electron_browser_client.h"
 #include "shell/browser/electron_browser_context.h"
@@ -113,6 +119,7 @@
 #include "shell/browser/native_window.h"
 #include "shell/browser/osr/osr_render_widget_host_view.h"
 #include "shell/browser/osr/osr_web_contents_view.h"
+#include "shell/browser/page_capture_encoder.h"
 #include "shell/browser/preload_script.h"
 #include "shell/browser/renderer_startup_data.h"
 #include "shell/browser/session_preferences.h"
@@ -155,11 +162,14 @@
 #include "shell/common/node_includes.h"
 #include "shell/common/node_util.h"
 #include "shell/common/options_switches.h"
+#include "shell/common/sampling_heap_profiler.h"
 #include "shell/common/thread_restrictions.h"
 #include "shell/common/v8_util.h"
 #include "storage/browser/file_system/isolated_context.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/common/input/web_input_event.h"
+#include "third_party/blink/public/common/input/web_mouse_event.h"
+#include "third_party/blink/public/common/input/web_mouse_wheel_event.h"
 #include "third_party/blink/public/common/messaging/transferable_message_mojom_traits.h"
 #include "third_party/blink/public/common/page/page_zoom.h"
 #include "third_party/blink/public/common/peerconnection/webrtc_ip_handling_policy.h"
@@ -169,6 +179,7 @@
 #include "third_party/blink/public/mojom/frame/fullscreen.mojom.h"
 #include "third_party/blink/public/mojom/messaging/transferable_message.mojom.h"
 #include "third_party/blink/public/mojom/renderer_preferences.mojom.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/accessibility/platform/ax_platform.h"
 #include "ui/base/cursor/cursor.h"
 #include "ui/base/cursor/mojom/cursor_type.mojom-shared.h"
@@ -176,6 +187,7 @@
 #include "ui/display/screen.h"
 #include "ui/events/base_event_utils.h"
 #include "ui/views/widget/widget.h"
+#include "v8/include/cppgc/persistent.h"
 
 #if BUILDFLAG(IS_MAC)
 #include "ui/base/cocoa/defaults_utils.h"
@@ -363,6 +375,40 @@ struct Converter<electron::api::WebContents::Type> {
   }
 };
 
+template <>
+struct Converter<electron::WebContentsLifecycleController::State> {
+  static v8::Local<v8::Value> ToV8(
+      v8::Isolate* isolate,
+      electron::WebContentsLifecycleController::State val) {
+    using Val = electron::WebContentsLifecycleController::State;
+    static constexpr auto Lookup =
+        base::MakeFixedFlatMap<Val, std::string_view>({
+            {Val::kActive, "active"},
+            {Val::kHidden, "hidden"},
+            {Val::kFrozen, "frozen"},
+            {Val::kDiscarded, "discarded"},
+        });
+    return StringToV8(isolate, Lookup.at(val));
+  }
+};
+
+template <>
+struct Converter<electron::PageCaptureFormat> {
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     electron::PageCaptureFormat* out) {
+    using Val = electron::PageCaptureFormat;
+    static constexpr auto Lookup =
+        base::MakeFixedFlatMap<std::string_view, Val>({
+            {"bgra", Val::kBGRA},
+            {"jpeg", Val::kJPEG},
+            {"png", Val::kPNG},
+            {"webp", Val::kWebP},
+        });
+    return FromV8WithLookup(isolate, val, Lookup, out);
+  }
+};
+
 template <>
 struct Converter<scoped_refptr<content::DevToolsAgentHost>> {
   static v8::Local<v8::Value> ToV8(
@@ -642,6 +688,108 @@ void OnCapturePageDone(gin_helper::Promise<gfx::Image> promise,
   capture_handle.RunAndReset();
 }
 
+v8::Local<v8::Value> CreateCapturedPage(v8::Isolate* isolate,
+                                        v8::Local<v8::Value> data,
+                                        const gfx::Size& size) {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("data", data);
+  dict.Set("size", size);
+  return dict.GetHandle();
+}
+
+// A capturePage() call that asked for an encoding or for change detection.
+struct PendingPageCapture {
+  gin_helper::Promise<v8::Local<v8::Value>> promise;
+  base::ScopedClosureRunner capture_handle;
+  std::optional<PageCaptureFormat> format;
+  // The caller's buffer for raw pixels. It is only written on the UI thread,
+  // once the pixels have been read back on the thread pool.
+  v8::Global<v8::Value> output;
+  base::OnceCallback<void(size_t)> update_fingerprint;
+};
+
+void OnPageCaptureEncoded(PendingPageCapture pending,
+                          const SkBitmap& bitmap,
+                          PageCaptureEncodeResult result) {
+  if (pending.update_fingerprint)
+    std::move(pending.update_fingerprint).Run(result.fingerprint);
+
+  auto& promise = pending.promise;
+  v8::Isolate* const isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  if (!result.changed) {
+    promise.Resolve(v8::Null(isolate));
+    return;
+  }
+  if (!result.succeeded) {
+    promise.RejectWithErrorMessage("Failed to encode the captured page");
+    return;
+  }
+  if (!pending.format) {
+    promise.Resolve(gin::ConvertToV8(
+        isolate, gfx::Image::CreateFrom1xBitmap(bitmap)));
+    return;
+  }
+
+  v8::Local<v8::Value> data;
+  if (pending.output.IsEmpty()) {
+    data = electron::Buffer::Copy(isolate, result.data).ToLocalChecked();
+  } else {
+    data = pending.output.Get(isolate);
+    const base::span<uint8_t> output = electron::Buffer::as_byte_span(data);
+    if (output.size() < result.data.size()) {
+      promise.RejectWithErrorMessage(
+          "The buffer is too small for the captured page");
+      return;
+    }
+    output.first(result.data.size()).copy_from(result.data);
+  }
+  promise.Resolve(CreateCapturedPage(
+      isolate, data, gfx::Size(bitmap.width(), bitmap.height())));
+}
+
+void OnPageCaptureCopied(PendingPageCapture pending,
+                         PageCaptureEncodeRequest request,
+                         const content::CopyFromSurfaceResult& result) {
+  auto ui_task_runner = content::GetUIThreadTaskRunner({});
+  if (!ui_task_runner->RunsTasksInCurrentSequence()) {
+    ui_task_runner->PostTask(
+        FROM_HERE, base::BindOnce(&OnPageCaptureCopied, std::move(pending),
+                                  std::move(request), result));
+    return;
+  }
+
+  pending.capture_handle.RunAndReset();
+  if (!result.has_value()) {
+    pending.promise.RejectWithErrorMessage(
+        CopyFromSurfaceErrorToString(result.error()));
+    return;
+  }
+
+  const SkBitmap& bitmap = result->bitmap;
+  const size_t needed = static_cast<size_t>(bitmap.width()) * bitmap.height() *
+                        SkColorTypeBytesPerPixel(kBGRA_8888_SkColorType);
+  size_t available = needed;
+  if (!pending.output.IsEmpty()) {
+    v8::Isolate* const isolate = pending.promise.isolate();
+    v8::HandleScope handle_scope(isolate);
+    available =
+        electron::Buffer::as_byte_span(pending.output.Get(isolate)).size();
+  }
+  if (available < needed) {
+    pending.promise.RejectWithErrorMessage(
+        base::StrCat({"The buffer is too small for the captured page, ",
+                      base::NumberToString(needed), " bytes are needed"}));
+    return;
+  }
+
+  EncodePageCapture(
+      bitmap, std::move(request),
+      base::BindOnce(&OnPageCaptureEncoded, std::move(pending), bitmap));
+}
+
 std::optional<base::TimeDelta> GetCursorBlinkInterval() {
 #if BUILDFLAG(IS_MAC)
   std::optional<base::TimeDelta> system_value(
@@ -785,6 +933,56 @@ content::RenderFrameHost* GetRenderFrameHost(
 
   return frame_host;
 }
+
+// Re-emits the progress of a heap snapshot taken by the renderer as the
+// 'heap-snapshot-progress' event of the WebContents.
+class HeapSnapshotProgressObserver
+    : public mojom::HeapSnapshotProgressObserver {
+ public:
+  explicit HeapSnapshotProgressObserver(base::WeakPtr<WebContents> web_contents)
+      : web_contents_(std::move(web_contents)) {}
+
+  // mojom::HeapSnapshotProgressObserver
+  void OnBuildProgress(uint32_t done, uint32_t total) override {
+    Report("build", done, total);
+  }
+  void OnWriteProgress(uint64_t bytes_written) override {
+    Report("write", static_cast<double>(bytes_written), std::nullopt);
+  }
+
+ private:
+  void Report(std::string_view stage,
+              double done,
+              std::optional<double> total) {
+    if (!web_contents_)
+      return;
+    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+    v8::HandleScope handle_scope(isolate);
+    auto details = gin_helper::Dictionary::CreateEmpty(isolate);
+    details.Set("stage", stage);
+    details.Set("done", done);
+    if (total)
+      details.Set("total", *total);
+    web_contents_->Emit("heap-snapshot-progress", details);
+  }
+
+  base::WeakPtr<WebContents> web_contents_;
+};
+
+// Returns a one-off connection to the renderer of the main frame of
+// |web_contents|, or nullptr without a live main frame. The renderer keeps it
+// alongside the connection of the frame's WebFrameMain.
+std::unique_ptr<mojo::Remote<mojom::ElectronRenderer>> BindMainFrameRenderer(
+    content::WebContents* web_contents) {
+  auto* frame_host = web_contents->GetPrimaryMainFrame();
+  if (!frame_host || !frame_host->IsRenderFrameLive())
+    return nullptr;
+  auto electron_renderer =
+      std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
+  frame_host->GetRemoteInterfaces()->GetInterface(
+      electron_renderer->BindNewPipeAndPassReceiver());
+  return electron_renderer;
+}
 }  // namespace
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
@@ -927,6 +1125,9 @@ WebContents::WebContents(v8::Isolate* isolate,
   // Init embedder earlier
   options.Get("embedder", &embedder_);
 
+  // Created ahead of time by a WarmWebContentsPool.
+  options.Get("warmPooled", &warm_pooled_);
+
   // Whether to enable DevTools.
   options.Get("devTools", &enable_devtools_);
 
@@ -1129,6 +1330,7 @@ void WebContents::InitWithSessionAndOptions(
 #endif
 
   AutofillDriverFactory::CreateForWebContents(web_contents());
+  GetLifecycleController();
 
   SetUserAgent(GetBrowserContext()->GetUserAgent());
 
@@ -1313,6 +1515,15 @@ void WebContents::OnDidAddMessageToConsole(
     int32_t line_no,
     const std::u16string& source_id,
     const std::optional<std::u16string>& untrusted_stack_trace) {
+  if (console_message_recorder_) {
+    console_message_recorder_->Record(level, message, line_no, source_id);
+    if (!console_message_recorder_->options().emit_events)
+      return;
+  }
+
+  if (!ShouldEmit(TrackedEvent::kConsoleMessage))
+    return;
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
 
@@ -1642,7 +1853,8 @@ void WebContents::ActivateContents(content::WebContents* source) {
 
 void WebContents::UpdateTargetURL(content::WebContents* source,
                                   const GURL& url) {
-  Emit("update-target-url", url);
+  if (ShouldEmit(TrackedEvent::kUpdateTargetURL))
+    Emit("update-target-url", url);
 }
 
 bool WebContents::HandleKeyboardEvent(
@@ -1681,7 +1893,8 @@ bool WebContents::PlatformHandleKeyboardEvent(
 bool WebContents::PreHandleMouseEvent(content::WebContents* source,
                                       const blink::WebMouseEvent& event) {
   // |true| means that the event should be prevented.
-  return Emit("before-mouse-event", event);
+  return ShouldEmit(TrackedEvent::kBeforeMouseEvent) &&
+         Emit("before-mouse-event", event);
 }
 
 content::KeyboardEventProcessingResult WebContents::PreHandleKeyboardEvent(
@@ -1690,8 +1903,9 @@ content::KeyboardEventProcessingResult WebContents::PreHandleKeyboardEvent(
   if (exclusive_access_manager_.HandleUserKeyEvent(event))
     return content::KeyboardEventProcessingResult::HANDLED;
 
-  if (event.GetType() == blink::WebInputEvent::Type::kRawKeyDown ||
-      event.GetType() == blink::WebInputEvent::Type::kKeyUp) {
+  if ((event.GetType() == blink::WebInputEvent::Type::kRawKeyDown ||
+       event.GetType() == blink::WebInputEvent::Type::kKeyUp) &&
+      ShouldEmit(TrackedEvent::kBeforeInputEvent)) {
     // For backwards compatibility, pretend that `kRawKeyDown` events are
     // actually `kKeyDown`.
     input::NativeWebKeyboardEvent tweaked_event(event);
@@ -3230,6 +3444,13 @@ std::string WebContents::GetOrCreateDevToolsTargetId() {
   return agent_host->GetId();
 }
 
+void WebContents::AdoptFromWarmPool() {
+  if (!warm_pooled_)
+    return;
+  warm_pooled_ = false;
+  EmitWithoutEvent("-warm-pool-adopted");
+}
+
 bool WebContents::IsCrashed() const {
   return web_contents()->IsCrashed();
 }
@@ -3914,6 +4135,50 @@ bool WebContents::IsFocused() const {
 }
 #endif
 
+void WebContents::DispatchMouseEvent(const blink::WebMouseEvent& event) {
+  if (IsOffScreen()) {
+    GetOffScreenRenderWidgetHostView()->SendMouseEvent(event);
+  } else {
+    web_contents()
+        ->GetRenderWidgetHostView()
+        ->GetRenderWidgetHost()
+        ->ForwardMouseEvent(event);
+  }
+}
+
+void WebContents::DispatchMouseWheelEvent(blink::WebMouseWheelEvent event) {
+  if (IsOffScreen()) {
+    GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(event);
+    return;
+  }
+
+  content::RenderWidgetHost* rwh =
+      web_contents()->GetRenderWidgetHostView()->GetRenderWidgetHost();
+  // Chromium expects phase info in wheel events (and applies a
+  // DCHECK to verify it). See: https://crbug.com/756524.
+  event.phase = blink::WebMouseWheelEvent::kPhaseBegan;
+  event.dispatch_type = blink::WebInputEvent::DispatchType::kBlocking;
+  rwh->ForwardWheelEvent(event);
+
+  // Send a synthetic wheel event with phaseEnded to finish scrolling.
+  event.has_synthetic_phase = true;
+  event.delta_x = 0;
+  event.delta_y = 0;
+  event.phase = blink::WebMouseWheelEvent::kPhaseEnded;
+  event.dispatch_type = blink::WebInputEvent::DispatchType::kEventNonBlocking;
+  rwh->ForwardWheelEvent(event);
+}
+
+void WebContents::DispatchKeyboardEvent(input::NativeWebKeyboardEvent event) {
+  // For backwards compatibility, convert `kKeyDown` to `kRawKeyDown`.
+  if (event.GetType() == blink::WebKeyboardEvent::Type::kKeyDown)
+    event.SetType(blink::WebKeyboardEvent::Type::kRawKeyDown);
+  web_contents()
+      ->GetRenderWidgetHostView()
+      ->GetRenderWidgetHost()
+      ->ForwardKeyboardEvent(event);
+}
+
 void WebContents::SendInputEvent(v8::Isolate* isolate,
                                  v8::Local<v8::Value> input_event) {
   content::RenderWidgetHostView* view =
@@ -3921,17 +4186,12 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
   if (!view)
     return;
 
-  content::RenderWidgetHost* rwh = view->GetRenderWidgetHost();
   blink::WebInputEvent::Type type =
       gin::GetWebInputEventType(isolate, input_event);
   if (blink::WebInputEvent::IsMouseEventType(type)) {
     blink::WebMouseEvent mouse_event;
     if (gin::ConvertFromV8(isolate, input_event, &mouse_event)) {
-      if (IsOffScreen()) {
-        GetOffScreenRenderWidgetHostView()->SendMouseEvent(mouse_event);
-      } else {
-        rwh->ForwardMouseEvent(mouse_event);
-      }
+      DispatchMouseEvent(mouse_event);
       return;
     }
   } else if (blink::WebInputEvent::IsKeyboardEventType(type)) {
@@ -3939,35 +4199,13 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
         blink::WebKeyboardEvent::Type::kRawKeyDown,
         blink::WebInputEvent::Modifiers::kNoModifiers, ui::EventTimeForNow());
     if (gin::ConvertFromV8(isolate, input_event, &keyboard_event)) {
-      // For backwards compatibility, convert `kKeyDown` to `kRawKeyDown`.
-      if (keyboard_event.GetType() == blink::WebKeyboardEvent::Type::kKeyDown)
-        keyboard_event.SetType(blink::WebKeyboardEvent::Type::kRawKeyDown);
-      rwh->ForwardKeyboardEvent(keyboard_event);
+      DispatchKeyboardEvent(std::move(keyboard_event));
       return;
     }
   } else if (type == blink::WebInputEvent::Type::kMouseWheel) {
     blink::WebMouseWheelEvent mouse_wheel_event;
     if (gin::ConvertFromV8(isolate, input_event, &mouse_wheel_event)) {
-      if (IsOffScreen()) {
-        GetOffScreenRenderWidgetHostView()->SendMouseWheelEvent(
-            mouse_wheel_event);
-      } else {
-        // Chromium expects phase info in wheel events (and applies a
-        // DCHECK to verify it). See: https://crbug.com/756524.
-        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseBegan;
-        mouse_wheel_event.dispatch_type =
-            blink::WebInputEvent::DispatchType::kBlocking;
-        rwh->ForwardWheelEvent(mouse_wheel_event);
-
-        // Send a synthetic wheel event with phaseEnded to finish scrolling.
-        mouse_wheel_event.has_synthetic_phase = true;
-        mouse_wheel_event.delta_x = 0;
-        mouse_wheel_event.delta_y = 0;
-        mouse_wheel_event.phase = blink::WebMouseWheelEvent::kPhaseEnded;
-        mouse_wheel_event.dispatch_type =
-            blink::WebInputEvent::DispatchType::kEventNonBlocking;
-        rwh->ForwardWheelEvent(mouse_wheel_event);
-      }
+      DispatchMouseWheelEvent(std::move(mouse_wheel_event));
       return;
     }
   }
@@ -3976,6 +4214,267 @@ void WebContents::SendInputEvent(v8::Isolate* isolate,
       v8::Exception::Error(gin::StringToV8(isolate, "Invalid event object")));
 }
 
+namespace {
+
+using DecodedInputEvent = std::variant<blink::WebMouseEvent,
+                                       blink::WebMouseWheelEvent,
+                                       input::NativeWebKeyboardEvent>;
+
+// sendInputEvents() dispatches at most this many events per task so that a
+// long recording replayed as fast as possible does not starve the UI thread.
+constexpr size_t kMaxInputEventsPerTask = 500;
+
+// Layout of one event in the packed Float64Array form of sendInputEvents().
+constexpr size_t kPackedInputEventStride = 8;
+enum PackedInputEventField {
+  kPackedTimestamp = 0,
+  kPackedType,
+  kPackedX,
+  kPackedY,
+  kPackedModifiers,
+  kPackedButtonOrDeltaX,
+  kPackedClickCountOrDeltaY,
+};
+
+constexpr auto kPackedInputEventTypes =
+    std::to_array<blink::WebInputEvent::Type>({
+        blink::WebInputEvent::Type::kMouseDown,
+        blink::WebInputEvent::Type::kMouseUp,
+        blink::WebInputEvent::Type::kMouseMove,
+        blink::WebInputEvent::Type::kMouseEnter,
+        blink::WebInputEvent::Type::kMouseLeave,
+        blink::WebInputEvent::Type::kMouseWheel,
+    });
+
+// Only the keyboard modifiers are accepted in packed form.
+constexpr int kPackedModifierMask =
+    blink::WebInputEvent::Modifiers::kShiftKey |
+    blink::WebInputEvent::Modifiers::kControlKey |
+    blink::WebInputEvent::Modifiers::kAltKey |
+    blink::WebInputEvent::Modifiers::kMetaKey;
+
+std::optional<DecodedInputEvent> DecodePackedInputEvent(
+    base::span<const double> record) {
+  const double type_index = record[kPackedType];
+  if (!(type_index >= 0 && type_index < kPackedInputEventTypes.size()))
+    return std::nullopt;
+  const auto type = kPackedInputEventTypes[static_cast<size_t>(type_index)];
+  const int modifiers =
+      static_cast<int>(record[kPackedModifiers]) & kPackedModifierMask;
+  const auto x = static_cast<float>(record[kPackedX]);
+  const auto y = static_cast<float>(record[kPackedY]);
+
+  if (type == blink::WebInputEvent::Type::kMouseWheel) {
+    blink::WebMouseWheelEvent event(type, modifiers, base::TimeTicks::Now());
+    event.SetPositionInWidget(x, y);
+    event.delta_x = static_cast<float>(record[kPackedButtonOrDeltaX]);
+    event.delta_y = static_cast<float>(record[kPackedClickCountOrDeltaY]);
+    event.delta_units = ui::ScrollGranularity::kScrollByPixel;
+    return event;
+  }
+
+  blink::WebMouseEvent event(type, modifiers, base::TimeTicks::Now());
+  event.SetPositionInWidget(x, y);
+  switch (static_cast<int>(record[kPackedButtonOrDeltaX])) {
+    case 1:
+      event.button = blink::WebMouseEvent::Button::kMiddle;
+      break;
+    case 2:
+      event.button = blink::WebMouseEvent::Button::kRight;
+      break;
+    default:
+      event.button = blink::WebMouseEvent::Button::kLeft;
+      break;
+  }
+  event.click_count = static_cast<int>(record[kPackedClickCountOrDeltaY]);
+  return event;
+}
+
+std::optional<DecodedInputEvent> DecodeInputEvent(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> input_event) {
+  blink::WebInputEvent::Type type =
+      gin::GetWebInputEventType(isolate, input_event);
+  if (blink::WebInputEvent::IsMouseEventType(type)) {
+    blink::WebMouseEvent mouse_event;
+    if (gin::ConvertFromV8(isolate, input_event, &mouse_event))
+      return mouse_event;
+  } else if (blink::WebInputEvent::IsKeyboardEventType(type)) {
+    input::NativeWebKeyboardEvent keyboard_event(
+        blink::WebKeyboardEvent::Type::kRawKeyDown,
+        blink::WebInputEvent::Modifiers::kNoModifiers, ui::EventTimeForNow());
+    if (gin::ConvertFromV8(isolate, input_event, &keyboard_event))
+      return keyboard_event;
+  } else if (type == blink::WebInputEvent::Type::kMouseWheel) {
+    blink::WebMouseWheelEvent mouse_wheel_event;
+    if (gin::ConvertFromV8(isolate, input_event, &mouse_wheel_event))
+      return mouse_wheel_event;
+  }
+  return std::nullopt;
+}
+
+}  // namespace
+
+struct WebContents::InputEventReplay {
+  InputEventReplay(v8::Isolate* isolate, bool original_timing)
+      : original_timing(original_timing), promise(isolate) {}
+
+  // Each event with its offset from the first event of the sequence.
+  std::vector<std::pair<base::TimeDelta, DecodedInputEvent>> events;
+  size_t next = 0;
+  bool original_timing;
+  base::TimeTicks start;
+  gin_helper::Promise<gin_helper::Dictionary> promise;
+};
+
+v8::Local<v8::Promise> WebContents::SendInputEvents(gin::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+
+  v8::Local<v8::Value> events;
+  if (!args->GetNext(&events) ||
+      !(events->IsArray() || events->IsFloat64Array())) {
+    args->ThrowTypeError("events must be an Array or a Float64Array");
+    return {};
+  }
+  bool original_timing = false;
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    std::string timing;
+    if (options.Get("timing", &timing)) {
+      if (timing != "original" && timing != "immediate") {
+        args->ThrowTypeError("timing must be 'original' or 'immediate'");
+        return {};
+      }
+      original_timing = timing == "original";
+    }
+  }
+
+  auto replay = std::make_unique<InputEventReplay>(isolate, original_timing);
+  v8::Local<v8::Promise> handle = replay->promise.GetHandle();
+
+  // Decode everything up front so that a malformed event is reported before
+  // any of the sequence has been dispatched.
+  std::optional<double> first_timestamp;
+  auto offset_for = [&first_timestamp](double timestamp) {
+    if (!first_timestamp)
+      first_timestamp = timestamp;
+    return base::Milliseconds(std::max(0.0, timestamp - *first_timestamp));
+  };
+  if (events->IsFloat64Array()) {
+    auto packed = events.As<v8::Float64Array>();
+    if (packed->Length() % kPackedInputEventStride != 0) {
+      args->ThrowTypeError("Packed events must have 8 values per event");
+      return {};
+    }
+    std::vector<double> values(packed->Length());
+    packed->CopyContents(values.data(), values.size() * sizeof(double));
+    replay->events.reserve(values.size() / kPackedInputEventStride);
+    for (size_t i = 0; i < values.size(); i += kPackedInputEventStride) {
+      auto record = base::span(values).subspan(i, kPackedInputEventStride);
+      auto event = DecodePackedInputEvent(record);
+      if (!event) {
+        args->ThrowTypeError("Invalid event at index " +
+                             base::NumberToString(i / kPackedInputEventStride));
+        return {};
+      }
+      replay->events.emplace_back(offset_for(record[kPackedTimestamp]),
+                                  std::move(*event));
+    }
+  } else {
+    auto list = events.As<v8::Array>();
+    v8::Local<v8::Context> context = isolate->GetCurrentContext();
+    replay->events.reserve(list->Length());
+    for (uint32_t i = 0; i < list->Length(); ++i) {
+      v8::Local<v8::Value> value;
+      std::optional<DecodedInputEvent> event;
+      if (list->Get(context, i).ToLocal(&value))
+        event = DecodeInputEvent(isolate, value);
+      if (!event) {
+        args->ThrowTypeError("Invalid event at index " +
+                             base::NumberToString(i));
+        return {};
+      }
+      double timestamp = 0;
+      gin_helper::Dictionary dict;
+      if (gin::ConvertFromV8(isolate, value, &dict))
+        dict.Get("timestamp", &timestamp);
+      replay->events.emplace_back(offset_for(timestamp), std::move(*event));
+    }
+  }
+
+  replay->start = base::TimeTicks::Now();
+  ContinueInputEventReplay(std::move(replay));
+  return handle;
+}
+
+void WebContents::ContinueInputEventReplay(
+    std::unique_ptr<InputEventReplay> replay) {
+  const auto finish = [&replay](const char* error) {
+    if (error) {
+      replay->promise.RejectWithErrorMessage(error);
+      return;
+    }
+    v8::Isolate* isolate = replay->promise.isolate();
+    v8::HandleScope handle_scope(isolate);
+    auto result = gin_helper::Dictionary::CreateEmpty(isolate);
+    result.Set("dispatched", static_cast<double>(replay->next));
+    result.Set("duration",
+               (base::TimeTicks::Now() - replay->start).InMillisecondsF());
+    replay->promise.Resolve(result);
+  };
+
+  if (!web_contents()->GetRenderWidgetHostView()) {
+    finish("The page has no view to send input events to");
+    return;
+  }
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  for (size_t budget = kMaxInputEventsPerTask;
+       budget > 0 && replay->next < replay->events.size(); --budget) {
+    auto& [offset, event] = replay->events[replay->next];
+    if (replay->original_timing && replay->start + offset > now)
+      break;
+    std::visit(
+        [this, now](auto& e) {
+          e.SetTimeStamp(now);
+          using T = std::decay_t<decltype(e)>;
+          if constexpr (std::is_same_v<T, blink::WebMouseEvent>)
+            DispatchMouseEvent(e);
+          else if constexpr (std::is_same_v<T, blink::WebMouseWheelEvent>)
+            DispatchMouseWheelEvent(std::move(e));
+          else
+            DispatchKeyboardEvent(std::move(e));
+        },
+        event);
+    ++replay->next;
+  }
+
+  if (replay->next == replay->events.size()) {
+    finish(nullptr);
+    return;
+  }
+
+  base::TimeDelta delay;
+  if (replay->original_timing) {
+    delay = std::max(base::TimeDelta(),
+                     replay->start + replay->events[replay->next].first - now);
+  }
+  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](base::WeakPtr<WebContents> self,
+             std::unique_ptr<InputEventReplay> replay) {
+            if (self) {
+              self->ContinueInputEventReplay(std::move(replay));
+            } else {
+              replay->promise.RejectWithErrorMessage(
+                  "WebContents was destroyed");
+            }
+          },
+          GetWeakPtr(), std::move(replay)),
+      delay);
+}
+
 void WebContents::BeginFrameSubscription(gin::Arguments* args) {
   bool only_dirty = false;
   FrameSubscriber::FrameCaptureCallback callback;
@@ -4039,17 +4538,59 @@ v8::Local<v8::Promise> WebContents::CapturePage(gin::Arguments* args) {
 
   bool stay_hidden = false;
   bool stay_awake = false;
+  std::optional<float> scale_factor;
+  std::optional<PageCaptureFormat> format;
+  int quality = 90;
+  bool only_if_changed = false;
+  v8::Local<v8::Value> output;
   if (args && args->Length() == 2) {
     gin_helper::Dictionary options;
     if (args->GetNext(&options)) {
       options.Get("stayHidden", &stay_hidden);
       options.Get("stayAwake", &stay_awake);
+      options.GetOptional("scaleFactor", &scale_factor);
+      options.Get("quality", &quality);
+      options.Get("onlyIfChanged", &only_if_changed);
+      options.Get("buffer", &output);
+
+      v8::Local<v8::Value> format_value;
+      if (options.Get("format", &format_value) &&
+          !format_value->IsUndefined() &&
+          !gin::ConvertFromV8(args->isolate(), format_value, &format)) {
+        promise.RejectWithErrorMessage(
+            "format must be one of 'png', 'jpeg', 'webp' or 'bgra'");
+        return handle;
+      }
     }
   }
 
+  if (scale_factor && (*scale_factor <= 0 || *scale_factor > 4)) {
+    promise.RejectWithErrorMessage("scaleFactor must be in the range (0, 4]");
+    return handle;
+  }
+  if (quality < 0 || quality > 100) {
+    promise.RejectWithErrorMessage("quality must be in the range [0, 100]");
+    return handle;
+  }
+  const bool has_output = !output.IsEmpty() && !output->IsUndefined();
+  if (has_output && (format != PageCaptureFormat::kBGRA ||
+                     !node::Buffer::HasInstance(output))) {
+    promise.RejectWithErrorMessage(
+        "buffer must be a Buffer and can only be used with the 'bgra' format");
+    return handle;
+  }
+
   auto* const view = web_contents()->GetRenderWidgetHostView();
   if (!view || view->GetViewBounds().size().IsEmpty()) {
-    promise.Resolve(gfx::Image());
+    if (format) {
+      v8::Isolate* const isolate = args->isolate();
+      promise.As<v8::Local<v8::Value>>().Resolve(CreateCapturedPage(
+          isolate, electron::Buffer::Copy(isolate, base::span<const uint8_t>())
+                       .ToLocalChecked(),
+          gfx::Size()));
+    } else {
+      promise.Resolve(gfx::Image());
+    }
     return handle;
   }
 
@@ -4074,8 +4615,59 @@ v8::Local<v8::Promise> WebContents::CapturePage(gin::Arguments* args) {
   const float scale = display::Screen::Get()
                           ->GetDisplayNearestView(native_view)
                           .device_scale_factor();
-  if (scale > 1.0f)
+  if (scale_factor) {
+    // Scaling happens during the readback, which is cheaper than resizing
+    // the full size bitmap afterwards.
+    bitmap_size = gfx::ScaleToCeiledSize(view_size, *scale_factor);
+  } else if (scale > 1.0f) {
     bitmap_size = gfx::ScaleToCeiledSize(view_size, scale);
+  }
+
+  if (format || only_if_changed) {
+    PageCaptureEncodeRequest request;
+    request.format = format;
+    request.quality = quality;
+    PendingPageCapture pending{
+        .promise = promise.As<v8::Local<v8::Value>>(),
+        .capture_handle = std::move(capture_handle),
+        .format = format,
+    };
+    if (only_if_changed) {
+      // Captures of different regions, scales or formats are compared with
+      // the previous capture of the same kind only, so that several pollers
+      // do not invalidate each other.
+      std::string key =
+          base::StrCat({rect.ToString(), " ", bitmap_size.ToString(), " ",
+                        base::NumberToString(format ? static_cast<int>(*format)
+                                                    : -1)});
+      request.fingerprint = true;
+      if (const size_t* fingerprint =
+              base::FindOrNull(capture_fingerprints_, key)) {
+        request.previous_fingerprint = *fingerprint;
+      }
+      pending.update_fingerprint = base::BindOnce(
+          [](base::WeakPtr<WebContents> self, std::string key,
+             size_t fingerprint) {
+            if (!self)
+              return;
+            // Forget stale kinds rather than growing without bound.
+            if (self->capture_fingerprints_.size() >= kMaxCaptureFingerprints &&
+                !self->capture_fingerprints_.contains(key)) {
+              self->capture_fingerprints_.clear();
+            }
+            self->capture_fingerprints_[std::move(key)] = fingerprint;
+          },
+          GetWeakPtr(), std::move(key));
+    }
+    if (has_output)
+      pending.output.Reset(args->isolate(), output);
+
+    view->CopyFromSurface(
+        gfx::Rect(rect.origin(), view_size), bitmap_size, base::TimeDelta(),
+        base::BindOnce(&OnPageCaptureCopied, std::move(pending),
+                       std::move(request)));
+    return handle;
+  }
 
   view->CopyFromSurface(gfx::Rect(rect.origin(), view_size), bitmap_size,
                         base::TimeDelta(),
@@ -4089,6 +4681,9 @@ bool WebContents::IsBeingCaptured() {
 }
 
 void WebContents::OnCursorChanged(const ui::Cursor& cursor) {
+  if (!ShouldEmit(TrackedEvent::kCursorChanged))
+    return;
+
   if (cursor.type() == ui::mojom::CursorType::kCustom) {
     Emit("cursor-changed", CursorTypeToString(cursor.type()),
          gfx::Image::CreateFrom1xBitmap(cursor.custom_bitmap()),
@@ -4393,7 +4988,141 @@ void WebContents::PDFReadyToPrint() {
 void WebContents::OnInputEvent(const content::RenderWidgetHost& rfh,
                                const blink::WebInputEvent& event,
                                input::InputEventSource source) {
-  Emit("input-event", event);
+  if (ShouldEmit(TrackedEvent::kInputEvent))
+    Emit("input-event", event);
+}
+
+namespace {
+
+// Maps JS event names to the TrackedEvent guarding their emission. The
+// internal '-console-message' event is only re-emitted as 'console-message',
+// so it is guarded by listeners of the latter.
+constexpr auto kTrackedEventNames =
+    base::MakeFixedFlatMap<std::string_view, WebContents::TrackedEvent>({
+        {"input-event", WebContents::TrackedEvent::kInputEvent},
+        {"before-input-event", WebContents::TrackedEvent::kBeforeInputEvent},
+        {"before-mouse-event", WebContents::TrackedEvent::kBeforeMouseEvent},
+        {"cursor-changed", WebContents::TrackedEvent::kCursorChanged},
+        {"update-target-url", WebContents::TrackedEvent::kUpdateTargetURL},
+        {"console-message", WebContents::TrackedEvent::kConsoleMessage},
+    });
+static_assert(kTrackedEventNames.size() == WebContents::kTrackedEventCount);
+
+}  // namespace
+
+void WebContents::SetEventListened(const std::string& name, bool listened) {
+  const auto* event = base::FindOrNull(kTrackedEventNames, name);
+  if (!event)
+    return;
+  const uint32_t bit = 1u << static_cast<size_t>(*event);
+  if (listened)
+    listened_events_ |= bit;
+  else
+    listened_events_ &= ~bit;
+}
+
+bool WebContents::ShouldEmit(TrackedEvent event) {
+  const auto index = static_cast<size_t>(event);
+  if (listened_events_ & (1u << index)) {
+    ++delivered_emits_[index];
+    return true;
+  }
+  ++skipped_emits_[index];
+  return false;
+}
+
+v8::Local<v8::Value> WebContents::GetEventEmissionStats(
+    v8::Isolate* isolate) const {
+  std::vector<gin_helper::Dictionary> stats;
+  for (const auto& [name, event] : kTrackedEventNames) {
+    const auto index = static_cast<size_t>(event);
+    auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+    dict.Set("event", name);
+    dict.Set("delivered", static_cast<double>(delivered_emits_[index]));
+    dict.Set("skipped", static_cast<double>(skipped_emits_[index]));
+    stats.push_back(std::move(dict));
+  }
+  return gin::ConvertToV8(isolate, stats);
+}
+
+void WebContents::SetConsoleMessageLogging(gin::Arguments* args) {
+  v8::Isolate* isolate = args->isolate();
+  v8::Local<v8::Value> value;
+  if (!args->GetNext(&value) || value->IsNullOrUndefined()) {
+    console_message_recorder_.reset();
+    return;
+  }
+
+  gin_helper::Dictionary dict;
+  if (!gin::ConvertFromV8(isolate, value, &dict)) {
+    args->ThrowTypeError("Expected an options object or null");
+    return;
+  }
+
+  ConsoleMessageRecorder::Options options;
+  if (dict.Get("path", &options.path) && !options.path.IsAbsolute()) {
+    args->ThrowTypeError("'path' must be absolute");
+    return;
+  }
+  double max_file_size = 0;
+  if (dict.Get("maxFileSize", &max_file_size)) {
+    if (max_file_size < 1) {
+      args->ThrowTypeError("'maxFileSize' must be a positive number");
+      return;
+    }
+    options.max_file_size = static_cast<uint64_t>(max_file_size);
+  }
+  int32_t max_entries = 0;
+  if (dict.Get("maxEntries", &max_entries)) {
+    if (max_entries < 0) {
+      args->ThrowTypeError("'maxEntries' must not be negative");
+      return;
+    }
+    options.max_entries = static_cast<size_t>(max_entries);
+  }
+  if (dict.Has("level") && !dict.Get("level", &options.min_level)) {
+    args->ThrowTypeError(
+        "'level' must be one of 'debug', 'info', 'warning' or 'error'");
+    return;
+  }
+  dict.Get("emitEvents", &options.emit_events);
+
+  // Replacing the recorder flushes whatever the previous one had buffered.
+  console_message_recorder_ =
+      std::make_unique<ConsoleMessageRecorder>(options);
+}
+
+v8::Local<v8::Value> WebContents::GetConsoleMessages(
+    v8::Isolate* isolate) const {
+  std::vector<gin_helper::Dictionary> messages;
+  if (console_message_recorder_) {
+    for (const auto& entry : console_message_recorder_->entries()) {
+      auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+      dict.Set("level", entry.level);
+      dict.Set("message", entry.message);
+      dict.Set("lineNumber", entry.line_number);
+      dict.Set("sourceId", entry.source_id);
+      dict.Set("timestamp", entry.time.InMillisecondsFSinceUnixEpoch());
+      messages.push_back(std::move(dict));
+    }
+  }
+  return gin::ConvertToV8(isolate, messages);
+}
+
+v8::Local<v8::Promise> WebContents::FlushConsoleMessageLog(
+    v8::Isolate* isolate) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!console_message_recorder_) {
+    promise.Resolve();
+    return handle;
+  }
+
+  console_message_recorder_->Flush(base::BindOnce(
+      [](gin_helper::Promise<void> promise) { promise.Resolve(); },
+      std::move(promise)));
+  return handle;
 }
 
 void WebContents::RunJavaScriptDialog(content::WebContents* web_contents,
@@ -4461,6 +5190,113 @@ v8::Local<v8::Promise> WebContents::GetProcessMemoryInfo(v8::Isolate* isolate) {
   return handle;
 }
 
+WebContentsLifecycleController* WebContents::GetLifecycleController() {
+  if (!lifecycle_controller_) {
+    lifecycle_controller_ = std::make_unique<WebContentsLifecycleController>(
+        web_contents(),
+        base::BindRepeating(&WebContents::OnLifecycleStateChanged,
+                            base::Unretained(this)));
+  }
+  return lifecycle_controller_.get();
+}
+
+void WebContents::SetLifecyclePolicy(const gin_helper::Dictionary& options) {
+  WebContentsLifecycleController::Policy policy;
+  double freeze_delay_ms = 0;
+  if (options.Get("freezeDelay", &freeze_delay_ms))
+    policy.freeze_delay = base::Milliseconds(std::max(freeze_delay_ms, 0.0));
+  options.Get("discardable", &policy.discardable);
+  GetLifecycleController()->SetPolicy(policy);
+}
+
+WebContentsLifecycleController::State WebContents::GetLifecycleState() {
+  return GetLifecycleController()->state();
+}
+
+bool WebContents::Freeze() {
+  return GetLifecycleController()->Freeze();
+}
+
+bool WebContents::Unfreeze() {
+  return GetLifecycleController()->Unfreeze();
+}
+
+bool WebContents::Discard() {
+  return GetLifecycleController()->Discard();
+}
+
+void WebContents::OnLifecycleStateChanged(
+    WebContentsLifecycleController::State state,
+    WebContentsLifecycleController::State old) {
+  Emit("lifecycle-state-changed", state, old);
+}
+
+namespace {
+
+void ResolveMemoryEstimate(
+    gin_helper::Promise<gin_helper::Dictionary> promise,
+    uint64_t private_footprint_kb,
+    size_t shared_with) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("privateFootprint", static_cast<double>(private_footprint_kb));
+  dict.Set("sharedWith", static_cast<uint32_t>(shared_with));
+  dict.Set("estimate",
+           static_cast<double>(private_footprint_kb / (shared_with + 1)));
+  promise.Resolve(dict);
+}
+
+void OnMemoryEstimateDump(
+    gin_helper::Promise<gin_helper::Dictionary> promise,
+    base::ProcessId pid,
+    size_t shared_with,
+    memory_instrumentation::mojom::RequestOutcome outcome,
+    std::unique_ptr<memory_instrumentation::GlobalMemoryDump> global_dump) {
+  if (outcome == memory_instrumentation::mojom::RequestOutcome::kSuccess) {
+    for (const auto& dump : global_dump->process_dumps()) {
+      if (dump.pid() == pid) {
+        ResolveMemoryEstimate(std::move(promise),
+                              dump.os_dump().private_footprint_kb,
+                              shared_with);
+        return;
+      }
+    }
+  }
+  promise.RejectWithErrorMessage("Failed to create memory dump");
+}
+
+}  // namespace
+
+v8::Local<v8::Promise> WebContents::GetMemoryEstimate(v8::Isolate* isolate) {
+  gin_helper::Promise<gin_helper::Dictionary> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // A discarded page has no renderer left to account for.
+  auto* controller = GetLifecycleController();
+  auto* frame_host = web_contents()->GetPrimaryMainFrame();
+  if (controller->state() ==
+          WebContentsLifecycleController::State::kDiscarded ||
+      !frame_host || !frame_host->IsRenderFrameLive()) {
+    ResolveMemoryEstimate(std::move(promise), 0, 0);
+    return handle;
+  }
+
+  // Pages sharing a renderer process split its footprint evenly.
+  auto* process = frame_host->GetProcess();
+  const size_t shared_with =
+      controller->CountPagesInProcess(process->GetDeprecatedID());
+  const base::ProcessId pid = process->GetProcess().Pid();
+  memory_instrumentation::MemoryInstrumentation::GetInstance()
+      ->RequestGlobalDumpForPid(
+          pid, std::vector<std::string>(),
+          base::BindOnce(&OnMemoryEstimateDump, std::move(promise), pid,
+                         shared_with));
+  return handle;
+}
+
 v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
     v8::Isolate* isolate,
     const base::FilePath& file_path) {
@@ -4503,9 +5339,15 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
       std::make_unique<mojo::Remote<mojom::ElectronRenderer>>();
   frame_host->GetRemoteInterfaces()->GetInterface(
       electron_renderer->BindNewPipeAndPassReceiver());
+  mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer;
+  mojo::MakeSelfOwnedReceiver(
+      std::make_unique<HeapSnapshotProgressObserver>(GetWeakPtr()),
+      observer.InitWithNewPipeAndPassReceiver());
+
   auto* raw_ptr = electron_renderer.get();
   (*raw_ptr)->TakeHeapSnapshot(
       mojo::WrapPlatformFile(base::ScopedPlatformFile(file.TakePlatformFile())),
+      std::move(observer),
       base::BindOnce(
           [](mojo::Remote<mojom::ElectronRenderer>* ep,
              gin_helper::Promise<void> promise, bool success) {
@@ -4519,6 +5361,75 @@ v8::Local<v8::Promise> WebContents::TakeHeapSnapshot(
   return handle;
 }
 
+v8::Local<v8::Promise> WebContents::StartSamplingHeapProfiler(
+    gin::Arguments* args) {
+  gin_helper::Promise<void> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  SamplingHeapProfilerOptions options;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    if (auto error = ParseSamplingHeapProfilerOptions(dict, &options)) {
+      promise.RejectWithErrorMessage(*error);
+      return handle;
+    }
+  }
+
+  auto electron_renderer = BindMainFrameRenderer(web_contents());
+  if (!electron_renderer) {
+    promise.RejectWithErrorMessage(
+        "Failed to start sampling heap profiler with nonexistent render frame");
+    return handle;
+  }
+
+  auto* raw_ptr = electron_renderer.get();
+  (*raw_ptr)->StartSamplingHeapProfiler(
+      mojom::SamplingHeapProfilerOptions::New(
+          options.sampling_interval, options.stack_depth,
+          options.include_objects_collected_by_major_gc,
+          options.include_objects_collected_by_minor_gc),
+      base::BindOnce(
+          [](mojo::Remote<mojom::ElectronRenderer>* ep,
+             gin_helper::Promise<void> promise, bool success) {
+            if (success) {
+              promise.Resolve();
+            } else {
+              promise.RejectWithErrorMessage(
+                  "The sampling heap profiler is already running");
+            }
+          },
+          base::Owned(std::move(electron_renderer)), std::move(promise)));
+  return handle;
+}
+
+v8::Local<v8::Promise> WebContents::StopSamplingHeapProfiler(
+    v8::Isolate* isolate) {
+  gin_helper::Promise<base::Value> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  auto electron_renderer = BindMainFrameRenderer(web_contents());
+  if (!electron_renderer) {
+    promise.RejectWithErrorMessage(
+        "Failed to stop sampling heap profiler with nonexistent render frame");
+    return handle;
+  }
+
+  auto* raw_ptr = electron_renderer.get();
+  (*raw_ptr)->StopSamplingHeapProfiler(base::BindOnce(
+      [](mojo::Remote<mojom::ElectronRenderer>* ep,
+         gin_helper::Promise<base::Value> promise,
+         std::optional<base::DictValue> profile) {
+        if (profile) {
+          promise.Resolve(base::Value(std::move(*profile)));
+        } else {
+          promise.RejectWithErrorMessage(
+              "The sampling heap profiler is not running");
+        }
+      },
+      base::Owned(std::move(electron_renderer)), std::move(promise)));
+  return handle;
+}
+
 void WebContents::UpdatePreferredSize(content::WebContents* web_contents,
                                       const gfx::Size& pref_size) {
   Emit("preferred-size-changed", pref_size);
@@ -4740,7 +5651,7 @@ void WebContents::DevToolsIndexPath(
     }
   }
 
-  indexing_job = devtools_file_system_indexer_->IndexPath(
+  indexing_job = browser_context_->GetDevToolsFileSystemIndex()->IndexPath(
       file_system_path, excluded_folders,
       base::BindRepeating(&WebContents::OnDevToolsIndexingWorkCalculated,
                           weak_factory_.GetWeakPtr(), request_id,
@@ -4748,9 +5659,9 @@ void WebContents::DevToolsIndexPath(
       base::BindRepeating(&WebContents::OnDevToolsIndexingWorked,
                           weak_factory_.GetWeakPtr(), request_id,
                           file_system_path),
-      base::BindRepeating(&WebContents::OnDevToolsIndexingDone,
-                          weak_factory_.GetWeakPtr(), request_id,
-                          file_system_path));
+      base::BindOnce(&WebContents::OnDevToolsIndexingDone,
+                     weak_factory_.GetWeakPtr(), request_id,
+                     file_system_path));
 }
 
 void WebContents::DevToolsStopIndexing(int request_id) {
@@ -4777,11 +5688,11 @@ void WebContents::DevToolsSearchInPath(int request_id,
                               std::vector<std::string>());
     return;
   }
-  devtools_file_system_indexer_->SearchInPath(
+  browser_context_->GetDevToolsFileSystemIndex()->SearchInPath(
       file_system_path, query,
-      base::BindRepeating(&WebContents::OnDevToolsSearchCompleted,
-                          weak_factory_.GetWeakPtr(), request_id,
-                          file_system_path));
+      base::BindOnce(&WebContents::OnDevToolsSearchCompleted,
+                     weak_factory_.GetWeakPtr(), request_id,
+                     file_system_path));
 }
 
 void WebContents::DevToolsSetEyeDropperActive(bool active) {
@@ -5018,6 +5929,7 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("focus", &WebContents::Focus)
       .SetMethod("isFocused", &WebContents::IsFocused)
       .SetMethod("sendInputEvent", &WebContents::SendInputEvent)
+      .SetMethod("sendInputEvents", &WebContents::SendInputEvents)
       .SetMethod("beginFrameSubscription", &WebContents::BeginFrameSubscription)
       .SetMethod("endFrameSubscription", &WebContents::EndFrameSubscription)
       .SetMethod("startDrag", &WebContents::StartDrag)
@@ -5060,6 +5972,14 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
       .SetMethod("setEmbedder", &WebContents::SetEmbedder)
       .SetMethod("setDevToolsWebContents", &WebContents::SetDevToolsWebContents)
       .SetMethod("isBeingCaptured", &WebContents::IsBeingCaptured)
+      .SetMethod("_setEventListened", &WebContents::SetEventListened)
+      .SetMethod("_isWarmPooled", &WebContents::IsWarmPooled)
+      .SetMethod("getEventEmissionStats", &WebContents::GetEventEmissionStats)
+      .SetMethod("setConsoleMessageLogging",
+                 &WebContents::SetConsoleMessageLogging)
+      .SetMethod("getConsoleMessages", &WebContents::GetConsoleMessages)
+      .SetMethod("flushConsoleMessageLog",
+                 &WebContents::FlushConsoleMessageLog)
       .SetMethod("setWebRTCIPHandlingPolicy",
                  &WebContents::SetWebRTCIPHandlingPolicy)
       .SetMethod("setWebRTCUDPPortRange", &WebContents::SetWebRTCUDPPortRange)
@@ -5070,9 +5990,19 @@ void WebContents::FillObjectTemplate(v8::Isolate* isolate,
                  &WebContents::GetWebRTCIPHandlingPolicy)
       .SetMethod("getWebRTCUDPPortRange", &WebContents::GetWebRTCUDPPortRange)
       .SetMethod("takeHeapSnapshot", &WebContents::TakeHeapSnapshot)
+      .SetMethod("startSamplingHeapProfiler",
+                 &WebContents::StartSamplingHeapProfiler)
+      .SetMethod("stopSamplingHeapProfiler",
+                 &WebContents::StopSamplingHeapProfiler)
       .SetMethod("setImageAnimationPolicy",
                  &WebContents::SetImageAnimationPolicy)
       .SetMethod("_getProcessMemoryInfo", &WebContents::GetProcessMemoryInfo)
+      .SetMethod("setLifecyclePolicy", &WebContents::SetLifecyclePolicy)
+      .SetMethod("getLifecycleState", &WebContents::GetLifecycleState)
+      .SetMethod("freeze", &WebContents::Freeze)
+      .SetMethod("unfreeze", &WebContents::Unfreeze)
+      .SetMethod("discard", &WebContents::Discard)
+      .SetMethod("getMemoryEstimate", &WebContents::GetMemoryEstimate)
       .SetProperty("id", &WebContents::ID)
       .SetProperty("session", &WebContents::Session)
       .SetProperty("hostWebContents", &WebContents::HostWebContents)
@@ -5158,8 +6088,18 @@ gin_helper::Handle<WebContents> WebContents::CreateFromWebPreferences(
     const gin_helper::Dictionary& web_preferences) {
   // Check if webPreferences has |webContents| option.
   gin_helper::Handle<WebContents> web_contents;
-  if (web_preferences.GetHidden("webContents", &web_contents) &&
-      !web_contents.IsEmpty()) {
+  WarmWebContentsPool* warm_pool = nullptr;
+  const base::TimeTicks start_time = base::TimeTicks::Now();
+  if (!web_preferences.GetHidden("webContents", &web_contents) ||
+      web_contents.IsEmpty()) {
+    // Otherwise adopt a warm one from the session's pool, if it has one with
+    // matching preferences.
+    warm_pool = GetWarmWebContentsPool(isolate, web_preferences);
+    if (warm_pool)
+      web_contents = warm_pool->Take(isolate, web_preferences);
+  }
+
+  if (!web_contents.IsEmpty()) {
     // Set webPreferences from options if using an existing webContents.
     // These preferences will be used when the webContent launches new
     // render processes.
@@ -5200,6 +6140,8 @@ gin_helper::Handle<WebContents> WebContents::CreateFromWebPreferences(
         }
       }
     }
+    if (warm_pool)
+      warm_pool->RecordAdoption(base::TimeTicks::Now() - start_time);
   } else {
     // Create one if not.
     web_contents = WebContents::New(isolate, web_preferences);
@@ -5208,6 +6150,28 @@ gin_helper::Handle<WebContents> WebContents::CreateFromWebPreferences(
   return web_contents;
 }
 
+// static
+WarmWebContentsPool* WebContents::GetWarmWebContentsPool(
+    v8::Isolate* isolate,
+    const gin_helper::Dictionary& web_preferences) {
+  // Mirrors the session lookup in the constructor.
+  api::Session* session = nullptr;
+  if (!web_preferences.Get("session", &session) || !session) {
+    std::string partition;
+    if (web_preferences.Get("partition", &partition)) {
+      session = Session::FromPartition(isolate, partition);
+    } else {
+      // Most windows use the default session, so it is only looked up once.
+      static base::NoDestructor<cppgc::WeakPersistent<Session>>
+          default_session;
+      if (!default_session->Get())
+        *default_session = Session::FromPartition(isolate, "");
+      session = default_session->Get();
+    }
+  }
+  return session ? session->warm_web_contents_pool() : nullptr;
+}
+
 // static
 WebContents* WebContents::FromID(int32_t id) {
   return GetAllWebContents().Lookup(id);
@@ -5271,11 +6235,40 @@ std::vector<gin_helper::Handle<WebContents>> GetAllWebContentsAsV8(
   std::vector<gin_helper::Handle<WebContents>> list;
   for (auto iter = base::IDMap<WebContents*>::iterator(&GetAllWebContents());
        !iter.IsAtEnd(); iter.Advance()) {
-    list.push_back(gin_helper::CreateHandle(isolate, iter.GetCurrentValue()));
+    WebContents* web_contents = iter.GetCurrentValue();
+    if (!web_contents->IsWarmPooled())
+      list.push_back(gin_helper::CreateHandle(isolate, web_contents));
   }
   return list;
 }
 
+void SetMemoryPressurePolicy(gin::Arguments* args) {
+  v8::Local<v8::Value> value;
+  if (!args->GetNext(&value) || value->IsNullOrUndefined()) {
+    electron::WebContentsLifecycleController::SetMemoryPressurePolicy(
+        std::nullopt);
+    return;
+  }
+
+  gin_helper::Dictionary options;
+  double threshold_mb = 0;
+  if (!gin::ConvertFromV8(args->isolate(), value, &options) ||
+      !options.Get("availableMemoryThreshold", &threshold_mb) ||
+      threshold_mb <= 0) {
+    args->ThrowTypeError(
+        "'availableMemoryThreshold' must be a positive number");
+    return;
+  }
+
+  electron::WebContentsLifecycleController::MemoryPressurePolicy policy;
+  policy.available_memory_threshold =
+      base::saturated_cast<uint64_t>(threshold_mb * 1024 * 1024);
+  double interval_ms = 0;
+  if (options.Get("checkInterval", &interval_ms))
+    policy.check_interval = base::Milliseconds(std::max(interval_ms, 100.0));
+  electron::WebContentsLifecycleController::SetMemoryPressurePolicy(policy);
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -5287,6 +6280,7 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("fromFrame", &WebContentsFromFrame);
   dict.SetMethod("fromDevToolsTargetId", &WebContentsFromDevToolsTargetID);
   dict.SetMethod("getAllWebContents", &GetAllWebContentsAsV8);
+  dict.SetMethod("setMemoryPressurePolicy", &SetMemoryPressurePolicy);
 }
 
 }  // namespace
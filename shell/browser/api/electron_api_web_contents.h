@@ -5,12 +5,14 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_WEB_CONTENTS_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_WEB_CONTENTS_H_
 
+#include <array>
 #include <map>
 #include <memory>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/functional/callback_forward.h"
 #include "base/memory/raw_ptr.h"
@@ -18,7 +20,6 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/task/thread_pool.h"
-#include "chrome/browser/devtools/devtools_file_system_indexer.h"
 #include "chrome/browser/ui/exclusive_access/exclusive_access_context.h"  // nogncheck
 #include "chrome/browser/ui/exclusive_access/exclusive_access_manager.h"
 #include "content/common/frame.mojom-forward.h"
@@ -37,8 +38,10 @@
 #include "shell/browser/extended_web_contents_observer.h"
 #include "shell/browser/osr/osr_paint_event.h"
 #include "shell/browser/preload_script.h"
+#include "shell/browser/ui/devtools_file_system_index.h"
 #include "shell/browser/ui/inspectable_web_contents_delegate.h"
 #include "shell/browser/ui/inspectable_web_contents_view_delegate.h"
+#include "shell/browser/web_contents_lifecycle_controller.h"
 #include "shell/common/gin_helper/cleaned_up_at_exit.h"
 #include "shell/common/gin_helper/constructible.h"
 #include "shell/common/gin_helper/pinnable.h"
@@ -60,6 +63,8 @@ class ScriptExecutor;
 
 namespace blink {
 struct DeviceEmulationParams;
+class WebMouseEvent;
+class WebMouseWheelEvent;
 // enum class PermissionType;
 }  // namespace blink
 
@@ -103,6 +108,7 @@ class DevToolsEyeDropper;
 
 namespace electron {
 
+class ConsoleMessageRecorder;
 class DevToolsContextMenu;
 class ElectronBrowserContext;
 class InspectableWebContents;
@@ -118,6 +124,7 @@ class BaseWindow;
 class Debugger;
 class FrameSubscriber;
 class Session;
+class WarmWebContentsPool;
 
 // Wrapper around the content::WebContents.
 class WebContents final : public ExclusiveAccessContext,
@@ -239,6 +246,10 @@ class WebContents final : public ExclusiveAccessContext,
   std::string GetMediaSourceID(content::WebContents* request_web_contents);
   std::string GetOrCreateDevToolsTargetId();
   bool IsCrashed() const;
+  // Pooled WebContents are hidden from getAllWebContents() and are announced
+  // with 'web-contents-created' only once they are adopted.
+  bool IsWarmPooled() const { return warm_pooled_; }
+  void AdoptFromWarmPool();
   void ForcefullyCrashRenderer();
   void SetUserAgent(const std::string& user_agent);
   std::string GetUserAgent();
@@ -266,6 +277,31 @@ class WebContents final : public ExclusiveAccessContext,
   void SetEmbedder(const WebContents* embedder);
   void SetDevToolsWebContents(const WebContents* devtools);
   bool IsBeingCaptured();
+
+  // Events that fire often enough (per mouse move, per console line) that
+  // building their arguments with nobody listening is measurable.
+  enum class TrackedEvent : uint8_t {
+    kInputEvent,
+    kBeforeInputEvent,
+    kBeforeMouseEvent,
+    kCursorChanged,
+    kUpdateTargetURL,
+    kConsoleMessage,
+    kMaxValue = kConsoleMessage,
+  };
+  static constexpr size_t kTrackedEventCount =
+      static_cast<size_t>(TrackedEvent::kMaxValue) + 1;
+
+  // Called from JS when the first listener for |name| is added or the last
+  // one removed, so that high-frequency events can be skipped natively.
+  void SetEventListened(const std::string& name, bool listened);
+  v8::Local<v8::Value> GetEventEmissionStats(v8::Isolate* isolate) const;
+
+  // Native console message capture.
+  void SetConsoleMessageLogging(gin::Arguments* args);
+  v8::Local<v8::Value> GetConsoleMessages(v8::Isolate* isolate) const;
+  v8::Local<v8::Promise> FlushConsoleMessageLog(v8::Isolate* isolate);
+
   void HandleNewRenderFrame(content::RenderFrameHost* render_frame_host);
 
 #if BUILDFLAG(ENABLE_PRINTING)
@@ -321,6 +357,8 @@ class WebContents final : public ExclusiveAccessContext,
 
   // Send WebInputEvent to the page.
   void SendInputEvent(v8::Isolate* isolate, v8::Local<v8::Value> input_event);
+  // Decodes a whole sequence of input events in one call and replays them.
+  v8::Local<v8::Promise> SendInputEvents(gin::Arguments* args);
 
   // Subscribe to the frame updates.
   void BeginFrameSubscription(gin::Arguments* args);
@@ -388,8 +426,19 @@ class WebContents final : public ExclusiveAccessContext,
 
   v8::Local<v8::Promise> TakeHeapSnapshot(v8::Isolate* isolate,
                                           const base::FilePath& file_path);
+  v8::Local<v8::Promise> StartSamplingHeapProfiler(gin::Arguments* args);
+  v8::Local<v8::Promise> StopSamplingHeapProfiler(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetProcessMemoryInfo(v8::Isolate* isolate);
 
+  // Page lifecycle (freezing and discarding of hidden pages).
+  WebContentsLifecycleController* GetLifecycleController();
+  void SetLifecyclePolicy(const gin_helper::Dictionary& policy);
+  WebContentsLifecycleController::State GetLifecycleState();
+  bool Freeze();
+  bool Unfreeze();
+  bool Discard();
+  v8::Local<v8::Promise> GetMemoryEstimate(v8::Isolate* isolate);
+
   // content::WebContentsDelegate:
   bool HandleContextMenu(content::RenderFrameHost& render_frame_host,
                          const content::ContextMenuParams& params) override;
@@ -814,6 +863,8 @@ class WebContents final : public ExclusiveAccessContext,
 
   std::unique_ptr<WebViewGuestDelegate> guest_delegate_;
   std::unique_ptr<FrameSubscriber> frame_subscriber_;
+  std::unique_ptr<ConsoleMessageRecorder> console_message_recorder_;
+  std::unique_ptr<WebContentsLifecycleController> lifecycle_controller_;
 
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
   std::unique_ptr<extensions::ScriptExecutor> script_executor_;
@@ -822,6 +873,9 @@ class WebContents final : public ExclusiveAccessContext,
   // The host webcontents that may contain this webcontents.
   RAW_PTR_EXCLUSION WebContents* embedder_ = nullptr;
 
+  // Whether this is waiting in a WarmWebContentsPool to be adopted.
+  bool warm_pooled_ = false;
+
   // Whether the guest view has been attached.
   bool attached_ = false;
 
@@ -872,9 +926,6 @@ class WebContents final : public ExclusiveAccessContext,
   // Whether window is fullscreened by window api.
   bool native_fullscreen_ = false;
 
-  const scoped_refptr<DevToolsFileSystemIndexer> devtools_file_system_indexer_ =
-      base::MakeRefCounted<DevToolsFileSystemIndexer>();
-
   ExclusiveAccessManager exclusive_access_manager_{this};
 
   std::unique_ptr<DevToolsEyeDropper> eye_dropper_;
@@ -898,9 +949,8 @@ class WebContents final : public ExclusiveAccessContext,
   PathsMap saved_files_;
 
   // Map id to index job, used for file system indexing requests from devtools.
-  typedef std::
-      map<int, scoped_refptr<DevToolsFileSystemIndexer::FileSystemIndexingJob>>
-          DevToolsIndexingJobsMap;
+  typedef std::map<int, scoped_refptr<DevToolsFileSystemIndex::IndexingJob>>
+      DevToolsIndexingJobsMap;
   DevToolsIndexingJobsMap devtools_indexing_jobs_;
 
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_ =
@@ -924,6 +974,37 @@ class WebContents final : public ExclusiveAccessContext,
 
   std::optional<SkRegion> draggable_region_;
 
+  // Fingerprints of the last capturePage() results for `onlyIfChanged`, by
+  // region, output size and format.
+  static constexpr size_t kMaxCaptureFingerprints = 32;
+  base::flat_map<std::string, size_t> capture_fingerprints_;
+
+  // Returns the warm pool of the session |web_preferences| resolve to.
+  static WarmWebContentsPool* GetWarmWebContentsPool(
+      v8::Isolate* isolate,
+      const gin_helper::Dictionary& web_preferences);
+
+  void OnLifecycleStateChanged(WebContentsLifecycleController::State state,
+                               WebContentsLifecycleController::State old);
+
+  // Returns whether |event| has JS listeners, and counts the emission as
+  // delivered or skipped accordingly.
+  bool ShouldEmit(TrackedEvent event);
+
+  // Forward decoded input events to the widget (or the OSR view).
+  void DispatchMouseEvent(const blink::WebMouseEvent& event);
+  void DispatchMouseWheelEvent(blink::WebMouseWheelEvent event);
+  void DispatchKeyboardEvent(input::NativeWebKeyboardEvent event);
+
+  // State of a sendInputEvents() call; defined in the .cc file.
+  struct InputEventReplay;
+  void ContinueInputEventReplay(std::unique_ptr<InputEventReplay> replay);
+
+  // Bitmask of TrackedEvents that currently have listeners.
+  uint32_t listened_events_ = 0;
+  std::array<uint64_t, kTrackedEventCount> delivered_emits_ = {};
+  std::array<uint64_t, kTrackedEventCount> skipped_emits_ = {};
+
   base::WeakPtrFactory<WebContents> weak_factory_{this};
 };
 
@@ -12,6 +12,7 @@
 #include "base/feature_list.h"
 #include "base/logging.h"
 #include "base/no_destructor.h"
+#include "base/time/time.h"
 #include "content/browser/renderer_host/frame_tree_node.h"         // nogncheck
 #include "content/browser/renderer_host/render_frame_host_impl.h"  // nogncheck
 #include "content/browser/renderer_host/render_process_host_impl.h"  // nogncheck
@@ -20,6 +21,7 @@
 #include "content/public/common/isolated_world_ids.h"
 #include "gin/object_template_builder.h"
 #include "gin/persistent.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "printing/buildflags/buildflags.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "shell/browser/api/message_port.h"
@@ -134,6 +136,44 @@ FrameTokenMap& GetFrameTokenMap() {
   return *instance;
 }
 
+void OnJavaScriptBatchExecuted(
+    gin_helper::Promise<v8::Local<v8::Value>> promise,
+    size_t script_count,
+    base::TimeTicks start_time,
+    std::vector<mojom::JavaScriptBatchResultPtr> results) {
+  const base::TimeDelta round_trip_time = base::TimeTicks::Now() - start_time;
+  if (results.size() != script_count) {
+    promise.RejectWithErrorMessage(
+        "Render frame was disposed before the scripts could run");
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+
+  // Shaped like the entries of Promise.allSettled().
+  std::vector<v8::Local<v8::Value>> entries;
+  for (const auto& result : results) {
+    auto entry = gin_helper::Dictionary::CreateEmpty(isolate);
+    if (result->success) {
+      entry.Set("status", "fulfilled");
+      entry.Set("value", result->value);
+    } else {
+      const std::string* message = result->value.GetIfString();
+      entry.Set("status", "rejected");
+      entry.Set("reason", v8::Exception::Error(gin::StringToV8(
+                              isolate, message ? *message : "")));
+    }
+    entries.push_back(entry.GetHandle());
+  }
+
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("results", entries);
+  dict.Set("roundTripTime", round_trip_time.InMillisecondsF());
+  promise.Resolve(dict.GetHandle());
+}
+
 }  // namespace
 
 // static
@@ -284,6 +324,47 @@ v8::Local<v8::Promise> WebFrameMain::ExecuteJavaScript(
   return handle;
 }
 
+v8::Local<v8::Promise> WebFrameMain::ExecuteJavaScriptBatch(
+    gin::Arguments* args,
+    const std::vector<std::u16string>& scripts) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Optional userGesture parameter
+  bool user_gesture = false;
+  if (!args->PeekNext().IsEmpty()) {
+    if (args->PeekNext()->IsBoolean()) {
+      args->GetNext(&user_gesture);
+    } else {
+      args->ThrowTypeError("userGesture must be a boolean");
+      return handle;
+    }
+  }
+
+  if (render_frame_disposed_) {
+    promise.RejectWithErrorMessage(
+        "Render frame was disposed before WebFrameMain could be accessed");
+    return handle;
+  }
+
+  if (scripts.empty()) {
+    OnJavaScriptBatchExecuted(std::move(promise), 0, base::TimeTicks::Now(),
+                              {});
+    return handle;
+  }
+
+  // All scripts travel in one message, and the renderer replies once with
+  // every result, so the cost of a round trip is paid once per batch.
+  GetRendererApi()->ExecuteJavaScriptBatch(
+      scripts, user_gesture,
+      mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+          base::BindOnce(&OnJavaScriptBatchExecuted, std::move(promise),
+                         scripts.size(), base::TimeTicks::Now()),
+          std::vector<mojom::JavaScriptBatchResultPtr>()));
+
+  return handle;
+}
+
 #if BUILDFLAG(ENABLE_PRINTING)
 v8::Local<v8::Promise> WebFrameMain::PrintToPDF(const base::Value& settings) {
   if (!HasRenderFrame()) {
@@ -672,6 +753,8 @@ void WebFrameMain::FillObjectTemplate(v8::Isolate* isolate,
                                       v8::Local<v8::ObjectTemplate> templ) {
   gin_helper::ObjectTemplateBuilder(isolate, templ)
       .SetMethod("executeJavaScript", &WebFrameMain::ExecuteJavaScript)
+      .SetMethod("executeJavaScriptBatch",
+                 &WebFrameMain::ExecuteJavaScriptBatch)
       .SetMethod("collectJavaScriptCallStack",
                  &WebFrameMain::CollectDocumentJSCallStack)
 #if BUILDFLAG(ENABLE_PRINTING)
@@ -111,6 +111,9 @@ class WebFrameMain final : public gin::Wrappable<WebFrameMain>,
 
   v8::Local<v8::Promise> ExecuteJavaScript(gin::Arguments* args,
                                            const std::u16string& code);
+  v8::Local<v8::Promise> ExecuteJavaScriptBatch(
+      gin::Arguments* args,
+      const std::vector<std::u16string>& scripts);
 #if BUILDFLAG(ENABLE_PRINTING)
   v8::Local<v8::Promise> PrintToPDF(const base::Value& settings);
 #endif
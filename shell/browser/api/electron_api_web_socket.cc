@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_web_socket.h"
 
+#include <algorithm>
 #include <limits>
 #include <utility>
 
@@ -60,6 +61,16 @@ constexpr net::NetworkTrafficAnnotationTag kWebSocketTrafficAnnotation =
           setting: "This feature cannot be disabled."
         })");
 
+// Completed messages are coalesced into a single JS callback until the batch
+// holds this many bytes or the current task ends, whichever comes first.
+constexpr size_t kMaxReadBatchBytes = 64 * 1024;
+
+// Pooled read/write buffers larger than this are released instead of being
+// kept around for reuse, so that one large message does not pin memory for
+// the lifetime of the connection.
+constexpr size_t kMaxPooledBufferBytes = 1024 * 1024;
+constexpr size_t kMaxSpareWriteBuffers = 8;
+
 }  // namespace
 
 const gin::WrapperInfo WebSocketWrapper::kWrapperInfo =
@@ -215,6 +226,10 @@ void WebSocketWrapper::OnMojoDisconnect() {
 }
 
 void WebSocketWrapper::Fail(const std::string& message, int net_error) {
+  if (state_ == State::kClosed)
+    return;
+  // Messages that were fully received before the failure are still delivered.
+  FlushReadBatch();
   if (state_ == State::kClosed)
     return;
   state_ = State::kClosed;
@@ -249,7 +264,11 @@ void WebSocketWrapper::Teardown() {
   readable_.reset();
   writable_.reset();
   pending_writes_.clear();
-  pending_read_data_.clear();
+  spare_write_buffers_.clear();
+  read_batch_data_.clear();
+  read_batch_entries_.clear();
+  read_message_start_ = 0;
+  pending_read_offset_ = 0;
   // Allow this object to be collected once nothing in JS references it.
   keep_alive_.Clear();
 }
@@ -319,7 +338,7 @@ void WebSocketWrapper::OnDataFrame(bool fin,
                                    network::mojom::WebSocketMessageType type,
                                    uint64_t data_len) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  CHECK_EQ(pending_read_offset_, pending_read_data_.size());
+  CHECK_EQ(pending_read_offset_, read_batch_data_.size());
   CHECK(!pending_read_fin_);
 
   if (type != network::mojom::WebSocketMessageType::CONTINUATION) {
@@ -333,15 +352,16 @@ void WebSocketWrapper::OnDataFrame(bool fin,
     return;
   }
 
-  const size_t old_size = pending_read_data_.size();
+  const size_t old_size = read_batch_data_.size();
   const uint64_t new_size = old_size + data_len;
   if (data_len > std::numeric_limits<size_t>::max() - old_size ||
-      new_size > std::numeric_limits<size_t>::max()) {
+      new_size > std::numeric_limits<size_t>::max() ||
+      new_size - read_message_start_ > std::numeric_limits<uint32_t>::max()) {
     Fail("WebSocket message too large", net::ERR_MSG_TOO_BIG);
     return;
   }
 
-  pending_read_data_.resize(static_cast<size_t>(new_size));
+  read_batch_data_.resize(static_cast<size_t>(new_size));
   pending_read_fin_ = fin;
   // Pause so we don't get the next OnDataFrame until this frame's bytes have
   // been fully drained from the pipe.
@@ -352,17 +372,17 @@ void WebSocketWrapper::OnDataFrame(bool fin,
 void WebSocketWrapper::OnReadable(MojoResult, const mojo::HandleSignalsState&) {
   if (state_ == State::kClosed)
     return;
-  CHECK_LT(pending_read_offset_, pending_read_data_.size());
+  CHECK_LT(pending_read_offset_, read_batch_data_.size());
 
   size_t actually_read = 0;
   const MojoResult result = readable_->ReadData(
       MOJO_READ_DATA_FLAG_NONE,
-      base::span(pending_read_data_).subspan(pending_read_offset_),
+      base::span(read_batch_data_).subspan(pending_read_offset_),
       actually_read);
   if (result == MOJO_RESULT_OK) {
     pending_read_offset_ += actually_read;
-    DCHECK_LE(pending_read_offset_, pending_read_data_.size());
-    if (pending_read_offset_ < pending_read_data_.size()) {
+    DCHECK_LE(pending_read_offset_, read_batch_data_.size());
+    if (pending_read_offset_ < read_batch_data_.size()) {
       readable_watcher_.ArmOrNotify();
     } else {
       client_receiver_.Resume();
@@ -377,28 +397,83 @@ void WebSocketWrapper::OnReadable(MojoResult, const mojo::HandleSignalsState&) {
 }
 
 void WebSocketWrapper::ProcessCompletedMessage() {
-  std::vector<uint8_t> data;
-  data.swap(pending_read_data_);
-  pending_read_offset_ = 0;
-  pending_read_fin_ = false;
+  const size_t length = read_batch_data_.size() - read_message_start_;
   const bool is_text =
       pending_read_type_ == network::mojom::WebSocketMessageType::TEXT;
+  read_batch_entries_.push_back(static_cast<uint32_t>(length));
+  read_batch_entries_.push_back(is_text ? 1u : 0u);
+  read_message_start_ = read_batch_data_.size();
+  pending_read_fin_ = false;
   pending_read_type_ = network::mojom::WebSocketMessageType::CONTINUATION;
 
+  if (read_message_start_ >= kMaxReadBatchBytes) {
+    FlushReadBatch();
+    return;
+  }
+  if (!read_flush_scheduled_) {
+    read_flush_scheduled_ = true;
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&WebSocketWrapper::OnReadBatchTimer, WeakRef()));
+  }
+}
+
+void WebSocketWrapper::OnReadBatchTimer() {
+  read_flush_scheduled_ = false;
+  FlushReadBatch();
+}
+
+void WebSocketWrapper::FlushReadBatch() {
+  if (read_batch_entries_.empty())
+    return;
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
+
+  // One Buffer for the whole batch; JS slices it into per-message views.
+  const size_t batch_size = read_message_start_;
   v8::Local<v8::Object> buffer;
-  if (!electron::Buffer::Copy(isolate, base::span(data)).ToLocal(&buffer)) {
+  const bool copied =
+      electron::Buffer::Copy(isolate,
+                             base::span(read_batch_data_).first(batch_size))
+          .ToLocal(&buffer);
+
+  const size_t entry_count = read_batch_entries_.size();
+  v8::Local<v8::ArrayBuffer> entries_buffer =
+      v8::ArrayBuffer::New(isolate, entry_count * sizeof(uint32_t));
+  v8::Local<v8::Uint32Array> entries =
+      v8::Uint32Array::New(entries_buffer, 0, entry_count);
+  electron::util::as_byte_span(entries).copy_from(
+      base::as_byte_span(read_batch_entries_));
+
+  // Keep any partially-received message at the front of the pooled buffer so
+  // the next read continues where this one left off. Emit() below may
+  // re-enter (e.g. close() from a message handler), so all bookkeeping is
+  // done before calling into JS.
+  read_batch_data_.erase(read_batch_data_.begin(),
+                         read_batch_data_.begin() + batch_size);
+  pending_read_offset_ -= batch_size;
+  read_message_start_ = 0;
+  read_batch_entries_.clear();
+  if (read_batch_data_.empty() &&
+      read_batch_data_.capacity() > kMaxPooledBufferBytes) {
+    read_batch_data_.shrink_to_fit();
+  }
+
+  if (!copied) {
     Fail("Failed to allocate WebSocket message buffer", net::ERR_OUT_OF_MEMORY);
     return;
   }
-  Emit("message", is_text, buffer);
+  Emit("messages", buffer, entries.As<v8::Value>());
 }
 
 void WebSocketWrapper::OnDropChannel(bool was_clean,
                                      uint16_t code,
                                      const std::string& reason) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (state_ == State::kClosed)
+    return;
+  FlushReadBatch();
   if (state_ == State::kClosed)
     return;
   // Avoid the disconnect handler firing with a synthetic error after this.
@@ -411,6 +486,7 @@ void WebSocketWrapper::OnDropChannel(bool was_clean,
 
 void WebSocketWrapper::OnClosingHandshake() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  FlushReadBatch();
   if (state_ == State::kOpen)
     state_ = State::kClosing;
   Emit("closing");
@@ -435,11 +511,42 @@ void WebSocketWrapper::Send(gin::Arguments* args) {
   if (state_ != State::kOpen || close_requested_)
     return;
 
-  pending_writes_.emplace_back(
-      is_text ? network::mojom::WebSocketMessageType::TEXT
-              : network::mojom::WebSocketMessageType::BINARY,
-      std::vector<uint8_t>(bytes.begin(), bytes.end()));
-  DrainWriteQueue();
+  const auto type = is_text ? network::mojom::WebSocketMessageType::TEXT
+                            : network::mojom::WebSocketMessageType::BINARY;
+  if (!pending_writes_.empty()) {
+    std::vector<uint8_t> buffer = AcquireWriteBuffer();
+    buffer.assign(bytes.begin(), bytes.end());
+    pending_writes_.emplace_back(type, std::move(buffer));
+    if (buffered_amount_ > buffered_amount_low_threshold_)
+      buffered_amount_low_armed_ = true;
+    DrainWriteQueue();
+    return;
+  }
+
+  // Fast path: nothing is queued ahead of this message, so hand as much of it
+  // as the data pipe will take straight from the caller's buffer and only
+  // copy whatever does not fit.
+  websocket_->SendMessage(type, bytes.size());
+  size_t written = 0;
+  if (!WriteToPipe(bytes, written) || written == bytes.size())
+    return;
+
+  std::vector<uint8_t> buffer = AcquireWriteBuffer();
+  const auto remainder = bytes.subspan(written);
+  buffer.assign(remainder.begin(), remainder.end());
+  pending_writes_.emplace_back(type, std::move(buffer)).announced = true;
+  if (buffered_amount_ > buffered_amount_low_threshold_)
+    buffered_amount_low_armed_ = true;
+  writable_watcher_.ArmOrNotify();
+}
+
+void WebSocketWrapper::SetBufferedAmountLowThreshold(uint64_t threshold) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  buffered_amount_low_threshold_ = threshold;
+  if (buffered_amount_ > buffered_amount_low_threshold_ &&
+      !pending_writes_.empty()) {
+    buffered_amount_low_armed_ = true;
+  }
 }
 
 void WebSocketWrapper::Close(gin::Arguments* args) {
@@ -478,6 +585,28 @@ void WebSocketWrapper::Close(gin::Arguments* args) {
   DrainWriteQueue();
 }
 
+bool WebSocketWrapper::WriteToPipe(base::span<const uint8_t> data,
+                                   size_t& written) {
+  written = 0;
+  while (written < data.size()) {
+    base::span<uint8_t> dest;
+    MojoResult result = writable_->BeginWriteData(
+        data.size() - written, MOJO_BEGIN_WRITE_DATA_FLAG_NONE, dest);
+    if (result == MOJO_RESULT_SHOULD_WAIT)
+      return true;
+    if (result != MOJO_RESULT_OK) {
+      Fail("WebSocket write failed", net::ERR_FAILED);
+      return false;
+    }
+    const size_t chunk = std::min(dest.size(), data.size() - written);
+    dest.first(chunk).copy_from(data.subspan(written, chunk));
+    writable_->EndWriteData(chunk);
+    written += chunk;
+    buffered_amount_ -= chunk;
+  }
+  return true;
+}
+
 void WebSocketWrapper::DrainWriteQueue() {
   while (!pending_writes_.empty()) {
     PendingMessage& msg = pending_writes_.front();
@@ -487,32 +616,60 @@ void WebSocketWrapper::DrainWriteQueue() {
       msg.announced = true;
     }
 
-    while (msg.offset < msg.data.size()) {
-      base::span<uint8_t> dest;
-      MojoResult result = writable_->BeginWriteData(
-          msg.data.size() - msg.offset, MOJO_BEGIN_WRITE_DATA_FLAG_NONE, dest);
-      if (result == MOJO_RESULT_SHOULD_WAIT) {
-        writable_watcher_.ArmOrNotify();
-        return;
-      }
-      if (result != MOJO_RESULT_OK) {
-        Fail("WebSocket write failed", net::ERR_FAILED);
-        return;
-      }
-      const size_t chunk = std::min(dest.size(), msg.data.size() - msg.offset);
-      dest.first(chunk).copy_from(
-          base::span(msg.data).subspan(msg.offset, chunk));
-      writable_->EndWriteData(chunk);
-      msg.offset += chunk;
-      buffered_amount_ -= chunk;
+    size_t written = 0;
+    if (!WriteToPipe(base::span(msg.data).subspan(msg.offset), written))
+      return;
+    msg.offset += written;
+    if (msg.offset < msg.data.size()) {
+      writable_watcher_.ArmOrNotify();
+      MaybeNotifyBufferedAmountLow();
+      return;
     }
 
+    RecycleWriteBuffer(std::move(msg.data));
     pending_writes_.pop_front();
   }
 
+  MaybeNotifyBufferedAmountLow();
   MaybeStartClosingHandshake();
 }
 
+std::vector<uint8_t> WebSocketWrapper::AcquireWriteBuffer() {
+  if (spare_write_buffers_.empty())
+    return {};
+  std::vector<uint8_t> buffer = std::move(spare_write_buffers_.back());
+  spare_write_buffers_.pop_back();
+  return buffer;
+}
+
+void WebSocketWrapper::RecycleWriteBuffer(std::vector<uint8_t> buffer) {
+  if (buffer.capacity() > kMaxPooledBufferBytes ||
+      spare_write_buffers_.size() >= kMaxSpareWriteBuffers) {
+    return;
+  }
+  buffer.clear();
+  spare_write_buffers_.push_back(std::move(buffer));
+}
+
+void WebSocketWrapper::MaybeNotifyBufferedAmountLow() {
+  if (!buffered_amount_low_armed_ ||
+      buffered_amount_ > buffered_amount_low_threshold_) {
+    return;
+  }
+  buffered_amount_low_armed_ = false;
+  // Like RTCDataChannel's 'bufferedamountlow', fire from a queued task rather
+  // than synchronously from inside send().
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&WebSocketWrapper::EmitBufferedAmountLow, WeakRef()));
+}
+
+void WebSocketWrapper::EmitBufferedAmountLow() {
+  if (state_ == State::kClosed)
+    return;
+  Emit("bufferedamountlow");
+}
+
 void WebSocketWrapper::OnWritable(MojoResult result,
                                   const mojo::HandleSignalsState&) {
   if (state_ == State::kClosed)
@@ -540,7 +697,9 @@ gin::ObjectTemplateBuilder WebSocketWrapper::GetObjectTemplateBuilder(
              WebSocketWrapper>::GetObjectTemplateBuilder(isolate)
       .SetMethod("send", &WebSocketWrapper::Send)
       .SetMethod("close", &WebSocketWrapper::Close)
-      .SetMethod("getBufferedAmount", &WebSocketWrapper::GetBufferedAmount);
+      .SetMethod("getBufferedAmount", &WebSocketWrapper::GetBufferedAmount)
+      .SetMethod("setBufferedAmountLowThreshold",
+                 &WebSocketWrapper::SetBufferedAmountLowThreshold);
 }
 
 const gin::WrapperInfo* WebSocketWrapper::wrapper_info() const {
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/span.h"
 #include "base/memory/raw_ptr.h"
 #include "base/sequence_checker.h"
 #include "gin/weak_cell.h"
@@ -95,6 +96,7 @@ class WebSocketWrapper final
   void Send(gin::Arguments* args);
   void Close(gin::Arguments* args);
   uint64_t GetBufferedAmount() const { return buffered_amount_; }
+  void SetBufferedAmountLowThreshold(uint64_t threshold);
 
   // network::mojom::WebSocketHandshakeClient:
   void OnOpeningHandshakeStarted(
@@ -133,10 +135,22 @@ class WebSocketWrapper final
   // Read side.
   void OnReadable(MojoResult result, const mojo::HandleSignalsState& state);
   void ProcessCompletedMessage();
+  void OnReadBatchTimer();
+  // Delivers every completed message in |read_batch_data_| to JS in a single
+  // 'messages' event. Must be called before emitting any event that changes
+  // the JS-visible readyState so that messages are not dropped.
+  void FlushReadBatch();
 
   // Write side.
   void OnWritable(MojoResult result, const mojo::HandleSignalsState& state);
+  // Writes as much of |data| as the data pipe will currently accept. Returns
+  // false if the pipe failed, in which case the connection has been failed.
+  bool WriteToPipe(base::span<const uint8_t> data, size_t& written);
   void DrainWriteQueue();
+  std::vector<uint8_t> AcquireWriteBuffer();
+  void RecycleWriteBuffer(std::vector<uint8_t> buffer);
+  void MaybeNotifyBufferedAmountLow();
+  void EmitBufferedAmountLow();
   void MaybeStartClosingHandshake();
 
   SEQUENCE_CHECKER(sequence_checker_);
@@ -165,17 +179,27 @@ class WebSocketWrapper final
   mojo::ScopedDataPipeProducerHandle writable_;
   mojo::SimpleWatcher writable_watcher_;
 
-  // Read state. A WebSocket message may span multiple frames; we accumulate
-  // them in |pending_read_data_| until we see a frame with fin=true.
-  std::vector<uint8_t> pending_read_data_;
+  // Read state. Incoming messages are read back to back into the pooled
+  // |read_batch_data_| buffer; [0, read_message_start_) holds completed
+  // messages that have not been delivered to JS yet, and the in-progress
+  // message (which may span multiple frames) starts at |read_message_start_|.
+  // |read_batch_entries_| holds a (length, is_text) pair per completed message.
+  std::vector<uint8_t> read_batch_data_;
+  std::vector<uint32_t> read_batch_entries_;
+  size_t read_message_start_ = 0;
   size_t pending_read_offset_ = 0;
   bool pending_read_fin_ = false;
+  bool read_flush_scheduled_ = false;
   network::mojom::WebSocketMessageType pending_read_type_ =
       network::mojom::WebSocketMessageType::CONTINUATION;
 
-  // Write state.
+  // Write state. Messages only land in |pending_writes_| when the data pipe
+  // is full; their storage is recycled through |spare_write_buffers_|.
   std::deque<PendingMessage> pending_writes_;
+  std::vector<std::vector<uint8_t>> spare_write_buffers_;
   uint64_t buffered_amount_ = 0;
+  uint64_t buffered_amount_low_threshold_ = 0;
+  bool buffered_amount_low_armed_ = false;
   bool close_requested_ = false;
   uint16_t close_code_ = 0;
   std::string close_reason_;
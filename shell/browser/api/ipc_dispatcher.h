@@ -10,6 +10,7 @@
 #include "base/trace_event/trace_event.h"
 #include "shell/browser/api/message_port.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/browser/main_thread_monitor.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/gin_converters/serialized_value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -31,14 +32,20 @@ class IpcDispatcher {
   void Message(v8::Local<v8::Object> event,
                const std::string& channel,
                electron::SerializedValue args) {
-    TRACE_EVENT1("electron", "IpcDispatcher::Message", "channel", channel);
+    TRACE_EVENT2("electron", "IpcDispatcher::Message", "channel", channel,
+                 "bytes", static_cast<uint64_t>(args.size()));
+    MainThreadMonitor::Section section(MainThreadMonitor::Origin::kIpcDispatch,
+                                      channel);
     emitter()->EmitWithoutEvent("-ipc-message", event, channel, args);
   }
 
   void Invoke(v8::Local<v8::Object> event,
               const std::string& channel,
               electron::SerializedValue arguments) {
-    TRACE_EVENT1("electron", "IpcDispatcher::Invoke", "channel", channel);
+    TRACE_EVENT2("electron", "IpcDispatcher::Invoke", "channel", channel,
+                 "bytes", static_cast<uint64_t>(arguments.size()));
+    MainThreadMonitor::Section section(MainThreadMonitor::Origin::kIpcDispatch,
+                                      channel);
     emitter()->EmitWithoutEvent("-ipc-invoke", event, channel,
                                 std::move(arguments));
   }
@@ -46,8 +53,11 @@ class IpcDispatcher {
   void ReceivePostMessage(v8::Local<v8::Object> event,
                           const std::string& channel,
                           blink::TransferableMessage message) {
-    TRACE_EVENT1("electron", "IpcDispatcher::ReceivePostMessage", "channel",
-                 channel);
+    TRACE_EVENT2("electron", "IpcDispatcher::ReceivePostMessage", "channel",
+                 channel, "bytes",
+                 static_cast<uint64_t>(message.encoded_message.size()));
+    MainThreadMonitor::Section section(MainThreadMonitor::Origin::kIpcDispatch,
+                                      channel);
     v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
     auto wrapped_ports =
@@ -61,7 +71,10 @@ class IpcDispatcher {
   void MessageSync(v8::Local<v8::Object> event,
                    const std::string& channel,
                    electron::SerializedValue arguments) {
-    TRACE_EVENT1("electron", "IpcDispatcher::MessageSync", "channel", channel);
+    TRACE_EVENT2("electron", "IpcDispatcher::MessageSync", "channel", channel,
+                 "bytes", static_cast<uint64_t>(arguments.size()));
+    MainThreadMonitor::Section section(MainThreadMonitor::Origin::kIpcDispatch,
+                                      channel);
     emitter()->EmitWithoutEvent("-ipc-message-sync", event, channel,
                                 std::move(arguments));
   }
@@ -69,7 +82,10 @@ class IpcDispatcher {
   void MessageHost(v8::Local<v8::Object> event,
                    const std::string& channel,
                    electron::SerializedValue arguments) {
-    TRACE_EVENT1("electron", "IpcDispatcher::MessageHost", "channel", channel);
+    TRACE_EVENT2("electron", "IpcDispatcher::MessageHost", "channel", channel,
+                 "bytes", static_cast<uint64_t>(arguments.size()));
+    MainThreadMonitor::Section section(MainThreadMonitor::Origin::kIpcDispatch,
+                                      channel);
     emitter()->EmitWithoutEvent("-ipc-message-host", event, channel,
                                 std::move(arguments));
   }
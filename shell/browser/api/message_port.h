@@ -58,6 +58,15 @@ class MessagePort final : public gin_helper::DeprecatedWrappable<MessagePort>,
       const std::vector<gin_helper::Handle<MessagePort>>& ports,
       bool* threw_exception);
 
+  // Splits the transfer list of a postMessage() call into the ports and the
+  // array buffers it holds. Throws and returns false if it is not an array or
+  // holds anything else.
+  static bool GetTransferables(
+      v8::Isolate* isolate,
+      v8::Local<v8::Value> transfer,
+      std::vector<gin_helper::Handle<MessagePort>>* ports,
+      std::vector<v8::Local<v8::ArrayBuffer>>* array_buffers);
+
   // gin_helper::Wrappable
   static gin::DeprecatedWrapperInfo kWrapperInfo;
   gin::ObjectTemplateBuilder GetObjectTemplateBuilder(
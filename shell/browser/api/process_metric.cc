@@ -6,6 +6,7 @@
 
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <utility>
 
 #if BUILDFLAG(IS_WIN)
@@ -48,6 +49,51 @@ std::optional<mach_task_basic_info_data_t> GetTaskInfo(mach_port_t task) {
 
 #endif  // BUILDFLAG(IS_MAC)
 
+#if BUILDFLAG(IS_LINUX)
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_split.h"
+
+namespace {
+
+// Parses the "<key>: <value> kB" lines of /proc/<pid>/<name> into bytes.
+base::flat_map<std::string, size_t> ReadProcMemoryFile(base::ProcessId pid,
+                                                       std::string_view name) {
+  base::flat_map<std::string, size_t> result;
+  std::string contents;
+  const base::FilePath path = base::FilePath("/proc")
+                                  .Append(base::NumberToString(pid))
+                                  .Append(name);
+  if (!base::ReadFileToString(path, &contents))
+    return result;
+
+  for (std::string_view line : base::SplitStringPiece(
+           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    std::vector<std::string_view> tokens = base::SplitStringPiece(
+        line, ": \t", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+    size_t kilobytes = 0;
+    if (tokens.size() == 3 && tokens[2] == "kB" &&
+        base::StringToSizeT(tokens[1], &kilobytes)) {
+      result.emplace(tokens[0], kilobytes << 10);
+    }
+  }
+  return result;
+}
+
+size_t GetOrZero(const base::flat_map<std::string, size_t>& values,
+                 std::string_view key) {
+  auto it = values.find(key);
+  return it != values.end() ? it->second : 0;
+}
+
+}  // namespace
+
+#endif  // BUILDFLAG(IS_LINUX)
+
 namespace electron {
 
 ProcessMetric::ProcessMetric(int type,
@@ -167,6 +213,32 @@ bool ProcessMetric::IsSandboxed() const {
 #endif
 }
 
-#endif  // BUILDFLAG(IS_MAC)
+#elif BUILDFLAG(IS_LINUX)
+
+ProcessMemoryInfo ProcessMetric::GetMemoryInfo() const {
+  ProcessMemoryInfo result;
+
+  // status is readable for every process of the same user, so it provides
+  // the values that do not need smaps_rollup.
+  const auto status = ReadProcMemoryFile(process.Pid(), "status");
+  result.working_set_size = GetOrZero(status, "VmRSS");
+  result.peak_working_set_size = GetOrZero(status, "VmHWM");
+  result.swap_size = GetOrZero(status, "VmSwap");
+
+  // smaps_rollup (Linux 4.14+) sums up smaps without listing every mapping,
+  // which makes reading it cheap enough for periodic sampling.
+  const auto rollup = ReadProcMemoryFile(process.Pid(), "smaps_rollup");
+  if (rollup.contains("Pss")) {
+    result.working_set_size = GetOrZero(rollup, "Rss");
+    result.swap_size = GetOrZero(rollup, "Swap");
+    result.proportional_set_size = GetOrZero(rollup, "Pss");
+    result.private_bytes =
+        GetOrZero(rollup, "Private_Clean") + GetOrZero(rollup, "Private_Dirty");
+  }
+
+  return result;
+}
+
+#endif  // BUILDFLAG(IS_LINUX)
 
 }  // namespace electron
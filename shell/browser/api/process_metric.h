@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_BROWSER_API_PROCESS_METRIC_H_
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base/process/process.h"
@@ -14,15 +15,19 @@
 
 namespace electron {
 
-#if !BUILDFLAG(IS_LINUX)
 struct ProcessMemoryInfo {
   size_t working_set_size = 0;
   size_t peak_working_set_size = 0;
 #if BUILDFLAG(IS_WIN)
   size_t private_bytes = 0;
+#elif BUILDFLAG(IS_LINUX)
+  size_t swap_size = 0;
+  // Only known when /proc/<pid>/smaps_rollup is readable, which it is not
+  // for processes that made themselves non-dumpable, e.g. sandboxed ones.
+  std::optional<size_t> proportional_set_size;
+  std::optional<size_t> private_bytes;
 #endif
 };
-#endif
 
 #if BUILDFLAG(IS_WIN)
 enum class ProcessIntegrityLevel {
@@ -48,9 +53,8 @@ struct ProcessMetric {
                 const std::string& name = std::string());
   ~ProcessMetric();
 
-#if !BUILDFLAG(IS_LINUX)
+  // On Linux this reads procfs, so it must not be called on the UI thread.
   ProcessMemoryInfo GetMemoryInfo() const;
-#endif
 
 #if BUILDFLAG(IS_WIN)
   ProcessIntegrityLevel GetIntegrityLevel() const;
@@ -0,0 +1,188 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/api/warm_web_contents_pool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/memory/raw_ptr.h"
+#include "base/task/sequenced_task_runner.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/web_contents_observer.h"
+#include "shell/browser/api/electron_api_session.h"
+#include "shell/browser/api/electron_api_web_contents.h"
+#include "shell/browser/javascript_environment.h"
+#include "shell/common/gin_converters/value_converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "shell/common/options_switches.h"
+#include "url/url_constants.h"
+
+namespace electron::api {
+
+// A pooled WebContents, kept alive by the pool until it is adopted.
+class WarmWebContentsPool::Entry : private content::WebContentsObserver {
+ public:
+  Entry(WarmWebContentsPool* pool,
+        v8::Isolate* isolate,
+        gin_helper::Handle<WebContents> web_contents)
+      : content::WebContentsObserver(web_contents->web_contents()),
+        pool_(pool),
+        api_web_contents_(web_contents->GetWeakPtr()),
+        wrapper_(isolate, web_contents.ToV8()) {}
+
+  // disable copy
+  Entry(const Entry&) = delete;
+  Entry& operator=(const Entry&) = delete;
+
+  ~Entry() override {
+    // Entries that were never adopted take their WebContents with them.
+    if (!wrapper_.IsEmpty() && api_web_contents_)
+      api_web_contents_->Destroy();
+  }
+
+  bool ready() const { return ready_; }
+
+  bool usable() const {
+    return api_web_contents_ && !api_web_contents_->IsCrashed();
+  }
+
+  gin_helper::Handle<WebContents> Release(v8::Isolate* isolate) {
+    wrapper_.Reset();
+    api_web_contents_->AdoptFromWarmPool();
+    return gin_helper::CreateHandle(isolate, api_web_contents_.get());
+  }
+
+ private:
+  // content::WebContentsObserver:
+  void DidFinishLoad(content::RenderFrameHost* render_frame_host,
+                     const GURL& validated_url) override {
+    if (ready_ || !render_frame_host->IsInPrimaryMainFrame())
+      return;
+    ready_ = true;
+    pool_->OnEntryReady(base::TimeTicks::Now() - created_);
+  }
+
+  raw_ptr<WarmWebContentsPool> pool_;
+  base::WeakPtr<WebContents> api_web_contents_;
+  v8::Global<v8::Value> wrapper_;
+  const base::TimeTicks created_ = base::TimeTicks::Now();
+  bool ready_ = false;
+};
+
+WarmWebContentsPool::WarmWebContentsPool(Session* session,
+                                         size_t size,
+                                         base::DictValue web_preferences)
+    : session_(session),
+      size_(size),
+      web_preferences_(NormalizeWebPreferences(std::move(web_preferences))) {}
+
+WarmWebContentsPool::~WarmWebContentsPool() = default;
+
+gin_helper::Handle<WebContents> WarmWebContentsPool::Take(
+    v8::Isolate* isolate,
+    const gin_helper::Dictionary& web_preferences) {
+  base::DictValue requested;
+  if (!gin::ConvertFromV8(isolate, web_preferences.GetHandle(), &requested) ||
+      NormalizeWebPreferences(std::move(requested)) != web_preferences_) {
+    ++misses_;
+    return {};
+  }
+
+  std::erase_if(entries_, [](const auto& entry) { return !entry->usable(); });
+
+  // Prefer a WebContents that has finished warming up.
+  auto it = std::ranges::find_if(
+      entries_, [](const auto& entry) { return entry->ready(); });
+  if (it == entries_.end())
+    it = entries_.begin();
+  if (it == entries_.end()) {
+    ++misses_;
+    ScheduleFill();
+    return {};
+  }
+
+  std::unique_ptr<Entry> entry = std::move(*it);
+  entries_.erase(it);
+  ++adopted_;
+  ScheduleFill();
+  return entry->Release(isolate);
+}
+
+void WarmWebContentsPool::RecordAdoption(base::TimeDelta latency) {
+  total_adoption_time_ += latency;
+}
+
+WarmWebContentsPool::Stats WarmWebContentsPool::GetStats() const {
+  Stats stats;
+  stats.size = size_;
+  stats.ready = static_cast<size_t>(
+      std::ranges::count_if(entries_, [](const auto& entry) {
+        return entry->ready() && entry->usable();
+      }));
+  stats.adopted = adopted_;
+  stats.misses = misses_;
+  if (warmups_)
+    stats.average_warmup_time = total_warmup_time_ / warmups_;
+  if (adopted_)
+    stats.average_adoption_time = total_adoption_time_ / adopted_;
+  return stats;
+}
+
+void WarmWebContentsPool::Fill() {
+  Session* session = session_.Get();
+  if (!session)
+    return;
+
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Object> session_wrapper;
+  if (!session->GetWrapper(isolate).ToLocal(&session_wrapper))
+    return;
+
+  std::erase_if(entries_, [](const auto& entry) { return !entry->usable(); });
+  while (entries_.size() < size_) {
+    auto prefs = gin_helper::Dictionary::CreateEmpty(isolate);
+    for (const auto [key, value] : web_preferences_)
+      prefs.Set(key, value);
+    prefs.Set("session", session_wrapper);
+    prefs.Set(options::kShow, false);
+    prefs.Set("warmPooled", true);
+
+    gin_helper::Handle<WebContents> web_contents =
+        WebContents::New(isolate, prefs);
+    if (web_contents.IsEmpty())
+      return;
+    // Committing about:blank launches the renderer and, for sandboxed
+    // pages, pushes the preload startup data ahead of the commit.
+    web_contents->LoadURL(GURL(url::kAboutBlankURL),
+                          gin_helper::Dictionary::CreateEmpty(isolate));
+    entries_.push_back(std::make_unique<Entry>(this, isolate, web_contents));
+  }
+}
+
+void WarmWebContentsPool::OnEntryReady(base::TimeDelta warmup_time) {
+  ++warmups_;
+  total_warmup_time_ += warmup_time;
+}
+
+void WarmWebContentsPool::ScheduleFill() {
+  // Replacements are created after the adopting constructor has returned, so
+  // that it does not pay for them.
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&WarmWebContentsPool::Fill,
+                                weak_factory_.GetWeakPtr()));
+}
+
+// static
+base::DictValue WarmWebContentsPool::NormalizeWebPreferences(
+    base::DictValue prefs) {
+  prefs.Remove("session");
+  prefs.Remove("partition");
+  prefs.Remove(options::kShow);
+  return prefs;
+}
+
+}  // namespace electron::api
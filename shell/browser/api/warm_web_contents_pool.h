@@ -0,0 +1,91 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_API_WARM_WEB_CONTENTS_POOL_H_
+#define ELECTRON_SHELL_BROWSER_API_WARM_WEB_CONTENTS_POOL_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/values.h"
+#include "shell/common/gin_helper/handle.h"
+#include "v8/include/cppgc/persistent.h"
+#include "v8/include/v8-forward.h"
+
+namespace gin_helper {
+class Dictionary;
+}
+
+namespace electron::api {
+
+class Session;
+class WebContents;
+
+// Keeps WebContents of a session warm (renderer launched, preloads and
+// startup data delivered, about:blank committed) so that BrowserWindow and
+// WebContentsView can adopt one instead of paying for a cold start.
+class WarmWebContentsPool {
+ public:
+  struct Stats {
+    size_t size = 0;
+    size_t ready = 0;
+    uint64_t adopted = 0;
+    uint64_t misses = 0;
+    base::TimeDelta average_warmup_time;
+    base::TimeDelta average_adoption_time;
+  };
+
+  WarmWebContentsPool(Session* session,
+                      size_t size,
+                      base::DictValue web_preferences);
+  ~WarmWebContentsPool();
+
+  // disable copy
+  WarmWebContentsPool(const WarmWebContentsPool&) = delete;
+  WarmWebContentsPool& operator=(const WarmWebContentsPool&) = delete;
+
+  // Returns a pooled WebContents if |web_preferences| match the ones the
+  // pool was configured with, or an empty handle otherwise.
+  gin_helper::Handle<WebContents> Take(
+      v8::Isolate* isolate,
+      const gin_helper::Dictionary& web_preferences);
+
+  // Called once an adopted WebContents has taken on its new preferences.
+  void RecordAdoption(base::TimeDelta latency);
+
+  Stats GetStats() const;
+
+  // Creates WebContents until the pool is full.
+  void Fill();
+
+ private:
+  class Entry;
+
+  void OnEntryReady(base::TimeDelta warmup_time);
+  void ScheduleFill();
+
+  // Preferences are compared without the keys that only pick the session or
+  // the initial visibility, which every pooled WebContents has in common.
+  static base::DictValue NormalizeWebPreferences(base::DictValue prefs);
+
+  cppgc::WeakPersistent<Session> session_;
+  const size_t size_;
+  const base::DictValue web_preferences_;
+  std::vector<std::unique_ptr<Entry>> entries_;
+
+  uint64_t adopted_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t warmups_ = 0;
+  base::TimeDelta total_warmup_time_;
+  base::TimeDelta total_adoption_time_;
+
+  base::WeakPtrFactory<WarmWebContentsPool> weak_factory_{this};
+};
+
+}  // namespace electron::api
+
+#endif  // ELECTRON_SHELL_BROWSER_API_WARM_WEB_CONTENTS_POOL_H_
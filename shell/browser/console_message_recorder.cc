@@ -0,0 +1,188 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/console_message_recorder.h"
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+
+#include "base/containers/fixed_flat_map.h"
+#include "base/containers/span.h"
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
+#include "base/i18n/time_formatting.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
+#include "third_party/blink/public/mojom/devtools/console_message.mojom.h"
+
+namespace electron {
+
+namespace {
+
+// Lines are handed to the file writer at most this often, or sooner once
+// this many bytes are buffered.
+constexpr base::TimeDelta kFlushDelay = base::Milliseconds(500);
+constexpr size_t kMaxPendingBytes = 64 * 1024;
+
+std::string_view LevelName(blink::mojom::ConsoleMessageLevel level) {
+  using Val = blink::mojom::ConsoleMessageLevel;
+  static constexpr auto Lookup = base::MakeFixedFlatMap<Val, std::string_view>({
+      {Val::kVerbose, "debug"},
+      {Val::kInfo, "info"},
+      {Val::kWarning, "warning"},
+      {Val::kError, "error"},
+  });
+  return Lookup.at(level);
+}
+
+}  // namespace
+
+// Owns the log file on a blocking-capable sequence.
+class ConsoleLogFileWriter {
+ public:
+  ConsoleLogFileWriter(base::FilePath path, uint64_t max_file_size)
+      : path_(std::move(path)), max_file_size_(max_file_size) {}
+
+  // disable copy
+  ConsoleLogFileWriter(const ConsoleLogFileWriter&) = delete;
+  ConsoleLogFileWriter& operator=(const ConsoleLogFileWriter&) = delete;
+
+  void Write(const std::string& data) {
+    std::string_view remaining(data);
+    while (!remaining.empty()) {
+      if (!file_.IsValid() && !Open(/*truncate=*/false))
+        return;
+
+      // Take as many whole lines as still fit in the current file; a single
+      // line larger than |max_file_size_| gets a file of its own.
+      size_t end = 0;
+      while (end < remaining.size()) {
+        size_t next = remaining.find('\n', end);
+        next = next == std::string_view::npos ? remaining.size() : next + 1;
+        if (size_ + next > max_file_size_ && (size_ > 0 || end > 0))
+          break;
+        end = next;
+      }
+      if (end == 0) {
+        Rotate();
+        continue;
+      }
+
+      if (!file_.WriteAtCurrentPosAndCheck(
+              base::as_byte_span(remaining.substr(0, end)))) {
+        return;
+      }
+      size_ += end;
+      remaining.remove_prefix(end);
+    }
+  }
+
+ private:
+  bool Open(bool truncate) {
+    file_.Initialize(
+        path_, truncate
+                   ? base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE
+                   : base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_APPEND);
+    if (!file_.IsValid())
+      return false;
+    size_ = static_cast<uint64_t>(std::max<int64_t>(file_.GetLength(), 0));
+    return true;
+  }
+
+  void Rotate() {
+    file_.Close();
+    const base::FilePath backup(path_.value() + FILE_PATH_LITERAL(".1"));
+    base::ReplaceFile(path_, backup, nullptr);
+    Open(/*truncate=*/true);
+  }
+
+  const base::FilePath path_;
+  const uint64_t max_file_size_;
+  base::File file_;
+  uint64_t size_ = 0;
+};
+
+ConsoleMessageRecorder::Options::Options()
+    : min_level(blink::mojom::ConsoleMessageLevel::kVerbose) {}
+ConsoleMessageRecorder::Options::Options(const Options&) = default;
+ConsoleMessageRecorder::Options& ConsoleMessageRecorder::Options::operator=(
+    const Options&) = default;
+ConsoleMessageRecorder::Options::~Options() = default;
+
+ConsoleMessageRecorder::ConsoleMessageRecorder(const Options& options)
+    : options_(options) {
+  if (!options_.path.empty()) {
+    // Logs are most useful right before a crash or quit, so let pending
+    // writes finish during shutdown.
+    writer_.emplace(base::ThreadPool::CreateSequencedTaskRunner(
+                        {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+                         base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+                    options_.path, options_.max_file_size);
+  }
+}
+
+ConsoleMessageRecorder::~ConsoleMessageRecorder() {
+  FlushPending();
+}
+
+void ConsoleMessageRecorder::Record(blink::mojom::ConsoleMessageLevel level,
+                                    const std::u16string& message,
+                                    int32_t line_number,
+                                    const std::u16string& source_id) {
+  if (level < options_.min_level)
+    return;
+
+  const base::Time now = base::Time::Now();
+
+  if (writer_) {
+    base::StrAppend(&pending_, {base::TimeFormatAsIso8601(now), " [",
+                                LevelName(level), "] ",
+                                base::UTF16ToUTF8(message)});
+    if (!source_id.empty()) {
+      base::StrAppend(&pending_, {" (", base::UTF16ToUTF8(source_id), ":",
+                                  base::NumberToString(line_number), ")"});
+    }
+    pending_ += '\n';
+
+    if (pending_.size() >= kMaxPendingBytes) {
+      FlushPending();
+    } else if (!flush_timer_.IsRunning()) {
+      flush_timer_.Start(FROM_HERE, kFlushDelay,
+                         base::BindOnce(&ConsoleMessageRecorder::FlushPending,
+                                        base::Unretained(this)));
+    }
+  }
+
+  if (options_.max_entries == 0)
+    return;
+  if (entries_.size() == options_.max_entries)
+    entries_.pop_front();
+  entries_.push_back({now, level, message, line_number, source_id});
+}
+
+void ConsoleMessageRecorder::Flush(base::OnceClosure callback) {
+  if (!writer_) {
+    std::move(callback).Run();
+    return;
+  }
+  flush_timer_.Stop();
+  writer_->AsyncCall(&ConsoleLogFileWriter::Write)
+      .WithArgs(std::exchange(pending_, std::string()))
+      .Then(std::move(callback));
+}
+
+void ConsoleMessageRecorder::FlushPending() {
+  flush_timer_.Stop();
+  if (!writer_ || pending_.empty())
+    return;
+  writer_->AsyncCall(&ConsoleLogFileWriter::Write)
+      .WithArgs(std::exchange(pending_, std::string()));
+}
+
+}  // namespace electron
@@ -0,0 +1,90 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_CONSOLE_MESSAGE_RECORDER_H_
+#define ELECTRON_SHELL_BROWSER_CONSOLE_MESSAGE_RECORDER_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "base/containers/circular_deque.h"
+#include "base/files/file_path.h"
+#include "base/functional/callback_forward.h"
+#include "base/threading/sequence_bound.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "third_party/blink/public/mojom/devtools/console_message.mojom-forward.h"
+
+namespace electron {
+
+class ConsoleLogFileWriter;
+
+// Records console messages of a WebContents natively, either into a bounded
+// in-memory ring or a size-capped log file (or both), so that capturing
+// renderer logs does not require a JS round trip per message.
+class ConsoleMessageRecorder {
+ public:
+  struct Options {
+    Options();
+    Options(const Options&);
+    Options& operator=(const Options&);
+    ~Options();
+
+    // Log file to append to; no file is written when empty.
+    base::FilePath path;
+    // Once the file would grow past this size it is moved to "<path>.1" and
+    // a fresh file is started.
+    uint64_t max_file_size = 10 * 1024 * 1024;
+    // Number of most recent messages kept in memory.
+    size_t max_entries = 1000;
+    // Messages below this level are dropped.
+    blink::mojom::ConsoleMessageLevel min_level;
+    // Whether 'console-message' should still be emitted to JS.
+    bool emit_events = false;
+  };
+
+  struct Entry {
+    base::Time time;
+    blink::mojom::ConsoleMessageLevel level;
+    std::u16string message;
+    int32_t line_number;
+    std::u16string source_id;
+  };
+
+  explicit ConsoleMessageRecorder(const Options& options);
+  ~ConsoleMessageRecorder();
+
+  // disable copy
+  ConsoleMessageRecorder(const ConsoleMessageRecorder&) = delete;
+  ConsoleMessageRecorder& operator=(const ConsoleMessageRecorder&) = delete;
+
+  const Options& options() const { return options_; }
+  const base::circular_deque<Entry>& entries() const { return entries_; }
+
+  void Record(blink::mojom::ConsoleMessageLevel level,
+              const std::u16string& message,
+              int32_t line_number,
+              const std::u16string& source_id);
+
+  // Writes buffered lines to the log file and runs |callback| once they
+  // have reached it.
+  void Flush(base::OnceClosure callback);
+
+ private:
+  void FlushPending();
+
+  const Options options_;
+  base::circular_deque<Entry> entries_;
+
+  // Formatted lines waiting to be handed to |writer_|; batched so that a
+  // chatty page does not post one file task per message.
+  std::string pending_;
+  base::OneShotTimer flush_timer_;
+  std::optional<base::SequenceBound<ConsoleLogFileWriter>> writer_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_CONSOLE_MESSAGE_RECORDER_H_
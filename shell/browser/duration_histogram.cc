@@ -0,0 +1,34 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/duration_histogram.h"
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+#include "shell/common/gin_helper/dictionary.h"
+
+namespace electron {
+
+void DurationHistogram::Add(base::TimeDelta duration) {
+  ++count;
+  total += duration;
+  max = std::max(max, duration);
+  const auto ms =
+      static_cast<uint64_t>(std::max<int64_t>(duration.InMilliseconds(), 0));
+  ++buckets[std::min<size_t>(std::bit_width(ms), kBucketCount - 1)];
+}
+
+v8::Local<v8::Value> DurationHistogram::ToV8(v8::Isolate* isolate) const {
+  auto dict = gin_helper::Dictionary::CreateEmpty(isolate);
+  dict.Set("count", static_cast<double>(count));
+  dict.Set("totalDuration", total.InMillisecondsF());
+  dict.Set("maxDuration", max.InMillisecondsF());
+  std::vector<double> bucket_counts(buckets.begin(), buckets.end());
+  dict.Set("buckets", bucket_counts);
+  return dict.GetHandle();
+}
+
+}  // namespace electron
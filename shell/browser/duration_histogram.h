@@ -0,0 +1,36 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_DURATION_HISTOGRAM_H_
+#define ELECTRON_SHELL_BROWSER_DURATION_HISTOGRAM_H_
+
+#include <array>
+#include <cstdint>
+
+#include "base/time/time.h"
+#include "v8/include/v8-forward.h"
+
+namespace electron {
+
+// Distribution of durations over power-of-two millisecond buckets, cheap
+// enough to update for every task or message.
+struct DurationHistogram {
+  // Bucket i counts durations below 2^i milliseconds, the last bucket all
+  // longer ones.
+  static constexpr size_t kBucketCount = 14;
+
+  void Add(base::TimeDelta duration);
+
+  // Returns a DurationHistogram object as documented in the API docs.
+  v8::Local<v8::Value> ToV8(v8::Isolate* isolate) const;
+
+  uint64_t count = 0;
+  base::TimeDelta total;
+  base::TimeDelta max;
+  std::array<uint64_t, kBucketCount> buckets = {};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_DURATION_HISTOGRAM_H_
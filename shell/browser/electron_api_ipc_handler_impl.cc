@@ -11,6 +11,7 @@
 #include "content/public/browser/web_contents.h"
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
 #include "shell/browser/api/electron_api_session.h"
+#include "shell/browser/ipc_profiler.h"
 #include "shell/common/gin_converters/content_converter.h"
 #include "shell/common/gin_converters/frame_converter.h"
 #include "shell/common/gin_helper/event.h"
@@ -53,6 +54,9 @@ void ElectronApiIPCHandlerImpl::Message(bool internal,
       return;
     v8::Local<v8::Object> event_object =
         event->GetWrapper(isolate).ToLocalChecked();
+    IpcProfiler::ScopedDispatch dispatch(
+        session->Get()->ipc_profiler(), IpcProfiler::MessageType::kSend,
+        channel, IpcProfiler::Payload::Of(arguments));
     session->Get()->Message(event_object, channel, std::move(arguments));
   }
 }
@@ -64,6 +68,9 @@ void ElectronApiIPCHandlerImpl::Invoke(bool internal,
   if (session && session->Get()) {
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
+    callback = session->Get()->ipc_profiler()->WrapReplyCallback(
+        IpcProfiler::MessageType::kInvoke, channel,
+        IpcProfiler::Payload::Of(arguments), std::move(callback));
     auto* event =
         MakeIPCEvent(isolate, session->Get(), internal, std::move(callback));
     if (!event)
@@ -86,6 +93,9 @@ void ElectronApiIPCHandlerImpl::ReceivePostMessage(
       return;
     v8::Local<v8::Object> event_object =
         event->GetWrapper(isolate).ToLocalChecked();
+    IpcProfiler::ScopedDispatch dispatch(
+        session->Get()->ipc_profiler(), IpcProfiler::MessageType::kPostMessage,
+        channel, {message.encoded_message.size()});
     session->Get()->ReceivePostMessage(event_object, channel,
                                        std::move(message));
   }
@@ -99,6 +109,9 @@ void ElectronApiIPCHandlerImpl::MessageSync(bool internal,
   if (session && session->Get()) {
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
+    callback = session->Get()->ipc_profiler()->WrapReplyCallback(
+        IpcProfiler::MessageType::kSendSync, channel,
+        IpcProfiler::Payload::Of(arguments), std::move(callback));
     auto* event =
         MakeIPCEvent(isolate, session->Get(), internal, std::move(callback));
     if (!event)
@@ -121,6 +134,9 @@ void ElectronApiIPCHandlerImpl::MessageHost(
       return;
     v8::Local<v8::Object> event_object =
         event->GetWrapper(isolate).ToLocalChecked();
+    IpcProfiler::ScopedDispatch dispatch(
+        session->Get()->ipc_profiler(), IpcProfiler::MessageType::kSendToHost,
+        channel, IpcProfiler::Payload::Of(arguments));
     session->Get()->MessageHost(event_object, channel, std::move(arguments));
   }
 }
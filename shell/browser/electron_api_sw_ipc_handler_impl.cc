@@ -14,6 +14,7 @@
 #include "mojo/public/cpp/bindings/self_owned_receiver.h"
 #include "shell/browser/api/electron_api_session.h"
 #include "shell/browser/electron_browser_context.h"
+#include "shell/browser/ipc_profiler.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/gin_helper/dictionary.h"
 
@@ -81,6 +82,9 @@ void ElectronApiSWIPCHandlerImpl::Message(bool internal,
       return;
     v8::Local<v8::Object> event_object =
         event->GetWrapper(isolate).ToLocalChecked();
+    IpcProfiler::ScopedDispatch dispatch(
+        session->Get()->ipc_profiler(), IpcProfiler::MessageType::kSend,
+        channel, IpcProfiler::Payload::Of(arguments));
     session->Get()->Message(event_object, channel, std::move(arguments));
   }
 }
@@ -93,6 +97,9 @@ void ElectronApiSWIPCHandlerImpl::Invoke(bool internal,
   if (session && session->Get()) {
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
+    callback = session->Get()->ipc_profiler()->WrapReplyCallback(
+        IpcProfiler::MessageType::kInvoke, channel,
+        IpcProfiler::Payload::Of(arguments), std::move(callback));
     auto* event =
         MakeIPCEvent(isolate, session->Get(), internal, std::move(callback));
     if (!event)
@@ -115,6 +122,9 @@ void ElectronApiSWIPCHandlerImpl::ReceivePostMessage(
       return;
     v8::Local<v8::Object> event_object =
         event->GetWrapper(isolate).ToLocalChecked();
+    IpcProfiler::ScopedDispatch dispatch(
+        session->Get()->ipc_profiler(), IpcProfiler::MessageType::kPostMessage,
+        channel, {message.encoded_message.size()});
     session->Get()->ReceivePostMessage(event_object, channel,
                                        std::move(message));
   }
@@ -129,6 +139,9 @@ void ElectronApiSWIPCHandlerImpl::MessageSync(
   if (session && session->Get()) {
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
+    callback = session->Get()->ipc_profiler()->WrapReplyCallback(
+        IpcProfiler::MessageType::kSendSync, channel,
+        IpcProfiler::Payload::Of(arguments), std::move(callback));
     auto* event =
         MakeIPCEvent(isolate, session->Get(), internal, std::move(callback));
     if (!event)
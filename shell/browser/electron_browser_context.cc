@@ -55,6 +55,7 @@
 #include "shell/browser/protocol_registry.h"
 #include "shell/browser/serial/serial_chooser_context.h"
 #include "shell/browser/special_storage_policy.h"
+#include "shell/browser/ui/devtools_file_system_index.h"
 #include "shell/browser/ui/inspectable_web_contents.h"
 #include "shell/browser/ui/webui/accessibility_ui.h"
 #include "shell/browser/web_contents_permission_helper.h"
@@ -583,6 +584,18 @@ content::PreconnectManager* ElectronBrowserContext::GetPreconnectManager() {
   return preconnect_manager_.get();
 }
 
+DevToolsFileSystemIndex* ElectronBrowserContext::GetDevToolsFileSystemIndex() {
+  if (!devtools_file_system_index_) {
+    // In-memory sessions do not leave the index of their folders behind.
+    base::FilePath storage_dir;
+    if (!in_memory_)
+      storage_dir = path_.Append(FILE_PATH_LITERAL("DevToolsFileSystemIndex"));
+    devtools_file_system_index_ =
+        std::make_unique<DevToolsFileSystemIndex>(std::move(storage_dir));
+  }
+  return devtools_file_system_index_.get();
+}
+
 void ElectronBrowserContext::OnNetworkServiceProcessGone(bool /* crashed */) {
   // Clear the cached URLLoaderFactory so the next request creates a new one
   // from the new NetworkContext.
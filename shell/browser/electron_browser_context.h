@@ -21,6 +21,7 @@
 #include "services/network/public/cpp/url_loader_factory_builder.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 #include "services/network/public/mojom/ssl_config.mojom.h"
+#include "shell/browser/net/network_statistics.h"
 #include "third_party/blink/public/common/permissions/permission_utils.h"
 
 class PrefService;
@@ -45,6 +46,7 @@ class SpecialStoragePolicy;
 namespace electron {
 
 class CookieChangeNotifier;
+class DevToolsFileSystemIndex;
 class ElectronDownloadManagerDelegate;
 class ElectronPermissionManager;
 class ElectronPreconnectManagerDelegate;
@@ -93,6 +95,7 @@ class ElectronBrowserContext : public content::BrowserContext {
   int max_cache_size() const { return max_cache_size_; }
   ResolveProxyHelper* GetResolveProxyHelper();
   content::PreconnectManager* GetPreconnectManager();
+  DevToolsFileSystemIndex* GetDevToolsFileSystemIndex();
   scoped_refptr<network::SharedURLLoaderFactory> GetURLLoaderFactory() override;
   scoped_refptr<network::SharedURLLoaderFactory> InterceptURLLoaderFactory(
       scoped_refptr<network::SharedURLLoaderFactory> factory);
@@ -145,6 +148,8 @@ class ElectronBrowserContext : public content::BrowserContext {
     return protocol_registry_.get();
   }
 
+  NetworkStatistics& network_statistics() { return network_statistics_; }
+
   void SetSSLConfig(network::mojom::SSLConfigPtr config);
   network::mojom::SSLConfigPtr GetSSLConfig();
   void SetSSLConfigClient(mojo::Remote<network::mojom::SSLConfigClient> client);
@@ -213,6 +218,7 @@ class ElectronBrowserContext : public content::BrowserContext {
   std::unique_ptr<ElectronPreconnectManagerDelegate>
       preconnect_manager_delegate_;
   std::unique_ptr<ProtocolRegistry> protocol_registry_;
+  std::unique_ptr<DevToolsFileSystemIndex> devtools_file_system_index_;
 
   std::optional<std::string> user_agent_;
   base::FilePath path_;
@@ -231,6 +237,8 @@ class ElectronBrowserContext : public content::BrowserContext {
 
   DisplayMediaRequestHandler display_media_request_handler_;
 
+  NetworkStatistics network_statistics_;
+
   // In-memory cache that holds objects that have been granted permissions.
   DevicePermissionMap granted_devices_;
 
@@ -11,6 +11,7 @@
 
 #include "gin/object_template_builder.h"
 #include "shell/browser/javascript_environment.h"
+#include "shell/browser/main_thread_monitor.h"
 #include "shell/common/gin_helper/event.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
 
@@ -27,6 +28,7 @@ class EventEmitterMixin {
   // Returns true if event.preventDefault() was called during processing.
   template <typename... Args>
   bool Emit(const std::string_view name, Args&&... args) {
+    electron::MainThreadMonitor::NameCurrentSection(name);
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
     v8::Local<v8::Object> wrapper;
@@ -43,6 +45,7 @@ class EventEmitterMixin {
   // this.emit(name, args...);
   template <typename... Args>
   void EmitWithoutEvent(const std::string_view name, Args&&... args) {
+    electron::MainThreadMonitor::NameCurrentSection(name);
     v8::Isolate* isolate = electron::JavascriptEnvironment::GetIsolate();
     v8::HandleScope handle_scope(isolate);
     v8::Local<v8::Object> wrapper;
@@ -0,0 +1,158 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/ipc_profiler.h"
+
+#include <vector>
+
+#include "base/functional/bind.h"
+#include "base/trace_event/trace_event.h"
+#include "shell/common/gin_helper/dictionary.h"
+
+namespace electron {
+
+namespace {
+
+// Channel names are chosen by the app and may be unbounded, e.g. when they
+// embed an id. Past this many entries, messages on new channels are counted
+// under an empty channel name.
+constexpr size_t kMaxEntries = 1000;
+
+std::string_view MessageTypeToString(IpcProfiler::MessageType type) {
+  switch (type) {
+    case IpcProfiler::MessageType::kSend:
+      return "send";
+    case IpcProfiler::MessageType::kInvoke:
+      return "invoke";
+    case IpcProfiler::MessageType::kSendSync:
+      return "send-sync";
+    case IpcProfiler::MessageType::kPostMessage:
+      return "post-message";
+    case IpcProfiler::MessageType::kSendToHost:
+      return "send-to-host";
+  }
+  NOTREACHED();
+}
+
+void OnReply(base::WeakPtr<IpcProfiler> profiler,
+             IpcProfiler::MessageType type,
+             const std::string& channel,
+             IpcProfiler::Payload payload,
+             base::TimeTicks start,
+             uint64_t trace_id,
+             IpcProfiler::ReplyCallback callback,
+             SerializedValue result) {
+  TRACE_EVENT_NESTABLE_ASYNC_END1("electron", "IpcProfiler::Reply",
+                                  TRACE_ID_LOCAL(trace_id), "bytes",
+                                  static_cast<uint64_t>(result.size()));
+  if (profiler) {
+    profiler->Record(type, channel, payload, base::TimeTicks::Now() - start,
+                     result.size());
+  }
+  std::move(callback).Run(std::move(result));
+}
+
+}  // namespace
+
+IpcProfiler::ScopedDispatch::ScopedDispatch(IpcProfiler* profiler,
+                                            MessageType type,
+                                            std::string_view channel,
+                                            Payload payload)
+    : type_(type), payload_(payload) {
+  if (!profiler || !profiler->is_running())
+    return;
+  profiler_ = profiler->GetWeakPtr();
+  channel_ = channel;
+  start_ = base::TimeTicks::Now();
+}
+
+IpcProfiler::ScopedDispatch::~ScopedDispatch() {
+  if (profiler_) {
+    profiler_->Record(type_, channel_, payload_,
+                      base::TimeTicks::Now() - start_);
+  }
+}
+
+IpcProfiler::IpcProfiler() = default;
+
+IpcProfiler::~IpcProfiler() = default;
+
+void IpcProfiler::Start() {
+  stats_.clear();
+  running_ = true;
+}
+
+void IpcProfiler::Stop() {
+  running_ = false;
+}
+
+void IpcProfiler::Record(MessageType type,
+                         std::string_view channel,
+                         Payload payload,
+                         base::TimeDelta latency,
+                         size_t reply_size) {
+  if (!running_)
+    return;
+  Key key(channel, type);
+  auto it = stats_.find(key);
+  if (it == stats_.end()) {
+    if (stats_.size() >= kMaxEntries)
+      key.first.clear();
+    it = stats_.try_emplace(std::move(key)).first;
+  }
+  Stats& stats = it->second;
+  ++stats.count;
+  stats.bytes += payload.size;
+  if (payload.shared_memory) {
+    ++stats.shared_memory_count;
+    stats.shared_memory_bytes += payload.size;
+  }
+  stats.reply_bytes += reply_size;
+  stats.latency.Add(latency);
+}
+
+IpcProfiler::ReplyCallback IpcProfiler::WrapReplyCallback(
+    MessageType type,
+    std::string_view channel,
+    Payload payload,
+    ReplyCallback callback) {
+  bool tracing = false;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED("electron", &tracing);
+  if (!running_ && !tracing)
+    return callback;
+
+  static uint64_t next_trace_id = 0;
+  const uint64_t trace_id = ++next_trace_id;
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN2(
+      "electron", "IpcProfiler::Reply", TRACE_ID_LOCAL(trace_id), "channel",
+      std::string(channel), "type", std::string(MessageTypeToString(type)));
+  return base::BindOnce(&OnReply, GetWeakPtr(), type, std::string(channel),
+                        payload, base::TimeTicks::Now(), trace_id,
+                        std::move(callback));
+}
+
+v8::Local<v8::Value> IpcProfiler::ToV8(v8::Isolate* isolate) const {
+  std::vector<gin_helper::Dictionary> entries;
+  entries.reserve(stats_.size());
+  for (const auto& [key, stats] : stats_) {
+    auto entry = gin_helper::Dictionary::CreateEmpty(isolate);
+    entry.Set("channel", key.first);
+    entry.Set("type", MessageTypeToString(key.second));
+    entry.Set("count", static_cast<double>(stats.count));
+    entry.Set("bytes", static_cast<double>(stats.bytes));
+    entry.Set("sharedMemoryCount",
+              static_cast<double>(stats.shared_memory_count));
+    entry.Set("sharedMemoryBytes",
+              static_cast<double>(stats.shared_memory_bytes));
+    if (key.second == MessageType::kInvoke ||
+        key.second == MessageType::kSendSync) {
+      entry.Set("replyBytes", static_cast<double>(stats.reply_bytes));
+    }
+    entry.Set("latency", stats.latency.ToV8(isolate));
+    entries.push_back(entry);
+  }
+  return gin::ConvertToV8(isolate, entries);
+}
+
+}  // namespace electron
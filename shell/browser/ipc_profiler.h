@@ -0,0 +1,127 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_IPC_PROFILER_H_
+#define ELECTRON_SHELL_BROWSER_IPC_PROFILER_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "base/containers/flat_map.h"
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "shell/browser/duration_histogram.h"
+#include "shell/common/serialized_value.h"
+#include "v8/include/v8-forward.h"
+
+namespace electron {
+
+// Counts the IPC messages renderers send to the main process of a session,
+// per channel and kind of message, along with their size and how long the
+// main process took to handle them.
+class IpcProfiler {
+ public:
+  enum class MessageType {
+    kSend,
+    kInvoke,
+    kSendSync,
+    kPostMessage,
+    kSendToHost,
+  };
+
+  // The payload of a message as it crossed the process boundary.
+  struct Payload {
+    static Payload Of(const SerializedValue& value) {
+      return {value.size(), value.is_shared_memory()};
+    }
+
+    size_t size = 0;
+    bool shared_memory = false;
+  };
+
+  using ReplyCallback = base::OnceCallback<void(SerializedValue)>;
+
+  // Records a message once its listeners have run, which they do for as long
+  // as this is in scope.
+  class ScopedDispatch {
+   public:
+    ScopedDispatch(IpcProfiler* profiler,
+                   MessageType type,
+                   std::string_view channel,
+                   Payload payload);
+    ~ScopedDispatch();
+
+    // disable copy
+    ScopedDispatch(const ScopedDispatch&) = delete;
+    ScopedDispatch& operator=(const ScopedDispatch&) = delete;
+
+   private:
+    base::WeakPtr<IpcProfiler> profiler_;
+    MessageType type_;
+    std::string channel_;
+    Payload payload_;
+    base::TimeTicks start_;
+  };
+
+  IpcProfiler();
+  ~IpcProfiler();
+
+  // disable copy
+  IpcProfiler(const IpcProfiler&) = delete;
+  IpcProfiler& operator=(const IpcProfiler&) = delete;
+
+  // Starting discards what was recorded before.
+  void Start();
+  void Stop();
+  bool is_running() const { return running_; }
+
+  // |latency| is the time from receiving the message to having dispatched it
+  // to its listeners, or to having sent the reply of invoke and sendSync
+  // messages, whose size is |reply_size|.
+  void Record(MessageType type,
+              std::string_view channel,
+              Payload payload,
+              base::TimeDelta latency,
+              size_t reply_size = 0);
+
+  // Wraps the reply callback of an invoke or sendSync message so that the
+  // message is recorded, and traced, once it is replied to. Returns
+  // |callback| as is when neither profiling nor tracing.
+  ReplyCallback WrapReplyCallback(MessageType type,
+                                  std::string_view channel,
+                                  Payload payload,
+                                  ReplyCallback callback);
+
+  // Returns an array of IpcChannelStats objects as documented in the API
+  // docs.
+  v8::Local<v8::Value> ToV8(v8::Isolate* isolate) const;
+
+  base::WeakPtr<IpcProfiler> GetWeakPtr() {
+    return weak_factory_.GetWeakPtr();
+  }
+
+ private:
+  struct Stats {
+    uint64_t count = 0;
+    uint64_t bytes = 0;
+    uint64_t shared_memory_count = 0;
+    uint64_t shared_memory_bytes = 0;
+    uint64_t reply_bytes = 0;
+    DurationHistogram latency;
+  };
+
+  using Key = std::pair<std::string, MessageType>;
+
+  bool running_ = false;
+  base::flat_map<Key, Stats> stats_;
+
+  base::WeakPtrFactory<IpcProfiler> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_IPC_PROFILER_H_
@@ -0,0 +1,197 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/main_thread_monitor.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/pending_task.h"
+#include "base/task/current_thread.h"
+#include "base/task/sequenced_task_runner.h"
+
+namespace electron {
+
+namespace {
+
+// The running monitor, if any. Only touched on the UI thread.
+MainThreadMonitor* g_running_monitor = nullptr;
+
+}  // namespace
+
+MainThreadMonitor::LongTask::LongTask() = default;
+MainThreadMonitor::LongTask::LongTask(LongTask&&) = default;
+MainThreadMonitor::LongTask& MainThreadMonitor::LongTask::operator=(
+    LongTask&&) = default;
+MainThreadMonitor::LongTask::~LongTask() = default;
+
+MainThreadMonitor::Frame::Frame() = default;
+MainThreadMonitor::Frame::Frame(Frame&&) = default;
+MainThreadMonitor::Frame& MainThreadMonitor::Frame::operator=(Frame&&) =
+    default;
+MainThreadMonitor::Frame::~Frame() = default;
+
+MainThreadMonitor::Section::Section(Origin origin, std::string_view name) {
+  if (!g_running_monitor)
+    return;
+  monitor_ = g_running_monitor;
+  depth_ = monitor_->stack_.size();
+  monitor_->Begin(origin, name, base::Location(), nullptr);
+}
+
+MainThreadMonitor::Section::~Section() {
+  // The code in the section may have stopped the monitor.
+  if (monitor_ && monitor_->IsRunning() &&
+      monitor_->stack_.size() == depth_ + 1) {
+    monitor_->End();
+  }
+}
+
+MainThreadMonitor::MainThreadMonitor(LongTaskCallback long_task_callback)
+    : long_task_callback_(std::move(long_task_callback)) {}
+
+MainThreadMonitor::~MainThreadMonitor() {
+  if (IsRunning() && base::CurrentThread::IsSet())
+    Stop();
+  if (g_running_monitor == this)
+    g_running_monitor = nullptr;
+}
+
+// static
+std::string_view MainThreadMonitor::OriginToString(Origin origin) {
+  switch (origin) {
+    case Origin::kPostedTask:
+      return "posted-task";
+    case Origin::kUvCallback:
+      return "uv-callback";
+    case Origin::kMicrotaskCheckpoint:
+      return "microtask-checkpoint";
+    case Origin::kIpcDispatch:
+      return "ipc-dispatch";
+  }
+  NOTREACHED();
+}
+
+// static
+void MainThreadMonitor::NameCurrentSection(std::string_view event_name) {
+  if (!g_running_monitor || g_running_monitor->stack_.empty())
+    return;
+  Frame& frame = g_running_monitor->stack_.back();
+  if (frame.name.empty())
+    frame.name = event_name;
+}
+
+void MainThreadMonitor::Start(base::TimeDelta long_task_threshold) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  long_task_threshold_ = long_task_threshold;
+  if (IsRunning())
+    return;
+  DCHECK(!g_running_monitor);
+  histograms_ = {};
+  g_running_monitor = this;
+  base::CurrentThread::Get()->AddTaskObserver(this);
+}
+
+void MainThreadMonitor::Stop() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!IsRunning())
+    return;
+  base::CurrentThread::Get()->RemoveTaskObserver(this);
+  g_running_monitor = nullptr;
+  stack_.clear();
+  // Long tasks that have not been dispatched yet are dropped.
+  weak_factory_.InvalidateWeakPtrs();
+}
+
+bool MainThreadMonitor::IsRunning() const {
+  return g_running_monitor == this;
+}
+
+void MainThreadMonitor::WillProcessTask(const base::PendingTask& pending_task,
+                                        bool was_blocked_or_low_priority) {
+  Begin(Origin::kPostedTask, {}, pending_task.posted_from, &pending_task);
+}
+
+void MainThreadMonitor::DidProcessTask(const base::PendingTask& pending_task) {
+  // Monitoring may have started while the task was running.
+  if (!stack_.empty() && stack_.back().task == &pending_task)
+    End();
+}
+
+void MainThreadMonitor::Begin(Origin origin,
+                              std::string_view name,
+                              const base::Location& location,
+                              const base::PendingTask* task) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  Frame& frame = stack_.emplace_back();
+  frame.origin = origin;
+  frame.name = name;
+  frame.location = location;
+  frame.task = task;
+  frame.start = base::TimeTicks::Now();
+}
+
+void MainThreadMonitor::End() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  DCHECK(!stack_.empty());
+  Frame frame = std::move(stack_.back());
+  stack_.pop_back();
+
+  const base::TimeDelta duration = base::TimeTicks::Now() - frame.start;
+  const base::TimeDelta self_time = duration - frame.child_time;
+  const auto index = static_cast<size_t>(frame.origin);
+  histograms_[index].Add(self_time);
+  frame.breakdown[index] += self_time;
+  if (self_time > frame.longest.duration) {
+    frame.longest = {frame.origin, self_time, std::move(frame.name),
+                     frame.location};
+  }
+
+  // A task that starts while another section is running was run by a nested
+  // run loop, e.g. of a modal dialog. It is a long task on its own, while the
+  // section that spun the loop is not one.
+  const bool nested_task = frame.task && !stack_.empty();
+  if ((stack_.empty() || nested_task) && !frame.ran_nested_loop &&
+      duration >= long_task_threshold_) {
+    ReportLongTask(frame, duration);
+  }
+
+  if (stack_.empty())
+    return;
+  Frame& parent = stack_.back();
+  parent.child_time += duration;
+  if (nested_task) {
+    stack_.front().ran_nested_loop = true;
+    return;
+  }
+  for (size_t i = 0; i < kOriginCount; ++i)
+    parent.breakdown[i] += frame.breakdown[i];
+  if (frame.longest.duration > parent.longest.duration)
+    parent.longest = std::move(frame.longest);
+}
+
+void MainThreadMonitor::ReportLongTask(const Frame& frame,
+                                       base::TimeDelta duration) {
+  LongTask long_task;
+  long_task.start_time = base::Time::Now() - duration;
+  long_task.duration = duration;
+  long_task.origin = frame.longest.origin;
+  if (!frame.longest.name.empty())
+    long_task.name = frame.longest.name;
+  else if (frame.longest.location.has_source_info())
+    long_task.name = frame.longest.location.ToString();
+  long_task.breakdown = frame.breakdown;
+
+  // Listeners run in a task of their own rather than inside the observer.
+  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+      FROM_HERE, base::BindOnce(&MainThreadMonitor::DispatchLongTask,
+                                weak_factory_.GetWeakPtr(),
+                                std::move(long_task)));
+}
+
+void MainThreadMonitor::DispatchLongTask(LongTask long_task) {
+  long_task_callback_.Run(std::move(long_task));
+}
+
+}  // namespace electron
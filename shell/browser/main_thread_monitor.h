@@ -0,0 +1,150 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_MAIN_THREAD_MONITOR_H_
+#define ELECTRON_SHELL_BROWSER_MAIN_THREAD_MONITOR_H_
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/functional/callback.h"
+#include "base/location.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequence_checker.h"
+#include "base/task/task_observer.h"
+#include "base/time/time.h"
+#include "shell/browser/duration_histogram.h"
+
+namespace electron {
+
+// Measures how long the browser process's UI thread spends in each kind of
+// work it interleaves: Chromium tasks, libuv callbacks, microtask checkpoints
+// and IPC dispatch. Time spent in a nested section is attributed to it alone,
+// so a posted task that runs the uv loop counts as uv time. Durations are
+// recorded into one histogram per origin, and every task that blocks the
+// thread for longer than a threshold is reported along with what it spent
+// its time on.
+class MainThreadMonitor : public base::TaskObserver {
+ public:
+  enum class Origin {
+    kPostedTask,
+    kUvCallback,
+    kMicrotaskCheckpoint,
+    kIpcDispatch,
+    kMaxValue = kIpcDispatch,
+  };
+  static constexpr size_t kOriginCount =
+      static_cast<size_t>(Origin::kMaxValue) + 1;
+
+  struct LongTask {
+    LongTask();
+    LongTask(LongTask&&);
+    LongTask& operator=(LongTask&&);
+    ~LongTask();
+
+    base::Time start_time;
+    base::TimeDelta duration;
+    // The section the most time was spent in, named after its IPC channel,
+    // the event it emitted or the location it was posted from.
+    Origin origin = Origin::kPostedTask;
+    std::string name;
+    std::array<base::TimeDelta, kOriginCount> breakdown = {};
+  };
+
+  using LongTaskCallback = base::RepeatingCallback<void(LongTask)>;
+
+  // Marks a section of work on the UI thread for as long as it is in scope.
+  // Does nothing unless a monitor is running.
+  class Section {
+   public:
+    explicit Section(Origin origin, std::string_view name = {});
+    ~Section();
+
+    // disable copy
+    Section(const Section&) = delete;
+    Section& operator=(const Section&) = delete;
+
+   private:
+    raw_ptr<MainThreadMonitor> monitor_ = nullptr;
+    size_t depth_ = 0;
+  };
+
+  explicit MainThreadMonitor(LongTaskCallback long_task_callback);
+  ~MainThreadMonitor() override;
+
+  // disable copy
+  MainThreadMonitor(const MainThreadMonitor&) = delete;
+  MainThreadMonitor& operator=(const MainThreadMonitor&) = delete;
+
+  static std::string_view OriginToString(Origin origin);
+
+  // Names the innermost running section after the event it emits, unless it
+  // already has a name.
+  static void NameCurrentSection(std::string_view event_name);
+
+  void Start(base::TimeDelta long_task_threshold);
+  void Stop();
+  bool IsRunning() const;
+
+  const std::array<DurationHistogram, kOriginCount>& histograms() const {
+    return histograms_;
+  }
+
+  // base::TaskObserver
+  void WillProcessTask(const base::PendingTask& pending_task,
+                       bool was_blocked_or_low_priority) override;
+  void DidProcessTask(const base::PendingTask& pending_task) override;
+
+ private:
+  struct Attribution {
+    Origin origin = Origin::kPostedTask;
+    base::TimeDelta duration;
+    std::string name;
+    base::Location location;
+  };
+
+  struct Frame {
+    Frame();
+    Frame(Frame&&);
+    Frame& operator=(Frame&&);
+    ~Frame();
+
+    Origin origin;
+    std::string name;
+    base::Location location;
+    raw_ptr<const base::PendingTask> task = nullptr;
+    base::TimeTicks start;
+    base::TimeDelta child_time;
+    std::array<base::TimeDelta, kOriginCount> breakdown = {};
+    Attribution longest;
+    // Set on the outermost frame when a nested run loop ran tasks inside it,
+    // which are reported on their own instead.
+    bool ran_nested_loop = false;
+  };
+
+  void Begin(Origin origin,
+             std::string_view name,
+             const base::Location& location,
+             const base::PendingTask* task);
+  void End();
+  void ReportLongTask(const Frame& frame, base::TimeDelta duration);
+  void DispatchLongTask(LongTask long_task);
+
+  const LongTaskCallback long_task_callback_;
+  base::TimeDelta long_task_threshold_;
+  std::vector<Frame> stack_;
+  std::array<DurationHistogram, kOriginCount> histograms_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+
+  base::WeakPtrFactory<MainThreadMonitor> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_MAIN_THREAD_MONITOR_H_
@@ -5,6 +5,7 @@
 
 #include "shell/browser/microtasks_runner.h"
 
+#include "shell/browser/main_thread_monitor.h"
 #include "shell/common/node_includes.h"
 #include "v8/include/v8.h"
 
@@ -26,6 +27,8 @@ void MicrotasksRunner::DidProcessTask(const base::PendingTask& pending_task) {
   // up Node.js delaying its callbacks. To fix this, now we always lets Node.js
   // handle the checkpoint in the browser process.
   {
+    MainThreadMonitor::Section section(
+        MainThreadMonitor::Origin::kMicrotaskCheckpoint);
     v8::HandleScope handle_scope(isolate_);
     node::CallbackScope microtasks_scope(isolate_, v8::Object::New(isolate_),
                                          {0, 0});
@@ -0,0 +1,31 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_NET_NETWORK_STATISTICS_H_
+#define ELECTRON_SHELL_BROWSER_NET_NETWORK_STATISTICS_H_
+
+#include <cstdint>
+
+#include "base/time/time.h"
+
+namespace electron {
+
+// Aggregate counters for the requests a session has made from the main
+// process through `net.request` / `net.fetch`. Updated by
+// SimpleURLLoaderWrapper when a request completes; exposed to JS via
+// `session.getNetworkStatistics()`.
+struct NetworkStatistics {
+  uint64_t requests = 0;
+  uint64_t failed_requests = 0;
+  uint64_t cache_hits = 0;
+  uint64_t reused_connections = 0;
+  uint64_t encoded_bytes_received = 0;
+  uint64_t decoded_bytes_received = 0;
+  base::TimeDelta total_duration;
+  base::TimeDelta total_time_to_first_byte;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_NET_NETWORK_STATISTICS_H_
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/page_capture_encoder.h"
+
+#include <utility>
+
+#include "base/compiler_specific.h"
+#include "base/containers/span.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
+#include "base/hash/hash.h"
+#include "base/task/thread_pool.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImageInfo.h"
+#include "ui/gfx/codec/jpeg_codec.h"
+#include "ui/gfx/codec/png_codec.h"
+#include "ui/gfx/codec/webp_codec.h"
+
+namespace electron {
+
+namespace {
+
+size_t FingerprintBitmap(const SkBitmap& bitmap) {
+  size_t hash = base::HashInts(bitmap.width(), bitmap.height());
+  const size_t row_bytes = bitmap.info().minRowBytes();
+  for (int y = 0; y < bitmap.height(); ++y) {
+    const auto row = UNSAFE_BUFFERS(base::span(
+        static_cast<const uint8_t*>(bitmap.getAddr(0, y)), row_bytes));
+    hash = base::HashInts(hash, base::FastHash(row));
+  }
+  return hash;
+}
+
+std::optional<std::vector<uint8_t>> Encode(const SkBitmap& bitmap,
+                                           PageCaptureFormat format,
+                                           int quality) {
+  switch (format) {
+    case PageCaptureFormat::kPNG:
+      return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap,
+                                               /*discard_transparency=*/false);
+    case PageCaptureFormat::kJPEG:
+      return gfx::JPEGCodec::Encode(bitmap, quality);
+    case PageCaptureFormat::kWebP:
+      return gfx::WebpCodec::Encode(bitmap, quality);
+    case PageCaptureFormat::kBGRA: {
+      const SkImageInfo info = SkImageInfo::Make(
+          bitmap.dimensions(), kBGRA_8888_SkColorType, kPremul_SkAlphaType);
+      std::vector<uint8_t> pixels(info.computeMinByteSize());
+      if (!bitmap.readPixels(info, pixels.data(), info.minRowBytes(), 0, 0))
+        return std::nullopt;
+      return pixels;
+    }
+  }
+}
+
+PageCaptureEncodeResult EncodeOnThreadPool(const SkBitmap& bitmap,
+                                           PageCaptureEncodeRequest request) {
+  PageCaptureEncodeResult result;
+  if (request.fingerprint) {
+    result.fingerprint = FingerprintBitmap(bitmap);
+    result.changed = request.previous_fingerprint != result.fingerprint;
+  }
+  if (!result.changed || !request.format)
+    return result;
+
+  std::optional<std::vector<uint8_t>> encoded =
+      Encode(bitmap, *request.format, request.quality);
+  result.succeeded = encoded.has_value();
+  if (encoded)
+    result.data = std::move(*encoded);
+  return result;
+}
+
+}  // namespace
+
+PageCaptureEncodeRequest::PageCaptureEncodeRequest() = default;
+PageCaptureEncodeRequest::PageCaptureEncodeRequest(
+    PageCaptureEncodeRequest&&) = default;
+PageCaptureEncodeRequest& PageCaptureEncodeRequest::operator=(
+    PageCaptureEncodeRequest&&) = default;
+PageCaptureEncodeRequest::~PageCaptureEncodeRequest() = default;
+
+PageCaptureEncodeResult::PageCaptureEncodeResult() = default;
+PageCaptureEncodeResult::PageCaptureEncodeResult(PageCaptureEncodeResult&&) =
+    default;
+PageCaptureEncodeResult& PageCaptureEncodeResult::operator=(
+    PageCaptureEncodeResult&&) = default;
+PageCaptureEncodeResult::~PageCaptureEncodeResult() = default;
+
+void EncodePageCapture(
+    const SkBitmap& bitmap,
+    PageCaptureEncodeRequest request,
+    base::OnceCallback<void(PageCaptureEncodeResult)> callback) {
+  // SkBitmap shares its pixels, so the copy bound here is cheap; marking it
+  // immutable makes handing it to another sequence safe.
+  SkBitmap shared = bitmap;
+  shared.setImmutable();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&EncodeOnThreadPool, std::move(shared),
+                     std::move(request)),
+      std::move(callback));
+}
+
+}  // namespace electron
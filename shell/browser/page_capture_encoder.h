@@ -0,0 +1,64 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_PAGE_CAPTURE_ENCODER_H_
+#define ELECTRON_SHELL_BROWSER_PAGE_CAPTURE_ENCODER_H_
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "base/functional/callback_forward.h"
+
+class SkBitmap;
+
+namespace electron {
+
+enum class PageCaptureFormat {
+  kPNG,
+  kJPEG,
+  kWebP,
+  // Raw premultiplied BGRA pixels, 4 bytes per pixel without row padding.
+  kBGRA,
+};
+
+struct PageCaptureEncodeRequest {
+  PageCaptureEncodeRequest();
+  PageCaptureEncodeRequest(PageCaptureEncodeRequest&&);
+  PageCaptureEncodeRequest& operator=(PageCaptureEncodeRequest&&);
+  ~PageCaptureEncodeRequest();
+
+  // When unset the bitmap is only fingerprinted.
+  std::optional<PageCaptureFormat> format;
+  // Used for kJPEG and kWebP, 0 - 100.
+  int quality = 90;
+  // Whether to fingerprint the bitmap for change detection. Encoding is
+  // skipped when the fingerprint equals |previous_fingerprint|.
+  bool fingerprint = false;
+  std::optional<size_t> previous_fingerprint;
+};
+
+struct PageCaptureEncodeResult {
+  PageCaptureEncodeResult();
+  PageCaptureEncodeResult(PageCaptureEncodeResult&&);
+  PageCaptureEncodeResult& operator=(PageCaptureEncodeResult&&);
+  ~PageCaptureEncodeResult();
+
+  size_t fingerprint = 0;
+  bool changed = true;
+  bool succeeded = true;
+  std::vector<uint8_t> data;
+};
+
+// Fingerprints and encodes a captured |bitmap| on the thread pool, so that
+// large captures do not block the UI thread, and replies on the calling
+// sequence.
+void EncodePageCapture(
+    const SkBitmap& bitmap,
+    PageCaptureEncodeRequest request,
+    base::OnceCallback<void(PageCaptureEncodeResult)> callback);
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_PAGE_CAPTURE_ENCODER_H_
@@ -8,8 +8,11 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
 #include "base/functional/bind.h"
 #include "base/memory/ref_counted_memory.h"
+#include "base/task/thread_pool.h"
 #include "base/values.h"
 #include "components/printing/browser/print_to_pdf/pdf_print_result.h"
 #include "components/printing/browser/print_to_pdf/pdf_print_utils.h"
@@ -45,13 +48,32 @@ constexpr char kFooterTemplate[] = "footerTemplate";
 constexpr char kPreferCSSPageSize[] = "preferCSSPageSize";
 constexpr char kGenerateTaggedPDF[] = "generateTaggedPDF";
 constexpr char kGenerateDocumentOutline[] = "generateDocumentOutline";
+constexpr char kOutputPath[] = "outputPath";
 
 std::string FindStringOrEmpty(const base::DictValue& dict, const char* key) {
   const std::string* value = dict.FindString(key);
   return value ? *value : std::string();
 }
 
+void OnPDFWritten(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                  size_t size,
+                  bool success) {
+  if (!success) {
+    promise.RejectWithErrorMessage("Failed to write PDF");
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  promise.Resolve(v8::Number::New(isolate, static_cast<double>(size)));
+}
+
 void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                  std::optional<base::FilePath> output_path,
                   print_to_pdf::PdfPrintResult print_result,
                   scoped_refptr<base::RefCountedMemory> data) {
   if (print_result != print_to_pdf::PdfPrintResult::kPrintSuccess) {
@@ -61,6 +83,22 @@ void OnPDFCreated(gin_helper::Promise<v8::Local<v8::Value>> promise,
     return;
   }
 
+  if (output_path) {
+    // Write straight from the mapped PDF data, so large documents never get
+    // copied into the JS heap.
+    const size_t size = data->size();
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(
+            [](const base::FilePath& path,
+               scoped_refptr<base::RefCountedMemory> data) {
+              return base::WriteFile(path, *data);
+            },
+            std::move(*output_path), std::move(data)),
+        base::BindOnce(&OnPDFWritten, std::move(promise), size));
+    return;
+  }
+
   v8::Isolate* isolate = promise.isolate();
   gin_helper::Locker locker(isolate);
   v8::HandleScope handle_scope(isolate);
@@ -103,6 +141,9 @@ v8::Local<v8::Promise> PrintFrameToPDF(content::RenderFrameHost* rfh,
   auto prefer_css_page_size = dict.FindBool(kPreferCSSPageSize);
   auto generate_tagged_pdf = dict.FindBool(kGenerateTaggedPDF);
   auto generate_document_outline = dict.FindBool(kGenerateDocumentOutline);
+  std::optional<base::FilePath> output_path;
+  if (const std::string* path = dict.FindString(kOutputPath))
+    output_path = base::FilePath::FromUTF8Unsafe(*path);
 
   absl::variant<printing::mojom::PrintPagesParamsPtr, std::string>
       print_pages_params = print_to_pdf::GetPrintPagesParams(
@@ -131,7 +172,8 @@ v8::Local<v8::Promise> PrintFrameToPDF(content::RenderFrameHost* rfh,
   params->params->document_cookie = unique_id.value_or(0);
 
   manager->PrintToPdf(rfh, page_ranges, std::move(params),
-                      base::BindOnce(&OnPDFCreated, std::move(promise)));
+                      base::BindOnce(&OnPDFCreated, std::move(promise),
+                                     std::move(output_path)));
 
   return handle;
 }
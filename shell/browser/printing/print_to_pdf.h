@@ -19,7 +19,8 @@ namespace electron {
 
 // Prints the current document of |rfh| to a PDF, per the printToPDF settings
 // dict built in lib/browser/print-to-pdf.ts. Returns a promise that resolves
-// with the PDF data as a Buffer.
+// with the PDF data as a Buffer, or, when the settings have an `outputPath`,
+// with the number of bytes written to that file.
 v8::Local<v8::Promise> PrintFrameToPDF(content::RenderFrameHost* rfh,
                                        const base::Value& settings);
 
@@ -0,0 +1,695 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/ui/devtools_file_system_index.h"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "base/containers/contains.h"
+#include "base/containers/span.h"
+#include "base/files/file.h"
+#include "base/files/file_enumerator.h"
+#include "base/files/file_path_watcher.h"
+#include "base/files/file_util.h"
+#include "base/files/important_file_writer.h"
+#include "base/functional/bind.h"
+#include "base/hash/hash.h"
+#include "base/pickle.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/bind_post_task.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace electron {
+
+namespace {
+
+// Bump when the on-disk format changes, older indexes are then rebuilt.
+constexpr uint32_t kIndexVersion = 1;
+
+// Characters trigrams are made of, matched case-insensitively. Any other
+// character ends a trigram in files and queries alike, so the choice only
+// affects how selective the index is, never whether a file is found.
+constexpr std::string_view kTrigramChars =
+    "abcdefghijklmnopqrstuvwxyz0123456789_$";
+constexpr size_t kTrigramCharCount = kTrigramChars.size();
+constexpr size_t kTrigramCount =
+    kTrigramCharCount * kTrigramCharCount * kTrigramCharCount;
+
+constexpr auto kTrigramCharIndex = [] {
+  std::array<int8_t, 256> table;
+  table.fill(-1);
+  for (size_t i = 0; i < kTrigramCharCount; ++i) {
+    const auto c = static_cast<uint8_t>(kTrigramChars[i]);
+    table[c] = static_cast<int8_t>(i);
+    if (c >= 'a' && c <= 'z')
+      table[c - 'a' + 'A'] = static_cast<int8_t>(i);
+  }
+  return table;
+}();
+
+// Files above this size are not read and match every query.
+constexpr int64_t kMaxIndexedFileSize = 16 * 1024 * 1024;
+constexpr size_t kReadBufferSize = 64 * 1024;
+// Progress is reported to the frontend in steps of this many files.
+constexpr int kWorkedBatchSize = 100;
+
+// Batches file change notifications, a checkout or build touches many
+// files at once.
+constexpr base::TimeDelta kChangeDelay = base::Milliseconds(500);
+constexpr base::TimeDelta kSaveDelay = base::Seconds(10);
+
+constexpr uint32_t kRemovedFile = UINT32_MAX;
+
+// Sliding window over a character stream that yields its trigrams.
+class TrigramWindow {
+ public:
+  template <typename Callback>
+  void Push(uint8_t c, Callback&& callback) {
+    const int index = kTrigramCharIndex[c];
+    if (index < 0) {
+      first_ = second_ = -1;
+      return;
+    }
+    if (first_ >= 0) {
+      callback(static_cast<uint32_t>(
+          (first_ * kTrigramCharCount + second_) * kTrigramCharCount + index));
+    }
+    first_ = second_;
+    second_ = index;
+  }
+
+ private:
+  int first_ = -1;
+  int second_ = -1;
+};
+
+// Ascending file ids, delta and varint encoded so that an entry usually
+// takes one byte instead of four.
+class PostingList {
+ public:
+  size_t size() const { return size_; }
+  const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+  void Append(uint32_t id) {
+    uint32_t delta = id - last_;
+    while (delta >= 0x80) {
+      bytes_.push_back(static_cast<uint8_t>(delta) | 0x80);
+      delta >>= 7;
+    }
+    bytes_.push_back(static_cast<uint8_t>(delta));
+    last_ = id;
+    ++size_;
+  }
+
+  template <typename Callback>
+  void ForEach(Callback&& callback) const {
+    uint32_t id = 0;
+    uint32_t delta = 0;
+    int shift = 0;
+    for (const uint8_t byte : bytes_) {
+      delta |= static_cast<uint32_t>(byte & 0x7f) << shift;
+      if (byte & 0x80) {
+        shift += 7;
+        continue;
+      }
+      id += delta;
+      callback(id);
+      delta = 0;
+      shift = 0;
+    }
+  }
+
+  // Takes over encoded |bytes| read from disk, which must only reference
+  // ids below |file_count|.
+  bool Assign(base::span<const uint8_t> bytes, uint32_t file_count) {
+    bytes_.assign(bytes.begin(), bytes.end());
+    last_ = 0;
+    size_ = 0;
+    bool valid = bytes_.empty() || !(bytes_.back() & 0x80);
+    ForEach([&](uint32_t id) {
+      valid &= id < file_count && (size_ == 0 || id > last_);
+      last_ = id;
+      ++size_;
+    });
+    return valid;
+  }
+
+ private:
+  std::vector<uint8_t> bytes_;
+  uint32_t last_ = 0;
+  uint32_t size_ = 0;
+};
+
+}  // namespace
+
+// The index of one folder. Lives on a blocking sequence of its own, so
+// indexing a large folder does not hold up searches in other folders.
+class DevToolsFolderIndex {
+ public:
+  DevToolsFolderIndex(
+      base::FilePath root,
+      base::FilePath index_file,
+      scoped_refptr<DevToolsFileSystemIndex::IndexingJob> lifetime)
+      : root_(std::move(root)),
+        index_file_(std::move(index_file)),
+        lifetime_(std::move(lifetime)) {}
+  // Runs when the browser context goes away, which may be on shutdown, so the
+  // changes seen since the last save are not lost.
+  ~DevToolsFolderIndex() { Save(); }
+
+  // disable copy
+  DevToolsFolderIndex(const DevToolsFolderIndex&) = delete;
+  DevToolsFolderIndex& operator=(const DevToolsFolderIndex&) = delete;
+
+  void Update(
+      std::vector<base::FilePath> excluded_folders,
+      scoped_refptr<DevToolsFileSystemIndex::IndexingJob> job,
+      DevToolsFileSystemIndex::TotalWorkCallback total_work_callback,
+      DevToolsFileSystemIndex::WorkedCallback worked_callback) {
+    EnsureLoaded();
+    excluded_folders_ = std::move(excluded_folders);
+    Refresh(root_, job.get(), total_work_callback, worked_callback);
+    Save();
+    Watch();
+  }
+
+  std::vector<std::string> Search(const std::string& query) {
+    EnsureLoaded();
+
+    std::vector<uint32_t> trigrams;
+    TrigramWindow window;
+    for (const char c : query) {
+      window.Push(static_cast<uint8_t>(c), [&](uint32_t trigram) {
+        if (!base::Contains(trigrams, trigram))
+          trigrams.push_back(trigram);
+      });
+    }
+
+    std::vector<uint32_t> matches;
+    if (trigrams.empty()) {
+      for (uint32_t id = 0; id < files_.size(); ++id)
+        matches.push_back(id);
+    } else {
+      // Intersect starting from the rarest trigram.
+      std::ranges::sort(trigrams, {}, [this](uint32_t trigram) {
+        return postings_[trigram].size();
+      });
+      postings_[trigrams.front()].ForEach(
+          [&](uint32_t id) { matches.push_back(id); });
+      for (size_t i = 1; i < trigrams.size() && !matches.empty(); ++i) {
+        std::vector<uint32_t> remaining;
+        auto match = matches.begin();
+        postings_[trigrams[i]].ForEach([&](uint32_t id) {
+          while (match != matches.end() && *match < id)
+            ++match;
+          if (match != matches.end() && *match == id)
+            remaining.push_back(id);
+        });
+        matches = std::move(remaining);
+      }
+      for (uint32_t id = 0; id < files_.size(); ++id) {
+        if (!files_[id].indexed)
+          matches.push_back(id);
+      }
+    }
+
+    std::vector<std::string> result;
+    for (const uint32_t id : matches) {
+      if (files_[id].live)
+        result.push_back(GetFullPath(files_[id]).AsUTF8Unsafe());
+    }
+    return result;
+  }
+
+ private:
+  struct FileEntry {
+    // Relative to |root_|.
+    std::string path;
+    base::Time last_modified;
+    int64_t size = 0;
+    // Removed entries stay in the posting lists until the next compaction.
+    bool live = true;
+    // Files that were not read are in no posting list and match any query.
+    bool indexed = true;
+  };
+
+  struct FoundFile {
+    base::FilePath path;
+    base::Time last_modified;
+    int64_t size = 0;
+  };
+
+  void EnsureLoaded() {
+    if (loaded_)
+      return;
+    loaded_ = true;
+    if (!index_file_.empty() && !Load()) {
+      files_.clear();
+      ids_.clear();
+      postings_ = std::vector<PostingList>(kTrigramCount);
+    }
+  }
+
+  bool Load() {
+    std::string contents;
+    if (!base::ReadFileToString(index_file_, &contents))
+      return false;
+
+    base::Pickle pickle =
+        base::Pickle::WithUnownedBuffer(base::as_byte_span(contents));
+    base::PickleIterator iter(pickle);
+    uint32_t version = 0;
+    std::string root;
+    uint32_t file_count = 0;
+    if (!iter.ReadUInt32(&version) || version != kIndexVersion ||
+        !iter.ReadString(&root) || root != root_.AsUTF8Unsafe() ||
+        !iter.ReadUInt32(&file_count)) {
+      return false;
+    }
+
+    files_.resize(file_count);
+    for (uint32_t id = 0; id < file_count; ++id) {
+      FileEntry& entry = files_[id];
+      int64_t last_modified = 0;
+      if (!iter.ReadString(&entry.path) || !iter.ReadInt64(&last_modified) ||
+          !iter.ReadInt64(&entry.size) || !iter.ReadBool(&entry.indexed) ||
+          !ids_.emplace(entry.path, id).second) {
+        return false;
+      }
+      entry.last_modified = base::Time::FromDeltaSinceWindowsEpoch(
+          base::Microseconds(last_modified));
+    }
+    for (PostingList& list : postings_) {
+      std::string_view bytes;
+      if (!iter.ReadStringPiece(&bytes) ||
+          !list.Assign(base::as_byte_span(bytes), file_count)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void Save() {
+    save_timer_.Stop();
+    if (index_file_.empty() || !modified_)
+      return;
+    Compact();
+
+    base::Pickle pickle;
+    pickle.WriteUInt32(kIndexVersion);
+    pickle.WriteString(root_.AsUTF8Unsafe());
+    pickle.WriteUInt32(static_cast<uint32_t>(files_.size()));
+    for (const FileEntry& entry : files_) {
+      pickle.WriteString(entry.path);
+      pickle.WriteInt64(
+          entry.last_modified.ToDeltaSinceWindowsEpoch().InMicroseconds());
+      pickle.WriteInt64(entry.size);
+      pickle.WriteBool(entry.indexed);
+    }
+    for (const PostingList& list : postings_)
+      pickle.WriteData(base::as_string_view(list.bytes()));
+
+    if (base::CreateDirectory(index_file_.DirName()) &&
+        base::ImportantFileWriter::WriteFileAtomically(
+            index_file_, base::as_string_view(pickle.data_as_span()))) {
+      modified_ = false;
+    }
+  }
+
+  void ScheduleSave() {
+    if (!index_file_.empty() && !save_timer_.IsRunning()) {
+      save_timer_.Start(FROM_HERE, kSaveDelay, this,
+                        &DevToolsFolderIndex::Save);
+    }
+  }
+
+  bool IsExcluded(const base::FilePath& path) const {
+    return std::ranges::any_of(excluded_folders_, [&](const auto& folder) {
+      return folder == path || folder.IsParent(path);
+    });
+  }
+
+  // Whether to give up on the work for |job|, or all work as the index is
+  // going away.
+  bool IsStopped(const DevToolsFileSystemIndex::IndexingJob* job) const {
+    return lifetime_->IsStopped() || (job && job->IsStopped());
+  }
+
+  base::FilePath GetFullPath(const FileEntry& entry) const {
+    return root_.Append(base::FilePath::FromUTF8Unsafe(entry.path));
+  }
+
+  // Collects the files in |path|, or |path| itself if it is a file. Returns
+  // false if |job| was stopped.
+  bool CollectFiles(const base::FilePath& path,
+                    const DevToolsFileSystemIndex::IndexingJob* job,
+                    std::vector<FoundFile>* files) const {
+    base::File::Info info;
+    if (IsExcluded(path) || !base::GetFileInfo(path, &info))
+      return true;
+    if (!info.is_directory) {
+      files->push_back({path, info.last_modified, info.size});
+      return true;
+    }
+
+    std::vector<base::FilePath> pending_dirs = {path};
+    while (!pending_dirs.empty()) {
+      if (IsStopped(job))
+        return false;
+      base::FileEnumerator enumerator(
+          pending_dirs.back(), /*recursive=*/false,
+          base::FileEnumerator::FILES | base::FileEnumerator::DIRECTORIES);
+      pending_dirs.pop_back();
+      for (base::FilePath child = enumerator.Next(); !child.empty();
+           child = enumerator.Next()) {
+        if (IsExcluded(child))
+          continue;
+        const base::FileEnumerator::FileInfo child_info = enumerator.GetInfo();
+        if (child_info.IsDirectory()) {
+          // Symlinked folders are skipped, they may form cycles.
+          if (!base::IsLink(child))
+            pending_dirs.push_back(std::move(child));
+          continue;
+        }
+        files->push_back(
+            {child, child_info.GetLastModifiedTime(), child_info.GetSize()});
+      }
+    }
+    return true;
+  }
+
+  // Reads the files in |path| that are new or have changed since they were
+  // indexed, and drops the ones that are gone.
+  void Refresh(const base::FilePath& path,
+               const DevToolsFileSystemIndex::IndexingJob* job,
+               const DevToolsFileSystemIndex::TotalWorkCallback& total_work,
+               const DevToolsFileSystemIndex::WorkedCallback& worked) {
+    std::vector<FoundFile> found;
+    if (!CollectFiles(path, job, &found))
+      return;
+
+    std::vector<bool> present(files_.size());
+    std::vector<const FoundFile*> changed;
+    for (const FoundFile& file : found) {
+      auto it = ids_.find(GetRelativePath(file.path));
+      if (it != ids_.end()) {
+        present[it->second] = true;
+        const FileEntry& entry = files_[it->second];
+        if (entry.last_modified == file.last_modified &&
+            entry.size == file.size) {
+          continue;
+        }
+      }
+      changed.push_back(&file);
+    }
+
+    for (uint32_t id = 0; id < present.size(); ++id) {
+      if (!files_[id].live || present[id])
+        continue;
+      const base::FilePath full_path = GetFullPath(files_[id]);
+      if (path == root_ || path == full_path || path.IsParent(full_path))
+        RemoveFile(id);
+    }
+
+    if (total_work)
+      total_work.Run(static_cast<int>(changed.size()));
+    int unreported = 0;
+    for (const FoundFile* file : changed) {
+      if (IsStopped(job))
+        break;
+      AddFile(*file);
+      if (++unreported == kWorkedBatchSize && worked) {
+        worked.Run(unreported);
+        unreported = 0;
+      }
+    }
+    if (unreported && worked)
+      worked.Run(unreported);
+
+    // Without a file to save to, compact once half the entries are stale.
+    if (index_file_.empty() && removed_count_ > ids_.size())
+      Compact();
+  }
+
+  std::string GetRelativePath(const base::FilePath& path) const {
+    base::FilePath relative;
+    root_.AppendRelativePath(path, &relative);
+    return relative.AsUTF8Unsafe();
+  }
+
+  void AddFile(const FoundFile& file) {
+    std::string relative_path = GetRelativePath(file.path);
+    if (auto it = ids_.find(relative_path); it != ids_.end())
+      RemoveFile(it->second);
+
+    const auto id = static_cast<uint32_t>(files_.size());
+    FileEntry& entry = files_.emplace_back();
+    entry.path = std::move(relative_path);
+    entry.last_modified = file.last_modified;
+    entry.size = file.size;
+    entry.indexed =
+        file.size <= kMaxIndexedFileSize && ReadTrigrams(file.path);
+    ids_.emplace(entry.path, id);
+    modified_ = true;
+
+    for (const uint32_t trigram : trigrams_) {
+      if (entry.indexed)
+        postings_[trigram].Append(id);
+      seen_trigrams_.reset(trigram);
+    }
+    trigrams_.clear();
+  }
+
+  // Collects the distinct trigrams of the file at |path| into |trigrams_|.
+  bool ReadTrigrams(const base::FilePath& path) {
+    base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+    if (!file.IsValid())
+      return false;
+
+    read_buffer_.resize(kReadBufferSize);
+    TrigramWindow window;
+    while (true) {
+      const std::optional<size_t> read = file.ReadAtCurrentPos(read_buffer_);
+      if (!read)
+        return false;
+      if (*read == 0)
+        return true;
+      for (const uint8_t c : base::span(read_buffer_).first(*read)) {
+        window.Push(c, [this](uint32_t trigram) {
+          if (!seen_trigrams_.test(trigram)) {
+            seen_trigrams_.set(trigram);
+            trigrams_.push_back(trigram);
+          }
+        });
+      }
+    }
+  }
+
+  void RemoveFile(uint32_t id) {
+    FileEntry& entry = files_[id];
+    ids_.erase(entry.path);
+    entry.live = false;
+    ++removed_count_;
+    modified_ = true;
+  }
+
+  // Drops removed entries and renumbers the remaining ones.
+  void Compact() {
+    if (!removed_count_)
+      return;
+
+    std::vector<uint32_t> new_ids(files_.size(), kRemovedFile);
+    std::vector<FileEntry> files;
+    files.reserve(ids_.size());
+    for (uint32_t id = 0; id < files_.size(); ++id) {
+      if (!files_[id].live)
+        continue;
+      new_ids[id] = static_cast<uint32_t>(files.size());
+      files.push_back(std::move(files_[id]));
+    }
+    for (PostingList& list : postings_) {
+      PostingList compacted;
+      list.ForEach([&](uint32_t id) {
+        if (new_ids[id] != kRemovedFile)
+          compacted.Append(new_ids[id]);
+      });
+      list = std::move(compacted);
+    }
+
+    files_ = std::move(files);
+    ids_.clear();
+    for (uint32_t id = 0; id < files_.size(); ++id)
+      ids_.emplace(files_[id].path, id);
+    removed_count_ = 0;
+  }
+
+  void Watch() {
+    if (watcher_)
+      return;
+    watcher_ = std::make_unique<base::FilePathWatcher>();
+    // Without a watcher the index is only refreshed when DevTools asks.
+    if (!watcher_->WatchWithOptions(
+            root_,
+            {.type = base::FilePathWatcher::Type::kRecursive,
+             .report_modified_path = true},
+            base::BindRepeating(&DevToolsFolderIndex::OnPathChanged,
+                                base::Unretained(this)))) {
+      watcher_.reset();
+    }
+  }
+
+  void OnPathChanged(const base::FilePath& path, bool error) {
+    // Excluded folders such as node_modules churn during installs and builds,
+    // and are never indexed anyway.
+    if (!error && IsExcluded(path))
+      return;
+    // Not every platform reports which file changed, rescan everything then.
+    changed_paths_.insert(error || path.empty() ? root_ : path);
+    if (!change_timer_.IsRunning()) {
+      change_timer_.Start(FROM_HERE, kChangeDelay, this,
+                          &DevToolsFolderIndex::ProcessChanges);
+    }
+  }
+
+  void ProcessChanges() {
+    std::set<base::FilePath> paths = std::move(changed_paths_);
+    changed_paths_.clear();
+    if (paths.contains(root_)) {
+      Refresh(root_, nullptr, {}, {});
+    } else {
+      for (const base::FilePath& path : paths) {
+        if (IsStopped(nullptr))
+          break;
+        Refresh(path, nullptr, {}, {});
+      }
+    }
+    if (modified_)
+      ScheduleSave();
+  }
+
+  const base::FilePath root_;
+  const base::FilePath index_file_;
+  // Stopped once the DevToolsFileSystemIndex is destroyed.
+  const scoped_refptr<DevToolsFileSystemIndex::IndexingJob> lifetime_;
+  std::vector<base::FilePath> excluded_folders_;
+
+  bool loaded_ = false;
+  // Whether there are changes that have not been saved yet.
+  bool modified_ = false;
+  std::vector<FileEntry> files_;
+  // Ids of the live entries by path.
+  std::unordered_map<std::string, uint32_t> ids_;
+  std::vector<PostingList> postings_ = std::vector<PostingList>(kTrigramCount);
+  size_t removed_count_ = 0;
+
+  // Scratch state for ReadTrigrams().
+  std::vector<uint8_t> read_buffer_;
+  std::vector<uint32_t> trigrams_;
+  std::bitset<kTrigramCount> seen_trigrams_;
+
+  std::unique_ptr<base::FilePathWatcher> watcher_;
+  std::set<base::FilePath> changed_paths_;
+  base::OneShotTimer change_timer_;
+  base::OneShotTimer save_timer_;
+};
+
+DevToolsFileSystemIndex::IndexingJob::IndexingJob() = default;
+
+DevToolsFileSystemIndex::IndexingJob::~IndexingJob() = default;
+
+void DevToolsFileSystemIndex::IndexingJob::Stop() {
+  stopped_.Set();
+}
+
+bool DevToolsFileSystemIndex::IndexingJob::IsStopped() const {
+  return stopped_.IsSet();
+}
+
+DevToolsFileSystemIndex::DevToolsFileSystemIndex(base::FilePath storage_dir)
+    : storage_dir_(std::move(storage_dir)),
+      lifetime_(base::MakeRefCounted<IndexingJob>()) {}
+
+DevToolsFileSystemIndex::~DevToolsFileSystemIndex() {
+  // Cut short any indexing in progress, so that the folder indexes, which
+  // block shutdown to save their changes, are destroyed promptly.
+  lifetime_->Stop();
+}
+
+scoped_refptr<DevToolsFileSystemIndex::IndexingJob>
+DevToolsFileSystemIndex::IndexPath(
+    const std::string& file_system_path,
+    const std::vector<std::string>& excluded_folders,
+    TotalWorkCallback total_work_callback,
+    WorkedCallback worked_callback,
+    DoneCallback done_callback) {
+  const auto root = base::FilePath::FromUTF8Unsafe(file_system_path);
+
+  std::vector<base::FilePath> excluded_paths;
+  for (std::string_view folder : excluded_folders) {
+    auto path = base::FilePath::FromUTF8Unsafe(folder);
+    if (!path.IsAbsolute()) {
+      while (!folder.empty() && base::FilePath::IsSeparator(folder.front()))
+        folder.remove_prefix(1);
+      path = root.Append(base::FilePath::FromUTF8Unsafe(folder));
+    }
+    excluded_paths.push_back(path.StripTrailingSeparators());
+  }
+
+  auto job = base::MakeRefCounted<IndexingJob>();
+  GetFolderIndex(root)
+      .AsyncCall(&DevToolsFolderIndex::Update)
+      .WithArgs(std::move(excluded_paths), job,
+                base::BindPostTaskToCurrentDefault(
+                    std::move(total_work_callback)),
+                base::BindPostTaskToCurrentDefault(std::move(worked_callback)))
+      .Then(base::BindOnce(
+          [](scoped_refptr<IndexingJob> job, DoneCallback done_callback) {
+            if (!job->IsStopped())
+              std::move(done_callback).Run();
+          },
+          job, std::move(done_callback)));
+  return job;
+}
+
+void DevToolsFileSystemIndex::SearchInPath(const std::string& file_system_path,
+                                           const std::string& query,
+                                           SearchCallback callback) {
+  GetFolderIndex(base::FilePath::FromUTF8Unsafe(file_system_path))
+      .AsyncCall(&DevToolsFolderIndex::Search)
+      .WithArgs(query)
+      .Then(std::move(callback));
+}
+
+base::SequenceBound<DevToolsFolderIndex>&
+DevToolsFileSystemIndex::GetFolderIndex(const base::FilePath& path) {
+  auto it = folders_.find(path);
+  if (it == folders_.end()) {
+    base::FilePath index_file;
+    if (!storage_dir_.empty()) {
+      index_file = storage_dir_.AppendASCII(
+          base::NumberToString(base::PersistentHash(path.AsUTF8Unsafe())));
+    }
+    auto task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+        {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+         base::TaskShutdownBehavior::BLOCK_SHUTDOWN});
+    it = folders_
+             .try_emplace(path, std::move(task_runner), path,
+                          std::move(index_file), lifetime_)
+             .first;
+  }
+  return it->second;
+}
+
+}  // namespace electron
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_FILE_SYSTEM_INDEX_H_
+#define ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_FILE_SYSTEM_INDEX_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/ref_counted.h"
+#include "base/synchronization/atomic_flag.h"
+#include "base/threading/sequence_bound.h"
+
+namespace electron {
+
+class DevToolsFolderIndex;
+
+// Trigram index of the files in DevTools workspace folders, which lets
+// "Search in all files" skip files that cannot contain the query.
+//
+// Unlike chrome's DevToolsFileSystemIndexer, which every frontend rebuilds
+// from scratch, one index per folder is shared by all DevTools frontends of a
+// browser context. It is persisted under |storage_dir| and kept current by
+// watching the folder, so indexing a folder again only reads the files whose
+// size or modification time changed since.
+class DevToolsFileSystemIndex {
+ public:
+  class IndexingJob : public base::RefCountedThreadSafe<IndexingJob> {
+   public:
+    IndexingJob();
+
+    // disable copy
+    IndexingJob(const IndexingJob&) = delete;
+    IndexingJob& operator=(const IndexingJob&) = delete;
+
+    void Stop();
+    bool IsStopped() const;
+
+   private:
+    friend class base::RefCountedThreadSafe<IndexingJob>;
+    ~IndexingJob();
+
+    base::AtomicFlag stopped_;
+  };
+
+  using TotalWorkCallback = base::RepeatingCallback<void(int)>;
+  using WorkedCallback = base::RepeatingCallback<void(int)>;
+  using DoneCallback = base::OnceClosure;
+  using SearchCallback =
+      base::OnceCallback<void(const std::vector<std::string>&)>;
+
+  // Indexes are kept in memory only when |storage_dir| is empty.
+  explicit DevToolsFileSystemIndex(base::FilePath storage_dir);
+  ~DevToolsFileSystemIndex();
+
+  // disable copy
+  DevToolsFileSystemIndex(const DevToolsFileSystemIndex&) = delete;
+  DevToolsFileSystemIndex& operator=(const DevToolsFileSystemIndex&) = delete;
+
+  // Brings the index of |file_system_path| up to date. |total_work_callback|
+  // receives the number of files that have to be read, |worked_callback| the
+  // progress in between, and |done_callback| runs unless the job is stopped.
+  scoped_refptr<IndexingJob> IndexPath(
+      const std::string& file_system_path,
+      const std::vector<std::string>& excluded_folders,
+      TotalWorkCallback total_work_callback,
+      WorkedCallback worked_callback,
+      DoneCallback done_callback);
+
+  // Replies with the files of |file_system_path| that may contain |query|.
+  void SearchInPath(const std::string& file_system_path,
+                    const std::string& query,
+                    SearchCallback callback);
+
+ private:
+  base::SequenceBound<DevToolsFolderIndex>& GetFolderIndex(
+      const base::FilePath& path);
+
+  const base::FilePath storage_dir_;
+  // Stopped on destruction, which cancels the work of every folder index.
+  const scoped_refptr<IndexingJob> lifetime_;
+  std::map<base::FilePath, base::SequenceBound<DevToolsFolderIndex>> folders_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_UI_DEVTOOLS_FILE_SYSTEM_INDEX_H_
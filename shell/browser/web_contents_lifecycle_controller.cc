@@ -0,0 +1,249 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/browser/web_contents_lifecycle_controller.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/containers/flat_set.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "base/no_destructor.h"
+#include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+#include "content/public/browser/navigation_controller.h"
+#include "content/public/browser/navigation_handle.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/visibility.h"
+#include "content/public/browser/web_contents.h"
+
+namespace electron {
+
+namespace {
+
+using Controllers = base::flat_set<WebContentsLifecycleController*>;
+
+Controllers& GetControllers() {
+  static base::NoDestructor<Controllers> controllers;
+  return *controllers;
+}
+
+struct MemoryPressureMonitor {
+  uint64_t available_memory_threshold = 0;
+  base::RepeatingTimer timer;
+  bool check_pending = false;
+};
+
+MemoryPressureMonitor& GetMemoryPressureMonitor() {
+  static base::NoDestructor<MemoryPressureMonitor> monitor;
+  return *monitor;
+}
+
+}  // namespace
+
+WebContentsLifecycleController::WebContentsLifecycleController(
+    content::WebContents* web_contents,
+    StateChangedCallback state_changed)
+    : content::WebContentsObserver(web_contents),
+      state_changed_(std::move(state_changed)) {
+  if (!IsVisible()) {
+    state_ = State::kHidden;
+    hidden_since_ = base::TimeTicks::Now();
+  }
+  GetControllers().insert(this);
+}
+
+WebContentsLifecycleController::~WebContentsLifecycleController() {
+  GetControllers().erase(this);
+}
+
+// static
+void WebContentsLifecycleController::SetMemoryPressurePolicy(
+    std::optional<MemoryPressurePolicy> policy) {
+  auto& monitor = GetMemoryPressureMonitor();
+  if (!policy) {
+    monitor.timer.Stop();
+    return;
+  }
+  monitor.available_memory_threshold = policy->available_memory_threshold;
+  monitor.timer.Start(FROM_HERE, policy->check_interval,
+                      base::BindRepeating(&CheckMemoryPressure));
+}
+
+size_t WebContentsLifecycleController::CountPagesInProcess(
+    int process_id) const {
+  return static_cast<size_t>(std::ranges::count_if(
+      GetControllers(), [this, process_id](const auto* controller) {
+        if (controller == this || controller->state_ == State::kDiscarded ||
+            !controller->web_contents()) {
+          return false;
+        }
+        auto* rfh = controller->web_contents()->GetPrimaryMainFrame();
+        return rfh && rfh->GetProcess()->GetDeprecatedID() == process_id;
+      }));
+}
+
+void WebContentsLifecycleController::SetPolicy(const Policy& policy) {
+  policy_ = policy;
+  freeze_timer_.Stop();
+  MaybeStartFreezeTimer();
+}
+
+bool WebContentsLifecycleController::Freeze() {
+  if (state_ != State::kHidden || !CanFreezeOrDiscard())
+    return false;
+  freeze_timer_.Stop();
+  web_contents()->SetPageFrozen(true);
+  SetState(State::kFrozen);
+  return true;
+}
+
+bool WebContentsLifecycleController::Unfreeze() {
+  if (state_ != State::kFrozen || !web_contents())
+    return false;
+  web_contents()->SetPageFrozen(false);
+  // Give the page a full idle period before freezing it again.
+  hidden_since_ = base::TimeTicks::Now();
+  SetState(State::kHidden);
+  MaybeStartFreezeTimer();
+  return true;
+}
+
+bool WebContentsLifecycleController::Discard() {
+  if ((state_ != State::kHidden && state_ != State::kFrozen) ||
+      !CanFreezeOrDiscard()) {
+    return false;
+  }
+  freeze_timer_.Stop();
+  // Tears down the renderer-side page while the NavigationController keeps
+  // its entries, so the page can be restored with a reload.
+  web_contents()->Discard(base::DoNothing());
+  SetState(State::kDiscarded);
+  return true;
+}
+
+void WebContentsLifecycleController::OnVisibilityChanged(
+    content::Visibility visibility) {
+  if (visibility == content::Visibility::VISIBLE) {
+    freeze_timer_.Stop();
+    if (state_ == State::kFrozen) {
+      web_contents()->SetPageFrozen(false);
+    } else if (state_ == State::kDiscarded) {
+      auto& controller = web_contents()->GetController();
+      controller.SetNeedsReload();
+      controller.LoadIfNecessary();
+    }
+    SetState(State::kActive);
+    return;
+  }
+
+  if (state_ == State::kActive) {
+    hidden_since_ = base::TimeTicks::Now();
+    SetState(State::kHidden);
+    MaybeStartFreezeTimer();
+  }
+}
+
+void WebContentsLifecycleController::DidStartNavigation(
+    content::NavigationHandle* navigation_handle) {
+  // A discarded page comes back when it is reloaded or navigated while still
+  // hidden, too.
+  if (state_ != State::kDiscarded ||
+      !navigation_handle->IsInPrimaryMainFrame()) {
+    return;
+  }
+  if (IsVisible()) {
+    SetState(State::kActive);
+  } else {
+    hidden_since_ = base::TimeTicks::Now();
+    SetState(State::kHidden);
+    MaybeStartFreezeTimer();
+  }
+}
+
+bool WebContentsLifecycleController::IsVisible() const {
+  return web_contents() &&
+         web_contents()->GetVisibility() == content::Visibility::VISIBLE;
+}
+
+bool WebContentsLifecycleController::CanFreezeOrDiscard() const {
+  return web_contents() && !web_contents()->IsCurrentlyAudible() &&
+         !web_contents()->IsBeingCaptured();
+}
+
+void WebContentsLifecycleController::MaybeStartFreezeTimer() {
+  if (state_ != State::kHidden || !policy_.freeze_delay)
+    return;
+  const base::TimeDelta delay = std::max(
+      base::TimeDelta(),
+      hidden_since_ + *policy_.freeze_delay - base::TimeTicks::Now());
+  freeze_timer_.Start(
+      FROM_HERE, delay,
+      base::BindOnce(&WebContentsLifecycleController::OnFreezeTimer,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void WebContentsLifecycleController::OnFreezeTimer() {
+  if (Freeze() || state_ != State::kHidden || !policy_.freeze_delay)
+    return;
+  // Playing audio or being captured; try again after another idle period.
+  freeze_timer_.Start(
+      FROM_HERE, *policy_.freeze_delay,
+      base::BindOnce(&WebContentsLifecycleController::OnFreezeTimer,
+                     weak_factory_.GetWeakPtr()));
+}
+
+void WebContentsLifecycleController::SetState(State state) {
+  if (state == state_)
+    return;
+  const State old_state = std::exchange(state_, state);
+  if (state_changed_)
+    state_changed_.Run(state, old_state);
+}
+
+// static
+void WebContentsLifecycleController::CheckMemoryPressure() {
+  auto& monitor = GetMemoryPressureMonitor();
+  if (monitor.check_pending)
+    return;
+  monitor.check_pending = true;
+  // Reading the available memory can hit the file system on some platforms.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce([] {
+        return base::SysInfo::AmountOfAvailablePhysicalMemory();
+      }),
+      base::BindOnce(&OnAvailableMemory));
+}
+
+// static
+void WebContentsLifecycleController::OnAvailableMemory(
+    uint64_t available_bytes) {
+  auto& monitor = GetMemoryPressureMonitor();
+  monitor.check_pending = false;
+  if (!monitor.timer.IsRunning() ||
+      available_bytes >= monitor.available_memory_threshold) {
+    return;
+  }
+
+  // Discard one page per check, starting with the one hidden the longest,
+  // so that memory can be reclaimed before the next page goes.
+  WebContentsLifecycleController* candidate = nullptr;
+  for (auto* controller : GetControllers()) {
+    if (!controller->policy_.discardable ||
+        (controller->state_ != State::kHidden &&
+         controller->state_ != State::kFrozen) ||
+        !controller->CanFreezeOrDiscard()) {
+      continue;
+    }
+    if (!candidate || controller->hidden_since_ < candidate->hidden_since_)
+      candidate = controller;
+  }
+  if (candidate)
+    candidate->Discard();
+}
+
+}  // namespace electron
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_BROWSER_WEB_CONTENTS_LIFECYCLE_CONTROLLER_H_
+#define ELECTRON_SHELL_BROWSER_WEB_CONTENTS_LIFECYCLE_CONTROLLER_H_
+
+#include <cstdint>
+#include <optional>
+
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "content/public/browser/web_contents_observer.h"
+
+namespace electron {
+
+// Moves a WebContents between the active, hidden, frozen and discarded
+// lifecycle states. Hidden pages can be frozen after an idle period, and
+// discarded (keeping their navigation history) when the system runs low on
+// memory; a discarded page is reloaded once it is shown again.
+class WebContentsLifecycleController : private content::WebContentsObserver {
+ public:
+  enum class State {
+    kActive,
+    kHidden,
+    kFrozen,
+    kDiscarded,
+  };
+
+  struct Policy {
+    // Freeze the page once it has been hidden for this long.
+    std::optional<base::TimeDelta> freeze_delay;
+    // Whether the page may be discarded under memory pressure.
+    bool discardable = false;
+  };
+
+  struct MemoryPressurePolicy {
+    // Discard pages while available physical memory is below this.
+    uint64_t available_memory_threshold = 0;
+    base::TimeDelta check_interval = base::Seconds(5);
+  };
+
+  using StateChangedCallback =
+      base::RepeatingCallback<void(State new_state, State old_state)>;
+
+  WebContentsLifecycleController(content::WebContents* web_contents,
+                                 StateChangedCallback state_changed);
+  ~WebContentsLifecycleController() override;
+
+  // disable copy
+  WebContentsLifecycleController(const WebContentsLifecycleController&) =
+      delete;
+  WebContentsLifecycleController& operator=(
+      const WebContentsLifecycleController&) = delete;
+
+  // Applies to every controller; pass std::nullopt to stop monitoring.
+  static void SetMemoryPressurePolicy(
+      std::optional<MemoryPressurePolicy> policy);
+
+  // Number of live pages, other than |this| one, rendered by |process_id|.
+  size_t CountPagesInProcess(int process_id) const;
+
+  State state() const { return state_; }
+  const Policy& policy() const { return policy_; }
+  void SetPolicy(const Policy& policy);
+
+  // Each returns false when the page is not in a state that allows it, e.g.
+  // visible, playing audio or being captured.
+  bool Freeze();
+  bool Unfreeze();
+  bool Discard();
+
+ private:
+  // content::WebContentsObserver:
+  void OnVisibilityChanged(content::Visibility visibility) override;
+  void DidStartNavigation(
+      content::NavigationHandle* navigation_handle) override;
+
+  bool IsVisible() const;
+  bool CanFreezeOrDiscard() const;
+  void MaybeStartFreezeTimer();
+  void OnFreezeTimer();
+  void SetState(State state);
+
+  static void CheckMemoryPressure();
+  static void OnAvailableMemory(uint64_t available_bytes);
+
+  State state_ = State::kActive;
+  Policy policy_;
+  base::TimeTicks hidden_since_;
+  base::OneShotTimer freeze_timer_;
+  StateChangedCallback state_changed_;
+
+  base::WeakPtrFactory<WebContentsLifecycleController> weak_factory_{this};
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_BROWSER_WEB_CONTENTS_LIFECYCLE_CONTROLLER_H_
@@ -30,6 +30,7 @@
 #include "services/network/public/cpp/features.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/public/cpp/url_loader_completion_status.h"
 #include "services/network/public/cpp/url_util.h"
 #include "services/network/public/cpp/wrapper_shared_url_loader_factory.h"
 #include "services/network/public/mojom/chunked_data_pipe_getter.mojom.h"
@@ -771,10 +772,15 @@ void SimpleURLLoaderWrapper::OnDataReceived(std::string_view string_view,
 }
 
 void SimpleURLLoaderWrapper::OnComplete(bool success) {
+  v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+  v8::HandleScope scope(isolate);
+  const auto& status = loader_->CompletionStatus();
+  v8::Local<v8::Value> timing =
+      FinishTiming(isolate, success, status ? &status.value() : nullptr);
   if (success) {
-    Emit("complete");
+    Emit("complete", timing);
   } else {
-    Emit("error", net::ErrorToString(loader_->NetError()));
+    Emit("error", net::ErrorToString(loader_->NetError()), timing);
   }
   loader_.reset();
   url_loader_factory_.reset();
@@ -784,6 +790,10 @@ void SimpleURLLoaderWrapper::OnComplete(bool success) {
 void SimpleURLLoaderWrapper::OnResponseStarted(
     const GURL& final_url,
     const network::mojom::URLResponseHead& response_head) {
+  load_timing_ = response_head.load_timing;
+  response_start_ = base::TimeTicks::Now();
+  was_fetched_via_cache_ = response_head.was_fetched_via_cache;
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
   auto dict = gin::Dictionary::CreateEmpty(isolate);
@@ -859,6 +869,74 @@ void SimpleURLLoaderWrapper::OnDownloadProgress(uint64_t current) {
   Emit("download-progress", current);
 }
 
+v8::Local<v8::Value> SimpleURLLoaderWrapper::FinishTiming(
+    v8::Isolate* isolate,
+    bool success,
+    const network::URLLoaderCompletionStatus* status) {
+  const net::LoadTimingInfo& t = load_timing_;
+  const base::TimeTicks completion_time =
+      status && !status->completion_time.is_null() ? status->completion_time
+                                                   : base::TimeTicks::Now();
+  // Phases that did not happen (e.g. DNS and connect on a reused socket, or
+  // everything but the transfer for a cache hit) report 0.
+  const auto phase = [](base::TimeTicks start, base::TimeTicks end) {
+    if (start.is_null() || end.is_null() || end < start)
+      return base::TimeDelta();
+    return end - start;
+  };
+  const base::TimeTicks first_byte = t.receive_headers_start.is_null()
+                                         ? response_start_
+                                         : t.receive_headers_start;
+  const base::TimeTicks headers_end = t.receive_headers_end.is_null()
+                                          ? response_start_
+                                          : t.receive_headers_end;
+  const base::TimeDelta ttfb = phase(t.send_end, first_byte);
+  const base::TimeDelta total = phase(t.request_start, completion_time);
+  const bool from_cache =
+      was_fetched_via_cache_ || (status && status->exists_in_cache);
+  const int64_t encoded_data_length = status ? status->encoded_data_length : 0;
+  const int64_t decoded_body_length = status ? status->decoded_body_length : 0;
+
+  if (browser_context_) {
+    NetworkStatistics& stats = browser_context_->network_statistics();
+    ++stats.requests;
+    if (!success)
+      ++stats.failed_requests;
+    if (from_cache)
+      ++stats.cache_hits;
+    if (t.socket_reused)
+      ++stats.reused_connections;
+    stats.encoded_bytes_received += std::max<int64_t>(encoded_data_length, 0);
+    stats.decoded_bytes_received += std::max<int64_t>(decoded_body_length, 0);
+    stats.total_duration += total;
+    stats.total_time_to_first_byte += ttfb;
+  }
+
+  auto dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.Set("startTime",
+           t.request_start_time.is_null()
+               ? 0.0
+               : t.request_start_time.InMillisecondsFSinceUnixEpoch());
+  dict.Set("dns", phase(t.connect_timing.domain_lookup_start,
+                        t.connect_timing.domain_lookup_end)
+                      .InMillisecondsF());
+  dict.Set("connect",
+           phase(t.connect_timing.connect_start, t.connect_timing.connect_end)
+               .InMillisecondsF());
+  dict.Set("tls", phase(t.connect_timing.ssl_start, t.connect_timing.ssl_end)
+                      .InMillisecondsF());
+  dict.Set("send", phase(t.send_start, t.send_end).InMillisecondsF());
+  dict.Set("ttfb", ttfb.InMillisecondsF());
+  dict.Set("transfer", phase(headers_end, completion_time).InMillisecondsF());
+  dict.Set("total", total.InMillisecondsF());
+  dict.Set("socketReused", t.socket_reused);
+  dict.Set("fromCache", from_cache);
+  dict.Set("encodedDataLength", encoded_data_length);
+  dict.Set("encodedBodyLength", status ? status->encoded_body_length : 0);
+  dict.Set("decodedBodyLength", decoded_body_length);
+  return dict.GetHandle();
+}
+
 // static
 gin::ObjectTemplateBuilder SimpleURLLoaderWrapper::GetObjectTemplateBuilder(
     v8::Isolate* isolate) {
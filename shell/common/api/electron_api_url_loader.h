@@ -13,9 +13,11 @@
 #include "base/byte_size.h"
 #include "base/memory/raw_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/time/time.h"
 #include "gin/weak_cell.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
+#include "net/base/load_timing_info.h"
 #include "services/network/public/cpp/simple_url_loader_stream_consumer.h"
 #include "services/network/public/mojom/network_context.mojom.h"
 #include "services/network/public/mojom/url_loader_factory.mojom-forward.h"
@@ -40,6 +42,7 @@ namespace network {
 class SimpleURLLoader;
 struct ResourceRequest;
 class SharedURLLoaderFactory;
+struct URLLoaderCompletionStatus;
 }  // namespace network
 
 namespace electron {
@@ -146,6 +149,13 @@ class SimpleURLLoaderWrapper final
   void OnUploadProgress(uint64_t position, uint64_t total);
   void OnDownloadProgress(uint64_t current);
 
+  // Builds the `RequestTiming` object delivered with 'complete' / 'error' and
+  // folds this request into the session's NetworkStatistics.
+  v8::Local<v8::Value> FinishTiming(
+      v8::Isolate* isolate,
+      bool success,
+      const network::URLLoaderCompletionStatus* status);
+
   void Start();
 
   SEQUENCE_CHECKER(sequence_checker_);
@@ -155,6 +165,11 @@ class SimpleURLLoaderWrapper final
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<network::SimpleURLLoader> loader_;
 
+  // Captured from the response head of the final (non-redirect) response.
+  net::LoadTimingInfo load_timing_;
+  base::TimeTicks response_start_;
+  bool was_fetched_via_cache_ = false;
+
   GC_PLUGIN_IGNORE(
       "Context tracking of receivers is not needed in the browser process.")
   mojo::ReceiverSet<network::mojom::URLLoaderNetworkServiceObserver>
@@ -5,6 +5,7 @@
 #include "shell/common/api/electron_bindings.h"
 
 #include <algorithm>
+#include <optional>
 #include <utility>
 
 #include "base/files/file.h"
@@ -12,13 +13,16 @@
 #include "base/process/process_handle.h"
 #include "base/system/sys_info.h"
 #include "electron/mas.h"
+#include "gin/arguments.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
 // #include
 // "services/resource_coordinator/public/mojom/memory_instrumentation/memory_instrumentation.mojom.h"
 #include "shell/browser/browser.h"
 #include "shell/common/application_info.h"
+#include "shell/common/cpu_profiler.h"
 #include "shell/common/gin_converters/file_path_converter.h"
+#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/locker.h"
@@ -26,6 +30,7 @@
 #include "shell/common/heap_snapshot.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/process_util.h"
+#include "shell/common/sampling_heap_profiler.h"
 #include "shell/common/thread_restrictions.h"
 #include "third_party/blink/renderer/platform/heap/process_heap.h"  // nogncheck
 
@@ -75,6 +80,14 @@ void ElectronBindings::BindTo(v8::Isolate* isolate,
   BindProcess(isolate, &dict, metrics_.get());
 
   dict.SetMethod("takeHeapSnapshot", &TakeHeapSnapshot);
+  dict.SetMethod("startSamplingHeapProfiler", &StartSamplingHeapProfiler);
+  dict.SetMethod("stopSamplingHeapProfiler", &StopSamplingHeapProfiler);
+  dict.SetMethod("startCpuProfiler",
+                 base::BindRepeating(&ElectronBindings::StartCpuProfiler,
+                                     base::Unretained(this)));
+  dict.SetMethod("stopCpuProfiler",
+                 base::BindRepeating(&ElectronBindings::StopCpuProfiler,
+                                     base::Unretained(this)));
 #if BUILDFLAG(IS_POSIX)
   dict.SetMethod("setFdLimit", &base::IncreaseFdLimitTo);
 #endif
@@ -96,6 +109,48 @@ void ElectronBindings::ActivateUVLoop(v8::Isolate* isolate) {
   uv_async_send(call_next_tick_async_.get());
 }
 
+CpuProfiler* ElectronBindings::GetCpuProfiler(v8::Isolate* isolate) {
+  if (!cpu_profiler_)
+    cpu_profiler_ = std::make_unique<CpuProfiler>(isolate);
+  return cpu_profiler_.get();
+}
+
+bool ElectronBindings::StartCpuProfiler(gin::Arguments* args) {
+  CpuProfilerOptions options;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    if (auto error = ParseCpuProfilerOptions(dict, &options)) {
+      args->ThrowTypeError(*error);
+      return false;
+    }
+  }
+  return GetCpuProfiler(args->isolate())->Start(options);
+}
+
+v8::Local<v8::Promise> ElectronBindings::StopCpuProfiler(
+    v8::Isolate* isolate,
+    const base::FilePath& file_path) {
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!cpu_profiler_ || !cpu_profiler_->IsProfiling()) {
+    promise.RejectWithErrorMessage("The CPU profiler is not running");
+    return handle;
+  }
+
+  cpu_profiler_->Stop(
+      file_path, base::BindOnce(
+                     [](gin_helper::Promise<void> promise, bool success) {
+                       if (success) {
+                         promise.Resolve();
+                       } else {
+                         promise.RejectWithErrorMessage(
+                             "Failed to write the CPU profile");
+                       }
+                     },
+                     std::move(promise)));
+  return handle;
+}
+
 // static
 void ElectronBindings::OnCallNextTick(uv_async_t* handle) {
   auto* self = static_cast<ElectronBindings*>(handle->data);
@@ -309,4 +364,27 @@ bool ElectronBindings::TakeHeapSnapshot(v8::Isolate* isolate,
   return electron::TakeHeapSnapshot(isolate, &file);
 }
 
+// static
+bool ElectronBindings::StartSamplingHeapProfiler(gin::Arguments* args) {
+  SamplingHeapProfilerOptions options;
+  gin_helper::Dictionary dict;
+  if (args->GetNext(&dict)) {
+    if (auto error = ParseSamplingHeapProfilerOptions(dict, &options)) {
+      args->ThrowTypeError(*error);
+      return false;
+    }
+  }
+  return electron::StartSamplingHeapProfiler(args->isolate(), options);
+}
+
+// static
+v8::Local<v8::Value> ElectronBindings::StopSamplingHeapProfiler(
+    v8::Isolate* isolate) {
+  std::optional<base::DictValue> profile =
+      electron::StopSamplingHeapProfiler(isolate);
+  if (!profile)
+    return v8::Null(isolate);
+  return gin::ConvertToV8(isolate, base::Value(std::move(*profile)));
+}
+
 }  // namespace electron
@@ -17,6 +17,10 @@ namespace base {
 class FilePath;
 }
 
+namespace gin {
+class Arguments;
+}
+
 namespace gin_helper {
 class Dictionary;
 template <typename T>
@@ -33,6 +37,8 @@ class Environment;
 
 namespace electron {
 
+class CpuProfiler;
+
 class ElectronBindings {
  public:
   explicit ElectronBindings(uv_loop_t* loop);
@@ -49,6 +55,10 @@ class ElectronBindings {
   // Should be called when a node::Environment has been destroyed.
   void EnvironmentDestroyed(node::Environment* env);
 
+  // The profiler behind process.startCpuProfiler(), created on first use.
+  // The utility process also drives it on behalf of the main process.
+  CpuProfiler* GetCpuProfiler(v8::Isolate* isolate);
+
   static void BindProcess(v8::Isolate* isolate,
                           gin_helper::Dictionary* process,
                           base::ProcessMetrics* metrics);
@@ -72,14 +82,21 @@ class ElectronBindings {
                                           v8::Isolate* isolate);
   static bool TakeHeapSnapshot(v8::Isolate* isolate,
                                const base::FilePath& file_path);
+  static bool StartSamplingHeapProfiler(gin::Arguments* args);
+  static v8::Local<v8::Value> StopSamplingHeapProfiler(v8::Isolate* isolate);
 
   void ActivateUVLoop(v8::Isolate* isolate);
+  bool StartCpuProfiler(gin::Arguments* args);
+  v8::Local<v8::Promise> StopCpuProfiler(v8::Isolate* isolate,
+                                         const base::FilePath& file_path);
 
   static void OnCallNextTick(uv_async_t* handle);
 
   UvHandle<uv_async_t> call_next_tick_async_;
   std::list<node::Environment*> pending_next_ticks_;
   std::unique_ptr<base::ProcessMetrics> metrics_;
+  // Created by the first GetCpuProfiler() call.
+  std::unique_ptr<CpuProfiler> cpu_profiler_;
 };
 
 }  // namespace electron
@@ -0,0 +1,186 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/cpu_profiler.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/files/file_util.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
+#include "base/json/json_writer.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
+#include "base/values.h"
+#include "shell/common/gin_helper/dictionary.h"
+
+namespace electron {
+
+namespace {
+
+// Longest interval accepted, which is already far too coarse to be useful.
+constexpr base::TimeDelta kMaxSamplingInterval = base::Seconds(1);
+
+base::DictValue ToDevToolsNode(const v8::CpuProfileNode* node) {
+  base::DictValue call_frame;
+  call_frame.Set("functionName", node->GetFunctionNameStr());
+  call_frame.Set("scriptId", base::NumberToString(node->GetScriptId()));
+  call_frame.Set("url", node->GetScriptResourceNameStr());
+  // V8 numbers lines and columns from 1 and uses 0 when there are none,
+  // DevTools numbers them from 0 and uses -1.
+  call_frame.Set("lineNumber", node->GetLineNumber() - 1);
+  call_frame.Set("columnNumber", node->GetColumnNumber() - 1);
+
+  base::DictValue dict;
+  dict.Set("id", static_cast<int>(node->GetNodeId()));
+  dict.Set("callFrame", std::move(call_frame));
+  dict.Set("hitCount", static_cast<int>(node->GetHitCount()));
+
+  const int children_count = node->GetChildrenCount();
+  if (children_count > 0) {
+    base::ListValue children;
+    children.reserve(children_count);
+    for (int i = 0; i < children_count; ++i)
+      children.Append(static_cast<int>(node->GetChild(i)->GetNodeId()));
+    dict.Set("children", std::move(children));
+  }
+
+  const unsigned line_count = node->GetHitLineCount();
+  std::vector<v8::CpuProfileNode::LineTick> line_ticks(line_count);
+  if (line_count > 0 && node->GetLineTicks(line_ticks.data(), line_count)) {
+    base::ListValue position_ticks;
+    position_ticks.reserve(line_count);
+    for (const auto& line_tick : line_ticks) {
+      base::DictValue position_tick;
+      position_tick.Set("line", line_tick.line);
+      position_tick.Set("ticks", static_cast<int>(line_tick.hit_count));
+      position_ticks.Append(std::move(position_tick));
+    }
+    dict.Set("positionTicks", std::move(position_ticks));
+  }
+  return dict;
+}
+
+base::DictValue ToDevToolsProfile(const v8::CpuProfile* profile) {
+  // Walk the tree without recursion; call stacks can be thousands of frames
+  // deep.
+  base::ListValue nodes;
+  std::vector<const v8::CpuProfileNode*> pending = {profile->GetTopDownRoot()};
+  while (!pending.empty()) {
+    const v8::CpuProfileNode* node = pending.back();
+    pending.pop_back();
+    nodes.Append(ToDevToolsNode(node));
+    for (int i = node->GetChildrenCount() - 1; i >= 0; --i)
+      pending.push_back(node->GetChild(i));
+  }
+
+  const int samples_count = profile->GetSamplesCount();
+  base::ListValue samples;
+  base::ListValue time_deltas;
+  samples.reserve(samples_count);
+  time_deltas.reserve(samples_count);
+  int64_t previous_timestamp = profile->GetStartTime();
+  for (int i = 0; i < samples_count; ++i) {
+    samples.Append(static_cast<int>(profile->GetSample(i)->GetNodeId()));
+    const int64_t timestamp = profile->GetSampleTimestamp(i);
+    time_deltas.Append(static_cast<int>(timestamp - previous_timestamp));
+    previous_timestamp = timestamp;
+  }
+
+  base::DictValue dict;
+  dict.Set("nodes", std::move(nodes));
+  // Microseconds, which exceed the range of int.
+  dict.Set("startTime", static_cast<double>(profile->GetStartTime()));
+  dict.Set("endTime", static_cast<double>(profile->GetEndTime()));
+  dict.Set("samples", std::move(samples));
+  dict.Set("timeDeltas", std::move(time_deltas));
+  return dict;
+}
+
+bool WriteProfile(const base::FilePath& file_path, base::DictValue profile) {
+  const std::optional<std::string> json = base::WriteJson(profile);
+  return json && base::WriteFile(file_path, *json);
+}
+
+}  // namespace
+
+std::optional<std::string> ParseCpuProfilerOptions(
+    const gin_helper::Dictionary& dict,
+    CpuProfilerOptions* options) {
+  double sampling_interval = 0;
+  if (dict.Get("samplingInterval", &sampling_interval)) {
+    const base::TimeDelta interval = base::Microseconds(sampling_interval);
+    if (interval < base::Microseconds(1) || interval > kMaxSamplingInterval) {
+      return "'samplingInterval' must be between 1 and " +
+             base::NumberToString(kMaxSamplingInterval.InMicroseconds());
+    }
+    options->sampling_interval = interval;
+  }
+  int max_samples = 0;
+  if (dict.Get("maxSamples", &max_samples)) {
+    if (max_samples < 1)
+      return "'maxSamples' must be a positive integer";
+    options->max_samples = max_samples;
+  }
+  return std::nullopt;
+}
+
+CpuProfiler::CpuProfiler(v8::Isolate* isolate) : isolate_(isolate) {}
+
+// A profiler that is still running at this point is left to the isolate,
+// which may already have been disposed of.
+CpuProfiler::~CpuProfiler() = default;
+
+bool CpuProfiler::Start(const CpuProfilerOptions& options) {
+  if (profiler_)
+    return false;
+
+  // A v8::CpuProfiler keeps a code event listener installed for as long as it
+  // exists, so one is only created for the duration of a profile.
+  profiler_ = v8::CpuProfiler::New(isolate_);
+  profiler_->SetSamplingInterval(
+      static_cast<int>(options.sampling_interval.InMicroseconds()));
+  v8::CpuProfilingResult result = profiler_->Start(v8::CpuProfilingOptions(
+      v8::kLeafNodeLineNumbers,
+      options.max_samples.value_or(v8::CpuProfilingOptions::kNoSampleLimit)));
+  if (result.status != v8::CpuProfilingStatus::kStarted) {
+    DisposeProfiler();
+    return false;
+  }
+  profile_id_ = result.id;
+  return true;
+}
+
+void CpuProfiler::Stop(const base::FilePath& file_path,
+                       StopCallback callback) {
+  DCHECK(profiler_);
+  v8::CpuProfile* profile = profiler_->Stop(profile_id_);
+  std::optional<base::DictValue> dict;
+  if (profile) {
+    dict = ToDevToolsProfile(profile);
+    profile->Delete();
+  }
+  DisposeProfiler();
+
+  if (!dict) {
+    std::move(callback).Run(false);
+    return;
+  }
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      base::BindOnce(&WriteProfile, file_path, std::move(*dict)),
+      std::move(callback));
+}
+
+void CpuProfiler::DisposeProfiler() {
+  v8::CpuProfiler* profiler = profiler_;
+  profiler_ = nullptr;
+  profiler->Dispose();
+}
+
+}  // namespace electron
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_CPU_PROFILER_H_
+#define ELECTRON_SHELL_COMMON_CPU_PROFILER_H_
+
+#include <optional>
+#include <string>
+
+#include "base/functional/callback_forward.h"
+#include "base/memory/raw_ptr.h"
+#include "base/time/time.h"
+#include "v8/include/v8-profiler.h"
+
+namespace base {
+class FilePath;
+}
+
+namespace gin_helper {
+class Dictionary;
+}
+
+namespace electron {
+
+struct CpuProfilerOptions {
+  // V8's default, which Node's --cpu-prof-interval also uses.
+  base::TimeDelta sampling_interval = base::Milliseconds(1);
+  // Unset to keep every sample until the profiler is stopped.
+  std::optional<unsigned> max_samples;
+};
+
+// Reads the JavaScript options object of startCpuProfiler() into |options|.
+// Returns an error message for invalid options.
+std::optional<std::string> ParseCpuProfilerOptions(
+    const gin_helper::Dictionary& dict,
+    CpuProfilerOptions* options);
+
+// Records a V8 CPU profile of an isolate and saves it as a .cpuprofile file,
+// the Profiler.Profile format of the DevTools protocol. Only the samples are
+// copied out of V8 on the isolate's thread; serializing and writing the file
+// happens on the thread pool.
+class CpuProfiler {
+ public:
+  using StopCallback = base::OnceCallback<void(bool success)>;
+
+  explicit CpuProfiler(v8::Isolate* isolate);
+  ~CpuProfiler();
+
+  // disable copy
+  CpuProfiler(const CpuProfiler&) = delete;
+  CpuProfiler& operator=(const CpuProfiler&) = delete;
+
+  bool IsProfiling() const { return profiler_ != nullptr; }
+
+  // Returns false if the profiler is already running or failed to start.
+  bool Start(const CpuProfilerOptions& options);
+
+  // Stops the profiler and writes the profile to |file_path|. |callback| is
+  // run on the calling sequence once the file has been written.
+  void Stop(const base::FilePath& file_path, StopCallback callback);
+
+ private:
+  void DisposeProfiler();
+
+  const raw_ptr<v8::Isolate> isolate_;
+  raw_ptr<v8::CpuProfiler> profiler_ = nullptr;
+  v8::ProfilerId profile_id_ = 0;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_CPU_PROFILER_H_
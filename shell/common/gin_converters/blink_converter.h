@@ -133,6 +133,9 @@ template <>
 struct Converter<blink::mojom::ConsoleMessageLevel> {
   static v8::Local<v8::Value> ToV8(v8::Isolate* isolate,
                                    const blink::mojom::ConsoleMessageLevel& in);
+  static bool FromV8(v8::Isolate* isolate,
+                     v8::Local<v8::Value> val,
+                     blink::mojom::ConsoleMessageLevel* out);
 };
 
 v8::Local<v8::Value> EditFlagsToV8(v8::Isolate* isolate,
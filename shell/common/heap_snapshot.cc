@@ -4,15 +4,49 @@
 
 #include "shell/common/heap_snapshot.h"
 
+#include <atomic>
+#include <optional>
+#include <utility>
+#include <vector>
+
 #include "base/containers/span.h"
 #include "base/files/file.h"
+#include "base/functional/bind.h"
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
+#include "base/memory/ref_counted.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/task/thread_pool.h"
+#include "base/time/time.h"
 #include "v8/include/v8-profiler.h"
 #include "v8/include/v8.h"
 
 namespace {
 
+// Serialized data that may wait to be written on the thread pool. Beyond it
+// chunks are written on the isolate's thread, which keeps memory bounded
+// when the disk is slower than the serializer.
+constexpr size_t kMaxBytesInFlight = 8 * 1024 * 1024;
+
+constexpr base::TimeDelta kProgressInterval = base::Milliseconds(100);
+
+// Limits progress reports, which V8 makes every few thousand objects, to a
+// few a second.
+class ProgressThrottle {
+ public:
+  bool ShouldReport() {
+    const base::TimeTicks now = base::TimeTicks::Now();
+    if (now - last_report_ < kProgressInterval)
+      return false;
+    last_report_ = now;
+    return true;
+  }
+
+ private:
+  base::TimeTicks last_report_;
+};
+
 class HeapSnapshotOutputStream : public v8::OutputStream {
  public:
   explicit HeapSnapshotOutputStream(base::File* file) : file_(file) {
@@ -39,6 +73,122 @@ class HeapSnapshotOutputStream : public v8::OutputStream {
   bool is_complete_ = false;
 };
 
+class HeapSnapshotActivityControl : public v8::ActivityControl {
+ public:
+  explicit HeapSnapshotActivityControl(
+      electron::HeapSnapshotProgressDelegate* delegate)
+      : delegate_(delegate) {
+    DCHECK(delegate_);
+  }
+
+  // v8::ActivityControl
+  ControlOption ReportProgressValue(uint32_t done, uint32_t total) override {
+    if (done == total || throttle_.ShouldReport())
+      delegate_->OnBuildProgress(done, total);
+    return kContinue;
+  }
+
+ private:
+  raw_ptr<electron::HeapSnapshotProgressDelegate> delegate_;
+  ProgressThrottle throttle_;
+};
+
+// Owns the snapshot file, which chunks are written to at their offset either
+// on the writer sequence or, under backpressure, on the isolate's thread.
+class HeapSnapshotFileWriter
+    : public base::RefCountedThreadSafe<HeapSnapshotFileWriter> {
+ public:
+  explicit HeapSnapshotFileWriter(base::File file) : file_(std::move(file)) {}
+
+  // disable copy
+  HeapSnapshotFileWriter(const HeapSnapshotFileWriter&) = delete;
+  HeapSnapshotFileWriter& operator=(const HeapSnapshotFileWriter&) = delete;
+
+  size_t bytes_in_flight() const { return bytes_in_flight_; }
+  bool failed() const { return failed_; }
+
+  void AddBytesInFlight(size_t size) { bytes_in_flight_ += size; }
+
+  void Write(int64_t offset, std::vector<uint8_t> data) {
+    if (!failed_ && !file_.WriteAndCheck(offset, data))
+      failed_ = true;
+    bytes_in_flight_ -= data.size();
+  }
+
+  bool WriteNow(int64_t offset, base::span<const uint8_t> data) {
+    if (!file_.WriteAndCheck(offset, data))
+      failed_ = true;
+    return !failed_;
+  }
+
+  // Runs on the writer sequence after every posted Write().
+  bool Finish(bool serialized) { return serialized && !failed_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<HeapSnapshotFileWriter>;
+  ~HeapSnapshotFileWriter() = default;
+
+  base::File file_;
+  std::atomic<size_t> bytes_in_flight_ = 0;
+  std::atomic<bool> failed_ = false;
+};
+
+class HeapSnapshotPipelinedOutputStream : public v8::OutputStream {
+ public:
+  HeapSnapshotPipelinedOutputStream(
+      scoped_refptr<HeapSnapshotFileWriter> writer,
+      scoped_refptr<base::SequencedTaskRunner> task_runner,
+      electron::HeapSnapshotProgressDelegate* delegate)
+      : writer_(std::move(writer)),
+        task_runner_(std::move(task_runner)),
+        delegate_(delegate) {}
+
+  [[nodiscard]] bool IsComplete() const { return is_complete_; }
+
+  // v8::OutputStream
+  int GetChunkSize() override { return 65536; }
+
+  void EndOfStream() override {
+    is_complete_ = true;
+    if (delegate_)
+      delegate_->OnWriteProgress(offset_);
+  }
+
+  v8::OutputStream::WriteResult WriteAsciiChunk(char* data, int size) override {
+    if (writer_->failed())
+      return kAbort;
+
+    // SAFETY: since WriteAsciiChunk() only gives us data + size, our
+    // UNSAFE_BUFFERS macro call is unavoidable here. It can be removed
+    // if/when v8 changes WriteAsciiChunk() to pass a v8::MemorySpan.
+    const auto data_span = base::as_bytes(
+        UNSAFE_BUFFERS(base::span{data, base::saturated_cast<size_t>(size)}));
+    if (writer_->bytes_in_flight() + data_span.size() <= kMaxBytesInFlight) {
+      writer_->AddBytesInFlight(data_span.size());
+      task_runner_->PostTask(
+          FROM_HERE,
+          base::BindOnce(&HeapSnapshotFileWriter::Write, writer_, offset_,
+                         std::vector<uint8_t>(data_span.begin(),
+                                              data_span.end())));
+    } else if (!writer_->WriteNow(offset_, data_span)) {
+      return kAbort;
+    }
+    offset_ += data_span.size();
+
+    if (delegate_ && throttle_.ShouldReport())
+      delegate_->OnWriteProgress(offset_);
+    return kContinue;
+  }
+
+ private:
+  scoped_refptr<HeapSnapshotFileWriter> writer_;
+  scoped_refptr<base::SequencedTaskRunner> task_runner_;
+  raw_ptr<electron::HeapSnapshotProgressDelegate> delegate_;
+  ProgressThrottle throttle_;
+  int64_t offset_ = 0;
+  bool is_complete_ = false;
+};
+
 }  // namespace
 
 namespace electron {
@@ -62,4 +212,41 @@ bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file) {
   return stream.IsComplete();
 }
 
+void TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotProgressDelegate* delegate,
+                      base::OnceCallback<void(bool success)> callback) {
+  DCHECK(isolate);
+
+  if (!file.IsValid()) {
+    base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, base::BindOnce(std::move(callback), false));
+    return;
+  }
+
+  auto task_runner = base::ThreadPool::CreateSequencedTaskRunner(
+      {base::MayBlock(), base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN});
+  auto writer = base::MakeRefCounted<HeapSnapshotFileWriter>(std::move(file));
+
+  bool serialized = false;
+  std::optional<HeapSnapshotActivityControl> control;
+  if (delegate)
+    control.emplace(delegate);
+  auto* snapshot = isolate->GetHeapProfiler()->TakeHeapSnapshot(
+      control ? &control.value() : nullptr);
+  if (snapshot) {
+    HeapSnapshotPipelinedOutputStream stream(writer, task_runner, delegate);
+    snapshot->Serialize(&stream, v8::HeapSnapshot::kJSON);
+    const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+    serialized = stream.IsComplete();
+  }
+
+  task_runner->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&HeapSnapshotFileWriter::Finish, std::move(writer),
+                     serialized),
+      std::move(callback));
+}
+
 }  // namespace electron
@@ -5,6 +5,10 @@
 #ifndef ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 #define ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
 
+#include <cstdint>
+
+#include "base/functional/callback_forward.h"
+
 namespace base {
 class File;
 }
@@ -15,8 +19,31 @@ class Isolate;
 
 namespace electron {
 
+class HeapSnapshotProgressDelegate {
+ public:
+  // While V8 walks the heap, in objects. Throttled to a few calls a second.
+  virtual void OnBuildProgress(uint32_t done, uint32_t total) = 0;
+  // While the snapshot is serialized, whose final size is not known upfront.
+  virtual void OnWriteProgress(uint64_t bytes_written) = 0;
+
+ protected:
+  virtual ~HeapSnapshotProgressDelegate() = default;
+};
+
+// Takes a snapshot of the heap of |isolate| and writes it to |file| as JSON.
 bool TakeHeapSnapshot(v8::Isolate* isolate, base::File* file);
 
+// Like the above, but only building and serializing the snapshot, which has
+// to happen on the isolate's thread, blocks the caller. The serialized chunks
+// are written to |file| on the thread pool, up to a bounded amount of data in
+// flight beyond which the caller writes them itself, so memory does not grow
+// with the size of the snapshot. |callback| runs on the calling sequence once
+// everything has been written.
+void TakeHeapSnapshot(v8::Isolate* isolate,
+                      base::File file,
+                      HeapSnapshotProgressDelegate* delegate,
+                      base::OnceCallback<void(bool success)> callback);
+
 }  // namespace electron
 
 #endif  // ELECTRON_SHELL_COMMON_HEAP_SNAPSHOT_H_
@@ -31,6 +31,7 @@
 #include "electron/fuses.h"
 #include "electron/mas.h"
 #include "shell/browser/api/electron_api_app.h"
+#include "shell/browser/main_thread_monitor.h"
 #include "shell/common/api/electron_bindings.h"
 #include "shell/common/electron_command_line.h"
 #include "shell/common/gin_converters/callback_converter.h"
@@ -1109,7 +1110,12 @@ void NodeBindings::UvRunOnce() {
     // The embed thread is parked on |embed_sem_| until we post it below and
     // re-reads uv_backend_timeout() before polling, so skip the interrupts.
     uv_loop_interrupt_suspend(uv_loop_);
-    int r = uv_run(uv_loop_, UV_RUN_NOWAIT);
+    int r;
+    {
+      MainThreadMonitor::Section section(
+          MainThreadMonitor::Origin::kUvCallback);
+      r = uv_run(uv_loop_, UV_RUN_NOWAIT);
+    }
     uv_loop_interrupt_resume(uv_loop_);
 
     if (browser_env_ != BrowserEnvironment::kBrowser)
@@ -0,0 +1,113 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/sampling_heap_profiler.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/strings/string_number_conversions.h"
+#include "gin/converter.h"
+#include "shell/common/gin_helper/dictionary.h"
+#include "v8/include/v8-isolate.h"
+#include "v8/include/v8-local-handle.h"
+#include "v8/include/v8-profiler.h"
+
+namespace electron {
+
+namespace {
+
+base::DictValue SerializeNode(v8::Isolate* isolate,
+                              const v8::AllocationProfile::Node& node) {
+  double self_size = 0;
+  for (const auto& allocation : node.allocations)
+    self_size += static_cast<double>(allocation.size) * allocation.count;
+
+  // Same conversion as V8's inspector, whose line and column numbers are
+  // zero-based.
+  base::DictValue call_frame;
+  call_frame.Set("functionName", gin::V8ToString(isolate, node.name));
+  call_frame.Set("scriptId", base::NumberToString(node.script_id));
+  call_frame.Set("url", gin::V8ToString(isolate, node.script_name));
+  call_frame.Set("lineNumber", node.line_number - 1);
+  call_frame.Set("columnNumber", node.column_number - 1);
+
+  base::ListValue children;
+  children.reserve(node.children.size());
+  for (const auto* child : node.children)
+    children.Append(SerializeNode(isolate, *child));
+
+  base::DictValue result;
+  result.Set("callFrame", std::move(call_frame));
+  result.Set("selfSize", self_size);
+  result.Set("id", static_cast<double>(node.node_id));
+  result.Set("children", std::move(children));
+  return result;
+}
+
+}  // namespace
+
+std::optional<std::string> ParseSamplingHeapProfilerOptions(
+    const gin_helper::Dictionary& dict,
+    SamplingHeapProfilerOptions* options) {
+  double sampling_interval = 0;
+  if (dict.Get("samplingInterval", &sampling_interval)) {
+    if (sampling_interval < 1)
+      return "'samplingInterval' must be a positive number";
+    options->sampling_interval = static_cast<uint64_t>(sampling_interval);
+  }
+  int stack_depth = 0;
+  if (dict.Get("stackDepth", &stack_depth)) {
+    if (stack_depth < 1 || stack_depth > kMaxSamplingHeapProfilerStackDepth) {
+      return "'stackDepth' must be between 1 and " +
+             base::NumberToString(kMaxSamplingHeapProfilerStackDepth);
+    }
+    options->stack_depth = stack_depth;
+  }
+  dict.Get("includeObjectsCollectedByMajorGC",
+           &options->include_objects_collected_by_major_gc);
+  dict.Get("includeObjectsCollectedByMinorGC",
+           &options->include_objects_collected_by_minor_gc);
+  return std::nullopt;
+}
+
+bool StartSamplingHeapProfiler(v8::Isolate* isolate,
+                               const SamplingHeapProfilerOptions& options) {
+  int flags = v8::HeapProfiler::kSamplingNoFlags;
+  if (options.include_objects_collected_by_major_gc)
+    flags |= v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMajorGC;
+  if (options.include_objects_collected_by_minor_gc)
+    flags |= v8::HeapProfiler::kSamplingIncludeObjectsCollectedByMinorGC;
+  return isolate->GetHeapProfiler()->StartSamplingHeapProfiler(
+      options.sampling_interval, options.stack_depth,
+      static_cast<v8::HeapProfiler::SamplingFlags>(flags));
+}
+
+std::optional<base::DictValue> StopSamplingHeapProfiler(v8::Isolate* isolate) {
+  v8::HandleScope handle_scope(isolate);
+  v8::HeapProfiler* heap_profiler = isolate->GetHeapProfiler();
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  if (!profile)
+    return std::nullopt;
+  heap_profiler->StopSamplingHeapProfiler();
+
+  base::ListValue samples;
+  samples.reserve(profile->GetSamples().size());
+  for (const auto& sample : profile->GetSamples()) {
+    base::DictValue dict;
+    dict.Set("size", static_cast<double>(sample.size) * sample.count);
+    dict.Set("nodeId", static_cast<double>(sample.node_id));
+    dict.Set("ordinal", static_cast<double>(sample.sample_id));
+    samples.Append(std::move(dict));
+  }
+
+  base::DictValue result;
+  result.Set("head", SerializeNode(isolate, *profile->GetRootNode()));
+  result.Set("samples", std::move(samples));
+  return result;
+}
+
+}  // namespace electron
@@ -0,0 +1,53 @@
+// Copyright (c) 2026 GitHub, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_SAMPLING_HEAP_PROFILER_H_
+#define ELECTRON_SHELL_COMMON_SAMPLING_HEAP_PROFILER_H_
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "base/values.h"
+
+namespace gin_helper {
+class Dictionary;
+}
+
+namespace v8 {
+class Isolate;
+}
+
+namespace electron {
+
+struct SamplingHeapProfilerOptions {
+  // Average number of bytes allocated between two samples. V8's default,
+  // which keeps the overhead low enough for production use.
+  uint64_t sampling_interval = 512 * 1024;
+  // Maximum number of frames captured per sample.
+  int stack_depth = 64;
+  bool include_objects_collected_by_major_gc = false;
+  bool include_objects_collected_by_minor_gc = false;
+};
+
+constexpr int kMaxSamplingHeapProfilerStackDepth = 1024;
+
+// Reads the JavaScript options object of startSamplingHeapProfiler() into
+// |options|. Returns an error message for invalid options.
+std::optional<std::string> ParseSamplingHeapProfilerOptions(
+    const gin_helper::Dictionary& dict,
+    SamplingHeapProfilerOptions* options);
+
+// Returns false if the profiler of |isolate| is already running.
+bool StartSamplingHeapProfiler(v8::Isolate* isolate,
+                               const SamplingHeapProfilerOptions& options);
+
+// Stops the profiler of |isolate| and returns what it sampled as a
+// HeapProfiler.SamplingHeapProfile of the DevTools protocol, which DevTools
+// can load as a .heapprofile file. Unset if the profiler was not running.
+std::optional<base::DictValue> StopSamplingHeapProfiler(v8::Isolate* isolate);
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_SAMPLING_HEAP_PROFILER_H_
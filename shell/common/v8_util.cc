@@ -12,6 +12,7 @@
 #include "base/base_switches.h"
 #include "base/containers/heap_array.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/string_number_conversions.h"
 #include "gin/converter.h"
 #include "mojo/public/cpp/base/big_buffer.h"
 #include "shell/common/api/electron_api_native_image.h"
@@ -19,6 +20,7 @@
 #include "shell/common/serialized_value.h"
 #include "skia/public/mojom/bitmap.mojom.h"
 #include "third_party/blink/public/common/messaging/cloneable_message.h"
+#include "third_party/blink/public/common/messaging/transferable_message.h"
 #include "third_party/blink/public/common/messaging/web_message_port.h"
 #include "ui/gfx/image/image_skia.h"
 #include "ui/gfx/image/image_skia_rep.h"
@@ -80,6 +82,41 @@ class V8Serializer : public v8::ValueSerializer::Delegate {
     return true;
   }
 
+  bool Serialize(v8::Local<v8::Value> value,
+                 base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+                 blink::TransferableMessage* out) {
+    for (size_t i = 0; i < array_buffers.size(); ++i) {
+      v8::Local<v8::ArrayBuffer> array_buffer = array_buffers[i];
+      const bool duplicate =
+          std::find(array_buffers.begin(), array_buffers.begin() + i,
+                    array_buffer) != array_buffers.begin() + i;
+      if (duplicate || array_buffer->WasDetached() ||
+          !array_buffer->IsDetachable()) {
+        isolate_->ThrowException(v8::Exception::Error(gin::StringToV8(
+            isolate_, "ArrayBuffer at index " + base::NumberToString(i) +
+                          " could not be transferred.")));
+        return false;
+      }
+      serializer_.TransferArrayBuffer(i, array_buffer);
+    }
+    if (!Serialize(value, static_cast<blink::CloneableMessage*>(out)))
+      return false;
+
+    out->array_buffer_contents_array.reserve(array_buffers.size());
+    for (v8::Local<v8::ArrayBuffer> array_buffer : array_buffers) {
+      auto contents = blink::mojom::SerializedArrayBufferContents::New();
+      // BigBuffer moves anything larger than an inline message into a shared
+      // memory region, which is handed over rather than copied again.
+      contents->contents = mojo_base::BigBuffer(UNSAFE_BUFFERS(
+          base::span(static_cast<const uint8_t*>(array_buffer->Data()),
+                     array_buffer->ByteLength())));
+      if (array_buffer->Detach(v8::Local<v8::Value>()).IsNothing())
+        return false;
+      out->array_buffer_contents_array.push_back(std::move(contents));
+    }
+    return true;
+  }
+
   // v8::ValueSerializer::Delegate
   void* ReallocateBufferMemory(void* old_buffer,
                                size_t size,
@@ -198,6 +235,11 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
         deserializer_(isolate, data.data(), data.size(), this) {}
   V8Deserializer(v8::Isolate* isolate, const blink::CloneableMessage& message)
       : V8Deserializer(isolate, message.encoded_message) {}
+  V8Deserializer(v8::Isolate* isolate,
+                 const blink::TransferableMessage& message)
+      : V8Deserializer(isolate, message.encoded_message) {
+    array_buffer_contents_ = &message.array_buffer_contents_array;
+  }
 
   v8::Local<v8::Value> Deserialize() {
     v8::EscapableHandleScope scope(isolate_);
@@ -211,6 +253,7 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
     if (!deserializer_.ReadHeader(context).To(&read_header))
       return v8::Null(isolate_);
     DCHECK(read_header);
+    TransferArrayBuffers();
     v8::Local<v8::Value> value;
     if (!deserializer_.ReadValue(context).ToLocal(&value))
       return v8::Null(isolate_);
@@ -232,6 +275,23 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
   }
 
  private:
+  // V8's sandbox keeps array buffers from being backed by the shared memory
+  // they arrived in, so their contents are copied out once.
+  void TransferArrayBuffers() {
+    if (!array_buffer_contents_)
+      return;
+    for (size_t i = 0; i < array_buffer_contents_->size(); ++i) {
+      const mojo_base::BigBuffer& contents =
+          (*array_buffer_contents_)[i]->contents;
+      v8::Local<v8::ArrayBuffer> array_buffer =
+          v8::ArrayBuffer::New(isolate_, contents.size());
+      UNSAFE_BUFFERS(base::span(static_cast<uint8_t*>(array_buffer->Data()),
+                                array_buffer->ByteLength()))
+          .copy_from(base::span(contents));
+      deserializer_.TransferArrayBuffer(i, array_buffer);
+    }
+  }
+
   bool ReadTag(uint8_t* tag) {
     const void* tag_bytes = nullptr;
     if (!deserializer_.ReadRawBytes(1, &tag_bytes))
@@ -294,6 +354,8 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
   }
 
   raw_ptr<v8::Isolate> isolate_;
+  raw_ptr<const std::vector<blink::mojom::SerializedArrayBufferContentsPtr>>
+      array_buffer_contents_ = nullptr;
   v8::ValueDeserializer deserializer_;
 };
 
@@ -309,11 +371,24 @@ bool SerializeV8Value(v8::Isolate* isolate,
   return V8Serializer(isolate).Serialize(value, out);
 }
 
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+    blink::TransferableMessage* out) {
+  return V8Serializer(isolate).Serialize(value, array_buffers, out);
+}
+
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in) {
   return V8Deserializer(isolate, in).Deserialize();
 }
 
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in) {
+  return V8Deserializer(isolate, in).Deserialize();
+}
+
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const SerializedValue& in) {
   // The process that sent a shared-memory payload can still write to it while
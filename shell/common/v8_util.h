@@ -8,6 +8,7 @@
 #include "base/containers/span.h"
 
 namespace v8 {
+class ArrayBuffer;
 class ArrayBufferView;
 class Isolate;
 template <class T>
@@ -17,6 +18,7 @@ class Value;
 
 namespace blink {
 struct CloneableMessage;
+struct TransferableMessage;
 }
 
 namespace electron {
@@ -31,8 +33,18 @@ bool SerializeV8Value(v8::Isolate* isolate,
 bool SerializeV8Value(v8::Isolate* isolate,
                       v8::Local<v8::Value> value,
                       SerializedValue* out);
+// Moves the contents of |array_buffers| into |out| next to the encoded value
+// rather than copying them into it, and detaches them. Large buffers travel in
+// shared memory. Throws and returns false if a buffer cannot be transferred.
+bool SerializeV8Value(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> value,
+    base::span<const v8::Local<v8::ArrayBuffer>> array_buffers,
+    blink::TransferableMessage* out);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in);
+v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
+                                        const blink::TransferableMessage& in);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const SerializedValue& in);
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
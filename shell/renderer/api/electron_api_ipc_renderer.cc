@@ -2,8 +2,10 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <string>
 
+#include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
 #include "content/public/renderer/worker_thread.h"
@@ -42,6 +44,10 @@ namespace {
 const char kIPCMethodCalledAfterContextReleasedError[] =
     "IPC method called after context was released";
 
+// Pairs the begin and end trace events of invokes, which service workers make
+// off the main thread.
+std::atomic<uint64_t> g_next_invoke_trace_id{0};
+
 RenderFrame* GetCurrentRenderFrame() {
   WebLocalFrame* frame = WebLocalFrame::FrameForCurrentContext();
   if (!frame)
@@ -81,6 +87,8 @@ class IPCBase : public gin::Wrappable<T> {
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return;
     }
+    TRACE_EVENT2("electron", "IPCRenderer::SendMessage", "channel", channel,
+                 "bytes", static_cast<uint64_t>(message.size()));
     electron_ipc_remote_->Message(internal, channel, std::move(message));
   }
 
@@ -100,12 +108,21 @@ class IPCBase : public gin::Wrappable<T> {
     gin_helper::Promise<electron::SerializedValue> p(isolate);
     auto handle = p.GetHandle();
 
+    const uint64_t trace_id = ++g_next_invoke_trace_id;
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN2(
+        "electron", "IPCRenderer::Invoke", TRACE_ID_LOCAL(trace_id), "channel",
+        channel, "bytes", static_cast<uint64_t>(message.size()));
     electron_ipc_remote_->Invoke(
         internal, channel, std::move(message),
         base::BindOnce(
             [](gin_helper::Promise<electron::SerializedValue> p,
-               electron::SerializedValue result) { p.Resolve(result); },
-            std::move(p)));
+               uint64_t trace_id, electron::SerializedValue result) {
+              TRACE_EVENT_NESTABLE_ASYNC_END1(
+                  "electron", "IPCRenderer::Invoke", TRACE_ID_LOCAL(trace_id),
+                  "bytes", static_cast<uint64_t>(result.size()));
+              p.Resolve(result);
+            },
+            std::move(p), trace_id));
 
     return handle;
   }
@@ -147,6 +164,9 @@ class IPCBase : public gin::Wrappable<T> {
     }
 
     transferable_message.ports = std::move(ports);
+    TRACE_EVENT2(
+        "electron", "IPCRenderer::PostMessage", "channel", channel, "bytes",
+        static_cast<uint64_t>(transferable_message.encoded_message.size()));
     electron_ipc_remote_->ReceivePostMessage(channel,
                                              std::move(transferable_message));
   }
@@ -163,6 +183,8 @@ class IPCBase : public gin::Wrappable<T> {
     if (!electron::SerializeV8Value(isolate, arguments, &message)) {
       return;
     }
+    TRACE_EVENT2("electron", "IPCRenderer::SendToHost", "channel", channel,
+                 "bytes", static_cast<uint64_t>(message.size()));
     electron_ipc_remote_->MessageHost(channel, std::move(message));
   }
 
@@ -180,6 +202,8 @@ class IPCBase : public gin::Wrappable<T> {
       return {};
     }
 
+    TRACE_EVENT2("electron", "IPCRenderer::SendSync", "channel", channel,
+                 "bytes", static_cast<uint64_t>(message.size()));
     electron::SerializedValue result;
     electron_ipc_remote_->MessageSync(internal, channel, std::move(message),
                                       &result);
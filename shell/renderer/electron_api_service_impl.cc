@@ -4,19 +4,26 @@
 
 #include "electron/shell/renderer/electron_api_service_impl.h"
 
+#include <algorithm>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "gin/converter.h"
+#include "mojo/public/cpp/bindings/remote.h"
 #include "mojo/public/cpp/system/platform_handle.h"
 #include "shell/common/gin_converters/blink_converter.h"
 #include "shell/common/gin_converters/serialized_value_converter.h"
 #include "shell/common/heap_snapshot.h"
+#include "shell/common/sampling_heap_profiler.h"
 #include "shell/common/thread_restrictions.h"
 #include "shell/common/v8_util.h"
 #include "shell/renderer/electron_ipc_native.h"
 
+#include "base/containers/span.h"
+#include "base/memory/ref_counted.h"
 #include "base/no_destructor.h"
+#include "base/values.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_thread.h"
 #include "shell/renderer/renderer_client_base.h"
@@ -24,12 +31,36 @@
 #include "third_party/blink/public/platform/scheduler/web_agent_group_scheduler.h"
 #include "third_party/blink/public/web/web_local_frame.h"
 #include "third_party/blink/public/web/web_message_port_converter.h"
+#include "third_party/blink/public/web/web_script_source.h"
+#include "third_party/blink/renderer/platform/bindings/dom_wrapper_world.h"  // nogncheck
 #include "v8/include/v8-context.h"
+#include "v8/include/v8-isolate.h"
+#include "v8/include/v8-statistics.h"
 
 namespace electron {
 
 namespace {
 
+// Forwards heap snapshot progress to the browser. Messages are written to the
+// pipe right away, so they arrive while the snapshot still blocks this thread.
+class HeapSnapshotProgressForwarder : public HeapSnapshotProgressDelegate {
+ public:
+  explicit HeapSnapshotProgressForwarder(
+      mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer)
+      : observer_(std::move(observer)) {}
+
+  // HeapSnapshotProgressDelegate
+  void OnBuildProgress(uint32_t done, uint32_t total) override {
+    observer_->OnBuildProgress(done, total);
+  }
+  void OnWriteProgress(uint64_t bytes_written) override {
+    observer_->OnWriteProgress(bytes_written);
+  }
+
+ private:
+  mojo::Remote<mojom::HeapSnapshotProgressObserver> observer_;
+};
+
 mojom::RendererStartupDataPtr* GetPendingNewWindowStartupData() {
   // Process-global, no locking: set, RenderFrame creation, and take are all
   // one synchronous call stack inside window.open() on the renderer main
@@ -40,6 +71,50 @@ mojom::RendererStartupDataPtr* GetPendingNewWindowStartupData() {
   return pending.get();
 }
 
+// Collects the results of the scripts of one ExecuteJavaScriptBatch() call,
+// whose promises may settle in any order.
+class JavaScriptBatch : public base::RefCounted<JavaScriptBatch> {
+ public:
+  JavaScriptBatch(
+      size_t size,
+      mojom::ElectronRenderer::ExecuteJavaScriptBatchCallback callback)
+      : results_(size), pending_(size), callback_(std::move(callback)) {}
+
+  // disable copy
+  JavaScriptBatch(const JavaScriptBatch&) = delete;
+  JavaScriptBatch& operator=(const JavaScriptBatch&) = delete;
+
+  void OnScriptExecuted(size_t index,
+                        std::optional<base::Value> value,
+                        base::TimeTicks start_time) {
+    auto& result = results_[index];
+    result = mojom::JavaScriptBatchResult::New();
+    result->success = value.has_value();
+    result->value = value ? std::move(*value)
+                          : base::Value(
+                                "Script failed to execute, this normally "
+                                "means an error was thrown or a promise was "
+                                "rejected. Check the renderer console for the "
+                                "error.");
+    if (--pending_ == 0)
+      std::move(callback_).Run(std::move(results_));
+  }
+
+ private:
+  friend class base::RefCounted<JavaScriptBatch>;
+
+  ~JavaScriptBatch() {
+    // The frame went away before every script completed; an empty reply
+    // tells the browser so.
+    if (callback_)
+      std::move(callback_).Run({});
+  }
+
+  std::vector<mojom::JavaScriptBatchResultPtr> results_;
+  size_t pending_;
+  mojom::ElectronRenderer::ExecuteJavaScriptBatchCallback callback_;
+};
+
 }  // namespace
 
 ElectronApiServiceImpl::~ElectronApiServiceImpl() = default;
@@ -86,16 +161,10 @@ void ElectronApiServiceImpl::SetStartupData(
 
 void ElectronApiServiceImpl::BindTo(
     mojo::PendingReceiver<mojom::ElectronRenderer> receiver) {
-  if (document_created_) {
-    if (receiver_.is_bound())
-      receiver_.reset();
-
-    receiver_.Bind(std::move(receiver));
-    receiver_.set_disconnect_handler(base::BindOnce(
-        &ElectronApiServiceImpl::OnConnectionError, GetWeakPtr()));
-  } else {
-    pending_receiver_ = std::move(receiver);
-  }
+  if (document_created_)
+    receivers_.Add(this, std::move(receiver));
+  else
+    pending_receivers_.push_back(std::move(receiver));
 }
 
 void ElectronApiServiceImpl::OnInterfaceRequestForFrame(
@@ -107,25 +176,14 @@ void ElectronApiServiceImpl::OnInterfaceRequestForFrame(
 void ElectronApiServiceImpl::DidCreateDocumentElement() {
   document_created_ = true;
 
-  if (pending_receiver_) {
-    if (receiver_.is_bound())
-      receiver_.reset();
-
-    receiver_.Bind(std::move(pending_receiver_));
-    receiver_.set_disconnect_handler(base::BindOnce(
-        &ElectronApiServiceImpl::OnConnectionError, GetWeakPtr()));
-  }
+  for (auto& receiver : std::exchange(pending_receivers_, {}))
+    receivers_.Add(this, std::move(receiver));
 }
 
 void ElectronApiServiceImpl::OnDestruct() {
   delete this;
 }
 
-void ElectronApiServiceImpl::OnConnectionError() {
-  if (receiver_.is_bound())
-    receiver_.reset();
-}
-
 void ElectronApiServiceImpl::Message(bool internal,
                                      const std::string& channel,
                                      electron::SerializedValue arguments) {
@@ -174,11 +232,14 @@ void ElectronApiServiceImpl::ReceivePostMessage(
 
 void ElectronApiServiceImpl::TakeHeapSnapshot(
     mojo::ScopedHandle file,
+    mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer,
     TakeHeapSnapshotCallback callback) {
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
   if (!frame)
     return;
 
+  // Chunks that exceed what may be in flight to the writer are written on
+  // this thread.
   ScopedAllowBlockingForElectron allow_blocking;
 
   base::ScopedPlatformFile platform_file;
@@ -188,12 +249,90 @@ void ElectronApiServiceImpl::TakeHeapSnapshot(
     std::move(callback).Run(false);
     return;
   }
-  base::File base_file(std::move(platform_file));
+
+  std::optional<HeapSnapshotProgressForwarder> forwarder;
+  if (observer)
+    forwarder.emplace(std::move(observer));
 
   v8::Isolate* isolate = frame->GetAgentGroupScheduler()->Isolate();
-  bool success = electron::TakeHeapSnapshot(isolate, &base_file);
+  electron::TakeHeapSnapshot(isolate, base::File(std::move(platform_file)),
+                             forwarder ? &forwarder.value() : nullptr,
+                             std::move(callback));
+}
+
+void ElectronApiServiceImpl::StartSamplingHeapProfiler(
+    mojom::SamplingHeapProfilerOptionsPtr options,
+    StartSamplingHeapProfilerCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(false);
+    return;
+  }
+
+  SamplingHeapProfilerOptions profiler_options;
+  profiler_options.sampling_interval =
+      std::max<uint64_t>(options->sampling_interval, 1);
+  profiler_options.stack_depth = std::clamp(
+      options->stack_depth, 1, kMaxSamplingHeapProfilerStackDepth);
+  profiler_options.include_objects_collected_by_major_gc =
+      options->include_objects_collected_by_major_gc;
+  profiler_options.include_objects_collected_by_minor_gc =
+      options->include_objects_collected_by_minor_gc;
+  std::move(callback).Run(electron::StartSamplingHeapProfiler(
+      frame->GetAgentGroupScheduler()->Isolate(), profiler_options));
+}
+
+void ElectronApiServiceImpl::StopSamplingHeapProfiler(
+    StopSamplingHeapProfilerCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(std::nullopt);
+    return;
+  }
+
+  std::move(callback).Run(electron::StopSamplingHeapProfiler(
+      frame->GetAgentGroupScheduler()->Isolate()));
+}
+
+void ElectronApiServiceImpl::ExecuteJavaScriptBatch(
+    const std::vector<std::u16string>& scripts,
+    bool user_gesture,
+    ExecuteJavaScriptBatchCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame || scripts.empty()) {
+    std::move(callback).Run({});
+    return;
+  }
+
+  auto batch = base::MakeRefCounted<JavaScriptBatch>(scripts.size(),
+                                                     std::move(callback));
+  for (size_t i = 0; i < scripts.size(); ++i) {
+    const blink::WebScriptSource source{
+        blink::WebString::FromUtf16(scripts[i])};
+    frame->RequestExecuteScript(
+        blink::DOMWrapperWorld::kMainWorldId, base::span_from_ref(source),
+        user_gesture ? blink::mojom::UserActivationOption::kActivate
+                     : blink::mojom::UserActivationOption::kDoNotActivate,
+        blink::mojom::EvaluationTiming::kSynchronous,
+        blink::mojom::LoadEventBlockingOption::kDoNotBlock,
+        base::BindOnce(&JavaScriptBatch::OnScriptExecuted, batch, i),
+        base::NullCallback(), blink::BackForwardCacheAware::kAllow,
+        blink::mojom::WantResultOption::kWantResult,
+        blink::mojom::PromiseResultOption::kAwait);
+  }
+}
+
+void ElectronApiServiceImpl::GetV8HeapStatistics(
+    GetV8HeapStatisticsCallback callback) {
+  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+  if (!frame) {
+    std::move(callback).Run(0, 0);
+    return;
+  }
 
-  std::move(callback).Run(success);
+  v8::HeapStatistics stats;
+  frame->GetAgentGroupScheduler()->Isolate()->GetHeapStatistics(&stats);
+  std::move(callback).Run(stats.used_heap_size(), stats.total_heap_size());
 }
 
 }  // namespace electron
@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_RENDERER_ELECTRON_API_SERVICE_IMPL_H_
 
 #include <string>
+#include <vector>
 
 #include "base/memory/weak_ptr.h"
 #include "content/public/renderer/render_frame_observer.h"
@@ -13,7 +14,7 @@
 #include "mojo/public/cpp/bindings/associated_receiver.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
-#include "mojo/public/cpp/bindings/receiver.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 #include "services/service_manager/public/cpp/binder_registry.h"
 #include "shell/common/api/api.mojom.h"
 
@@ -49,8 +50,19 @@ class ElectronApiServiceImpl
                electron::SerializedValue arguments) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
-  void TakeHeapSnapshot(mojo::ScopedHandle file,
-                        TakeHeapSnapshotCallback callback) override;
+  void TakeHeapSnapshot(
+      mojo::ScopedHandle file,
+      mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer,
+      TakeHeapSnapshotCallback callback) override;
+  void StartSamplingHeapProfiler(
+      mojom::SamplingHeapProfilerOptionsPtr options,
+      StartSamplingHeapProfilerCallback callback) override;
+  void StopSamplingHeapProfiler(
+      StopSamplingHeapProfilerCallback callback) override;
+  void ExecuteJavaScriptBatch(const std::vector<std::u16string>& scripts,
+                              bool user_gesture,
+                              ExecuteJavaScriptBatchCallback callback) override;
+  void GetV8HeapStatistics(GetV8HeapStatisticsCallback callback) override;
   void ProcessPendingMessages();
 
   // mojom::ElectronFrameStartup
@@ -84,14 +96,16 @@ class ElectronApiServiceImpl
   void DidCreateDocumentElement() override;
   void OnDestruct() override;
 
-  void OnConnectionError();
-
   // Whether the DOM document element has been created.
   bool document_created_ = false;
   service_manager::BinderRegistry registry_;
 
-  mojo::PendingReceiver<mojom::ElectronRenderer> pending_receiver_;
-  mojo::Receiver<mojom::ElectronRenderer> receiver_{this};
+  std::vector<mojo::PendingReceiver<mojom::ElectronRenderer>>
+      pending_receivers_;
+  // Besides the frame's WebFrameMain, the browser binds the interface for
+  // one-off requests such as heap statistics. Each keeps its own pipe so that
+  // binding one does not disconnect the others.
+  mojo::ReceiverSet<mojom::ElectronRenderer> receivers_;
   mojo::AssociatedReceiver<mojom::ElectronFrameStartup> frame_startup_receiver_{
       this};
 
@@ -65,10 +65,39 @@ void ServiceWorkerData::ReceivePostMessage(const std::string& channel,
   NOTIMPLEMENTED();
 }
 
-void ServiceWorkerData::TakeHeapSnapshot(mojo::ScopedHandle file,
-                                         TakeHeapSnapshotCallback callback) {
+void ServiceWorkerData::TakeHeapSnapshot(
+    mojo::ScopedHandle file,
+    mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer,
+    TakeHeapSnapshotCallback callback) {
   NOTIMPLEMENTED();
   std::move(callback).Run(false);
 }
 
+void ServiceWorkerData::StartSamplingHeapProfiler(
+    mojom::SamplingHeapProfilerOptionsPtr options,
+    StartSamplingHeapProfilerCallback callback) {
+  NOTIMPLEMENTED();
+  std::move(callback).Run(false);
+}
+
+void ServiceWorkerData::StopSamplingHeapProfiler(
+    StopSamplingHeapProfilerCallback callback) {
+  NOTIMPLEMENTED();
+  std::move(callback).Run(std::nullopt);
+}
+
+void ServiceWorkerData::ExecuteJavaScriptBatch(
+    const std::vector<std::u16string>& scripts,
+    bool user_gesture,
+    ExecuteJavaScriptBatchCallback callback) {
+  NOTIMPLEMENTED();
+  std::move(callback).Run({});
+}
+
+void ServiceWorkerData::GetV8HeapStatistics(
+    GetV8HeapStatisticsCallback callback) {
+  NOTIMPLEMENTED();
+  std::move(callback).Run(0, 0);
+}
+
 }  // namespace electron
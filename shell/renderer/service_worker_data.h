@@ -6,6 +6,7 @@
 #define ELECTRON_SHELL_RENDERER_SERVICE_WORKER_DATA_H_
 
 #include <string>
+#include <vector>
 
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
@@ -56,8 +57,19 @@ class ServiceWorkerData : public mojom::ElectronRenderer {
                electron::SerializedValue arguments) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
-  void TakeHeapSnapshot(mojo::ScopedHandle file,
-                        TakeHeapSnapshotCallback callback) override;
+  void TakeHeapSnapshot(
+      mojo::ScopedHandle file,
+      mojo::PendingRemote<mojom::HeapSnapshotProgressObserver> observer,
+      TakeHeapSnapshotCallback callback) override;
+  void StartSamplingHeapProfiler(
+      mojom::SamplingHeapProfilerOptionsPtr options,
+      StartSamplingHeapProfilerCallback callback) override;
+  void StopSamplingHeapProfiler(
+      StopSamplingHeapProfilerCallback callback) override;
+  void ExecuteJavaScriptBatch(const std::vector<std::u16string>& scripts,
+                              bool user_gesture,
+                              ExecuteJavaScriptBatchCallback callback) override;
+  void GetV8HeapStatistics(GetV8HeapStatisticsCallback callback) override;
 
  private:
   void OnElectronRendererRequest(
@@ -11,6 +11,7 @@
 #include "base/command_line.h"
 #include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/trace_event/trace_event.h"
 #include "electron/buildflags/buildflags.h"
 #include "electron/fuses.h"
 #include "electron/mas.h"
@@ -19,8 +20,10 @@
 #include "services/network/public/cpp/wrapper_shared_url_loader_factory.h"
 #include "services/network/public/mojom/host_resolver.mojom.h"
 #include "services/network/public/mojom/network_context.mojom.h"
+#include "shell/browser/api/message_port.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/api/electron_bindings.h"
+#include "shell/common/cpu_profiler.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/node_bindings.h"
@@ -116,7 +119,7 @@ NodeService::~NodeService() {
 #if BUILDFLAG(ENABLE_PROMPT_API)
   electron::api::local_ai_handler::SetHandlerChangedCallback({});
 #endif
-  if (!node_env_stopped_) {
+  if (node_env_ && !node_env_stopped_) {
     node_env_->set_trace_sync_io(false);
     ParentPort::GetInstance()->Close();
     js_env_->DestroyMicrotasksRunner();
@@ -125,18 +128,11 @@ NodeService::~NodeService() {
   }
 }
 
-void NodeService::Initialize(
-    node::mojom::NodeServiceParamsPtr params,
-    mojo::PendingRemote<node::mojom::NodeServiceClient> client_pending_remote) {
-  if (NodeBindings::IsInitialized())
+void NodeService::Prepare() {
+  if (js_env_)
     return;
 
-  GetRemote().Bind(std::move(client_pending_remote));
-  GetRemote().reset_on_disconnect();
-
-  if (params->url_loader_factory_params) {
-    UpdateURLLoaderFactory(std::move(params->url_loader_factory_params));
-  }
+  TRACE_EVENT0("electron", "NodeService::Prepare");
 
   // Enable trap handlers before creating the V8 isolate. V8 initialization
   // calls IsTrapHandlerEnabled() which prevents later EnableTrapHandler calls.
@@ -155,12 +151,36 @@ void NodeService::Initialize(
 
   // Empty when the isolate was created from the embedded Node startup
   // snapshot: the main context is then materialized (with the whole
-  // bootstrapped environment) inside CreateEnvironment and entered below --
-  // the same path the browser process takes.
+  // bootstrapped environment) inside CreateEnvironment and entered in
+  // Initialize() -- the same path the browser process takes.
   const v8::Local<v8::Context> context = isolate->GetCurrentContext();
 
   node_bindings_->Initialize(isolate, context);
 
+  network_change_notifier_ = net::NetworkChangeNotifier::CreateIfNeeded(
+      net::NetworkChangeNotifier::CONNECTION_UNKNOWN,
+      net::NetworkChangeNotifier::ConnectionSubtype::SUBTYPE_UNKNOWN);
+}
+
+void NodeService::Initialize(
+    node::mojom::NodeServiceParamsPtr params,
+    mojo::PendingRemote<node::mojom::NodeServiceClient> client_pending_remote) {
+  if (node_env_)
+    return;
+
+  GetRemote().Bind(std::move(client_pending_remote));
+  GetRemote().reset_on_disconnect();
+
+  if (params->url_loader_factory_params) {
+    UpdateURLLoaderFactory(std::move(params->url_loader_factory_params));
+  }
+
+  Prepare();
+
+  v8::Isolate* const isolate = js_env_->isolate();
+  v8::HandleScope scope{isolate};
+  const v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
   // ParentPort is a cppgc-managed wrappable, so it must be created after the
   // V8 isolate (and its cppgc heap) exists. The connector is created paused and
   // is not resumed until the entry script calls parentPort.start() during
@@ -168,10 +188,6 @@ void NodeService::Initialize(
   // behavior.
   ParentPort::GetInstance()->Initialize(std::move(params->port));
 
-  network_change_notifier_ = net::NetworkChangeNotifier::CreateIfNeeded(
-      net::NetworkChangeNotifier::CONNECTION_UNKNOWN,
-      net::NetworkChangeNotifier::ConnectionSubtype::SUBTYPE_UNKNOWN);
-
   // Append program path for process.argv0
   auto program = base::CommandLine::ForCurrentProcess()->GetProgram();
 #if defined(OS_WIN)
@@ -215,6 +231,16 @@ void NodeService::Initialize(
   gin_helper::Dictionary process(node_env_->isolate(),
                                  node_env_->process_object());
   process.SetHidden("_serviceStartupScript", params->script);
+  if (!params->code_cache_dir.empty())
+    process.SetHidden("_codeCacheDir", params->code_cache_dir);
+
+  // Tasks of a utilityProcess pool are dispatched over their own port, which
+  // lib/utility/init.ts hands to process.parentPort.setTaskHandler().
+  if (params->task_port) {
+    auto task_port = MessagePort::Create(isolate);
+    task_port->Entangle(std::move(params->task_port->port));
+    process.SetHidden("_taskPort", task_port.ToV8());
+  }
 
   // Setup microtask runner.
   js_env_->CreateMicrotasksRunner();
@@ -234,6 +260,10 @@ void NodeService::Initialize(
   // Run entry script.
   node_bindings_->PrepareEmbedThread();
   node_bindings_->StartPolling();
+
+  // The entry script may have exited the process.
+  if (GetRemote().is_bound())
+    GetRemote()->OnReady();
 }
 
 void NodeService::UpdateURLLoaderFactory(
@@ -244,6 +274,36 @@ void NodeService::UpdateURLLoaderFactory(
       params->use_network_observer_from_url_loader_factory);
 }
 
+void NodeService::StartCpuProfiler(base::TimeDelta sampling_interval,
+                                   std::optional<uint32_t> max_samples,
+                                   StartCpuProfilerCallback callback) {
+  if (!node_env_) {
+    std::move(callback).Run(false);
+    return;
+  }
+  CpuProfilerOptions options;
+  options.sampling_interval = sampling_interval;
+  options.max_samples = max_samples;
+  std::move(callback).Run(
+      electron_bindings_->GetCpuProfiler(node_env_->isolate())
+          ->Start(options));
+}
+
+void NodeService::StopCpuProfiler(const base::FilePath& file_path,
+                                  StopCpuProfilerCallback callback) {
+  if (!node_env_) {
+    std::move(callback).Run(false);
+    return;
+  }
+  CpuProfiler* profiler =
+      electron_bindings_->GetCpuProfiler(node_env_->isolate());
+  if (!profiler->IsProfiling()) {
+    std::move(callback).Run(false);
+    return;
+  }
+  profiler->Stop(file_path, std::move(callback));
+}
+
 #if BUILDFLAG(ENABLE_PROMPT_API)
 NodeService::PendingAIManagerBinding::PendingAIManagerBinding(
     node::mojom::BindAIManagerParamsPtr params,
@@ -65,11 +65,17 @@ class NodeService : public node::mojom::NodeService {
   NodeService& operator=(const NodeService&) = delete;
 
   // mojom::NodeService implementation:
+  void Prepare() override;
   void Initialize(node::mojom::NodeServiceParamsPtr params,
                   mojo::PendingRemote<node::mojom::NodeServiceClient>
                       client_pending_remote) override;
   void UpdateURLLoaderFactory(
       node::mojom::URLLoaderFactoryParamsPtr params) override;
+  void StartCpuProfiler(base::TimeDelta sampling_interval,
+                        std::optional<uint32_t> max_samples,
+                        StartCpuProfilerCallback callback) override;
+  void StopCpuProfiler(const base::FilePath& file_path,
+                       StopCpuProfilerCallback callback) override;
 
 #if BUILDFLAG(ENABLE_PROMPT_API)
   void BindAIManager(
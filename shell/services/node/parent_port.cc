@@ -5,8 +5,11 @@
 #include "shell/services/node/parent_port.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/no_destructor.h"
+#include "base/strings/string_number_conversions.h"
+#include "gin/arguments.h"
 #include "gin/data_object_builder.h"
 #include "gin/object_template_builder.h"
 #include "shell/browser/api/message_port.h"
@@ -53,12 +56,33 @@ void ParentPort::Initialize(blink::MessagePortDescriptor port) {
       base::BindOnce(&ParentPort::Close, base::Unretained(this)));
 }
 
-void ParentPort::PostMessage(v8::Local<v8::Value> message_value) {
+void ParentPort::PostMessage(gin::Arguments* args) {
   if (!connector_closed_ && connector_ && connector_->is_valid()) {
-    v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
+    v8::Isolate* isolate = args->isolate();
     blink::TransferableMessage transferable_message;
 
-    if (!electron::SerializeV8Value(isolate, message_value,
+    v8::Local<v8::Value> message_value;
+    if (!args->GetNext(&message_value)) {
+      args->ThrowTypeError("Expected a message");
+      return;
+    }
+
+    // Only array buffers can be transferred to the parent.
+    std::vector<v8::Local<v8::Value>> transfer;
+    std::vector<v8::Local<v8::ArrayBuffer>> array_buffers;
+    if (args->GetNext(&transfer)) {
+      for (size_t i = 0; i < transfer.size(); ++i) {
+        if (!transfer[i]->IsArrayBuffer()) {
+          args->ThrowTypeError("Transferable at index " +
+                               base::NumberToString(i) +
+                               " is not an ArrayBuffer");
+          return;
+        }
+        array_buffers.push_back(transfer[i].As<v8::ArrayBuffer>());
+      }
+    }
+
+    if (!electron::SerializeV8Value(isolate, message_value, array_buffers,
                                     &transferable_message)) {
       // SerializeV8Value sets an exception.
       return;
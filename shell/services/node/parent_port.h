@@ -54,7 +54,7 @@ class ParentPort final : public gin::Wrappable<ParentPort>,
   void Close();
 
  private:
-  void PostMessage(v8::Local<v8::Value> message_value);
+  void PostMessage(gin::Arguments* args);
   void Start();
   void Pause();
 
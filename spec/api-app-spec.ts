@@ -1861,6 +1861,10 @@ describe('app module', () => {
           expect(entry.memory).to.have.property('privateBytes').that.is.greaterThan(0);
         }
 
+        if (process.platform === 'linux') {
+          expect(entry.memory).to.have.property('swapSize').that.is.a('number');
+        }
+
         if (process.platform !== 'linux') {
           expect(entry.sandboxed).to.be.a('boolean');
         }
@@ -1878,6 +1882,224 @@ describe('app module', () => {
     });
   });
 
+  describe('collectAppMetrics() API', () => {
+    it('resolves with memory and cpu stats of all running electron processes', async () => {
+      const appMetrics = await app.collectAppMetrics();
+      expect(appMetrics).to.be.an('array').and.have.lengthOf.at.least(1);
+
+      const browser = appMetrics.find(entry => entry.type === 'Browser');
+      expect(browser).to.not.be.undefined();
+      expect(browser!.pid).to.equal(process.pid);
+      for (const entry of appMetrics) {
+        expect(entry.pid).to.be.above(0);
+        expect(entry.creationTime).to.be.a('number').that.is.greaterThan(0);
+        expect(entry.cpu).to.have.ownProperty('percentCPUUsage').that.is.a('number');
+        expect(entry.memory).to.have.property('workingSetSize').that.is.a('number');
+      }
+
+      expect(browser!.memory.workingSetSize).to.be.greaterThan(0);
+      if (process.platform === 'linux') {
+        expect(browser!.memory.swapSize).to.be.a('number');
+        expect(browser!.memory.proportionalSetSize).to.be.greaterThan(0);
+        expect(browser!.memory.privateBytes).to.be.greaterThan(0);
+      }
+    });
+
+    it('reports deltas relative to the previous call', async () => {
+      await app.collectAppMetrics();
+      const appMetrics = await app.collectAppMetrics();
+      const browser = appMetrics.find(entry => entry.type === 'Browser')!;
+      expect(browser.delta).to.be.an('object');
+      expect(browser.delta!.interval).to.be.greaterThan(0);
+      expect(browser.delta!.cumulativeCPUUsage).to.be.at.least(0);
+      expect(browser.delta!.workingSetSize).to.be.a('number');
+    });
+  });
+
+  describe('startAppMetricsSampling() API', () => {
+    afterEach(() => {
+      app.stopAppMetricsSampling();
+    });
+
+    it('emits app-metrics-sampled periodically', async () => {
+      app.startAppMetricsSampling({ interval: 100 });
+      const [, first] = await once(app, 'app-metrics-sampled');
+      const [, second] = await once(app, 'app-metrics-sampled');
+      expect(first).to.be.an('array').and.have.lengthOf.at.least(1);
+      const browser = second.find((entry: Electron.ProcessMetric) => entry.type === 'Browser');
+      expect(browser.delta).to.be.an('object');
+    });
+
+    it('stops emitting after stopAppMetricsSampling()', async () => {
+      app.startAppMetricsSampling({ interval: 100 });
+      await once(app, 'app-metrics-sampled');
+      app.stopAppMetricsSampling();
+      let sampled = false;
+      app.once('app-metrics-sampled', () => { sampled = true; });
+      await setTimeout(300);
+      expect(sampled).to.be.false();
+    });
+
+    it('keeps deltas relative to the previous sample across collectAppMetrics() calls', async () => {
+      app.startAppMetricsSampling({ interval: 500 });
+      await once(app, 'app-metrics-sampled');
+      await setTimeout(300);
+      await app.collectAppMetrics();
+      const [, samples] = await once(app, 'app-metrics-sampled');
+      const browser = samples.find((entry: Electron.ProcessMetric) => entry.type === 'Browser');
+      expect(browser.delta.interval).to.be.at.least(400);
+    });
+
+    it('throws for intervals below 100ms', () => {
+      expect(() => app.startAppMetricsSampling({ interval: 10 })).to.throw(/'interval' must be at least 100ms/);
+    });
+  });
+
+  describe('startMetricsHistory() API', () => {
+    afterEach(async () => {
+      app.stopMetricsHistory();
+      await closeAllWindows();
+    });
+
+    it('records every process into typed array columns', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      app.startMetricsHistory({ interval: 100 });
+      await waitUntil(() => {
+        const history = app.getMetricsHistory()!;
+        return history.processes.some(p => p.type === 'Tab') && history.time.length > 4;
+      });
+
+      const history = app.getMetricsHistory()!;
+      const length = history.time.length;
+      expect(history.time).to.be.an.instanceOf(Float64Array);
+      expect(history.cpuUsage).to.be.an.instanceOf(Float32Array);
+      expect(history.workingSetSize).to.be.an.instanceOf(Uint32Array);
+      for (const column of [history.processId, history.cpuUsage, history.workingSetSize, history.heapUsed]) {
+        expect(column).to.have.lengthOf(length);
+      }
+      for (let i = 1; i < length; i++) {
+        expect(history.time[i]).to.be.at.least(history.time[i - 1]);
+      }
+
+      const browser = history.processes.find(p => p.type === 'Browser')!;
+      expect(browser.pid).to.equal(process.pid);
+      const browserRecord = history.processId.lastIndexOf(browser.id);
+      expect(history.workingSetSize[browserRecord]).to.be.greaterThan(0);
+      expect(history.heapUsed[browserRecord]).to.be.greaterThan(0);
+
+      const renderer = history.processes.find(p => p.pid === w.webContents.getOSProcessId())!;
+      await waitUntil(() => {
+        const latest = app.getMetricsHistory()!;
+        return latest.heapUsed[latest.processId.lastIndexOf(renderer.id)] > 0;
+      });
+    });
+
+    it('does not disconnect the frames it samples', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`
+        window.received = [];
+        require('electron').ipcRenderer.on('ping', (event, i) => window.received.push(i));
+      `);
+      app.startMetricsHistory({ interval: 100 });
+      const count = 100;
+      for (let i = 0; i < count; i++) {
+        w.webContents.mainFrame.send('ping', i);
+        await setTimeout(10);
+      }
+      await waitUntil(async () => (await w.webContents.executeJavaScript('window.received.length')) === count);
+      const received = await w.webContents.executeJavaScript('window.received');
+      expect(received).to.deep.equal([...Array(count).keys()]);
+    });
+
+    it('keeps at most capacity records', async () => {
+      app.startMetricsHistory({ interval: 100, capacity: 3 });
+      await waitUntil(() => app.getMetricsHistory()!.time.length === 3);
+      await setTimeout(300);
+      const history = app.getMetricsHistory()!;
+      expect(history.capacity).to.equal(3);
+      expect(history.time).to.have.lengthOf(3);
+    });
+
+    it('keeps the history after stopMetricsHistory()', async () => {
+      app.startMetricsHistory({ interval: 100 });
+      await waitUntil(() => app.getMetricsHistory()!.time.length > 0);
+      app.stopMetricsHistory();
+      const { length } = app.getMetricsHistory()!.time;
+      await setTimeout(300);
+      expect(app.getMetricsHistory()!.time).to.have.lengthOf(length);
+    });
+
+    it('throws for an invalid capacity', () => {
+      expect(() => app.startMetricsHistory({ capacity: 0 })).to.throw(/'capacity' must be between 1 and/);
+    });
+  });
+
+  describe('startMainThreadMonitoring() API', () => {
+    const block = (ms: number) => {
+      const end = Date.now() + ms;
+      while (Date.now() < end);
+    };
+
+    afterEach(async () => {
+      app.stopMainThreadMonitoring();
+      app.removeAllListeners('long-task');
+      await closeAllWindows();
+    });
+
+    it('records a histogram per origin', async () => {
+      app.startMainThreadMonitoring();
+      await setTimeout(100);
+      const stats = app.getMainThreadTaskStats()!;
+      for (const key of ['postedTask', 'uvCallback', 'microtaskCheckpoint', 'ipcDispatch'] as const) {
+        expect(stats[key].buckets).to.have.lengthOf(14);
+        expect(stats[key].totalDuration).to.be.at.least(stats[key].maxDuration);
+      }
+      expect(stats.postedTask.count).to.be.greaterThan(0);
+      expect(stats.uvCallback.count).to.be.greaterThan(0);
+    });
+
+    it('attributes long tasks to libuv callbacks', async () => {
+      app.startMainThreadMonitoring({ longTaskThreshold: 50 });
+      const longTask = once(app, 'long-task');
+      global.setTimeout(() => block(100));
+      const [, details] = await longTask;
+      expect(details.origin).to.equal('uv-callback');
+      expect(details.duration).to.be.at.least(100);
+      expect(details.breakdown.uvCallback).to.be.at.least(100);
+      expect(details.startTime).to.be.at.most(Date.now());
+    });
+
+    it('attributes long tasks to the IPC channel', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+      w.webContents.ipc.handle('slow-channel', () => block(100));
+      app.startMainThreadMonitoring({ longTaskThreshold: 50 });
+      const longTask = once(app, 'long-task');
+      await w.webContents.executeJavaScript("require('electron').ipcRenderer.invoke('slow-channel')");
+      const [, details] = await longTask;
+      expect(details.origin).to.equal('ipc-dispatch');
+      expect(details.name).to.equal('slow-channel');
+      expect(details.breakdown.ipcDispatch).to.be.at.least(100);
+    });
+
+    it('keeps the histograms after stopMainThreadMonitoring()', async () => {
+      app.startMainThreadMonitoring();
+      await setTimeout(50);
+      app.stopMainThreadMonitoring();
+      const { count } = app.getMainThreadTaskStats()!.postedTask;
+      await setTimeout(50);
+      expect(app.getMainThreadTaskStats()!.postedTask.count).to.equal(count);
+    });
+
+    it('throws for an invalid threshold', () => {
+      expect(() => app.startMainThreadMonitoring({ longTaskThreshold: 0 })).to.throw(
+        /'longTaskThreshold' must be a positive number/
+      );
+    });
+  });
+
   describe('getGPUFeatureStatus() API', () => {
     it('returns the graphic features statuses', () => {
       const features = app.getGPUFeatureStatus();
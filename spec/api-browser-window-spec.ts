@@ -1,3 +1,4 @@
+import { nativeImage } from 'electron/common';
 import {
   app,
   BrowserWindow,
@@ -2889,6 +2890,77 @@ describe('BrowserWindow module', () => {
       // Values can be 0,2,3,4, or 6. We want 6, which is RGB + Alpha
       expect(imgBuffer[25]).to.equal(6);
     });
+
+    describe('with encoding options', () => {
+      let w: BrowserWindow;
+      beforeEach(async () => {
+        w = new BrowserWindow({ show: false, width: 200, height: 200 });
+        w.loadFile(path.join(fixtures, 'pages', 'a.html'));
+        await once(w, 'ready-to-show');
+        w.show();
+      });
+
+      it('encodes the requested region and scale', async () => {
+        const rect = { x: 0, y: 0, width: 100, height: 50 };
+        const png = await w.capturePage(rect, { format: 'png', scaleFactor: 0.5 }) as Electron.CapturedPage;
+        expect(png.size).to.deep.equal({ width: 50, height: 25 });
+        expect(nativeImage.createFromBuffer(png.data).getSize()).to.deep.equal(png.size);
+
+        const jpeg = await w.capturePage(rect, { format: 'jpeg', quality: 50, scaleFactor: 1 }) as Electron.CapturedPage;
+        expect(jpeg.data.subarray(0, 2)).to.deep.equal(Buffer.from([0xff, 0xd8]));
+
+        const webp = await w.capturePage(rect, { format: 'webp', scaleFactor: 1 }) as Electron.CapturedPage;
+        expect(webp.data.toString('latin1', 8, 12)).to.equal('WEBP');
+      });
+
+      it('writes raw pixels into the provided buffer', async () => {
+        const buffer = Buffer.alloc(20 * 10 * 4);
+        const capture = await w.capturePage({ x: 0, y: 0, width: 20, height: 10 }, {
+          format: 'bgra',
+          scaleFactor: 1,
+          buffer
+        }) as Electron.CapturedPage;
+        expect(capture.data).to.equal(buffer);
+        expect(capture.size).to.deep.equal({ width: 20, height: 10 });
+        expect(buffer.some(byte => byte !== 0)).to.equal(true);
+      });
+
+      it('rejects a buffer that is too small', async () => {
+        await expect(w.capturePage({ x: 0, y: 0, width: 20, height: 10 }, {
+          format: 'bgra',
+          scaleFactor: 1,
+          buffer: Buffer.alloc(4)
+        })).to.eventually.be.rejectedWith(/800 bytes are needed/);
+      });
+
+      it('rejects invalid options', async () => {
+        await expect(w.capturePage(undefined, { format: 'gif' as any })).to.eventually.be.rejectedWith(/format must be/);
+        await expect(w.capturePage(undefined, { scaleFactor: 0 })).to.eventually.be.rejectedWith(/scaleFactor/);
+        await expect(w.capturePage(undefined, { buffer: Buffer.alloc(4) })).to.eventually.be.rejectedWith(/'bgra' format/);
+      });
+
+      it('resolves with null when nothing changed', async () => {
+        const first = await w.capturePage(undefined, { format: 'png', onlyIfChanged: true });
+        expect(first).to.not.be.null();
+        const second = await w.capturePage(undefined, { format: 'png', onlyIfChanged: true });
+        expect(second).to.be.null();
+
+        await w.webContents.executeJavaScript('document.body.style.background = "rgb(255, 0, 0)"');
+        await waitUntil(async () => {
+          return await w.capturePage(undefined, { onlyIfChanged: true }) !== null;
+        });
+      });
+
+      it('tracks changes separately per region', async () => {
+        const top = { x: 0, y: 0, width: 20, height: 10 };
+        const bottom = { x: 0, y: 10, width: 20, height: 10 };
+        expect(await w.capturePage(top, { format: 'png', onlyIfChanged: true })).to.not.be.null();
+        expect(await w.capturePage(bottom, { format: 'png', onlyIfChanged: true })).to.not.be.null();
+        // Capturing the other region in between does not count as a change.
+        expect(await w.capturePage(top, { format: 'png', onlyIfChanged: true })).to.be.null();
+        expect(await w.capturePage(bottom, { format: 'png', onlyIfChanged: true })).to.be.null();
+      });
+    });
   });
 
   describe('BrowserWindow.setProgressBar(progress)', () => {
@@ -102,6 +102,59 @@ describe('desktopCapturer', () => {
     expect(isEmpties.every((e) => e === true)).to.be.true();
   });
 
+  it('streams sources through onSource before resolving', async () => {
+    const streamed: Electron.DesktopCapturerSource[] = [];
+    const sources = await desktopCapturer.getSources({
+      types: getSourceTypes(),
+      thumbnailSize: { width: 100, height: 100 },
+      onSource: (source) => streamed.push(source)
+    });
+
+    expect(streamed).to.be.an('array').that.is.not.empty();
+    const streamedIds = streamed.map((source) => source.id);
+    expect(new Set(streamedIds).size).to.equal(streamedIds.length);
+    expect(sources.map((source) => source.id)).to.include.members(streamedIds);
+    for (const source of streamed) {
+      expect(source.thumbnail.isEmpty()).to.be.false();
+    }
+  });
+
+  it('reuses cached thumbnails within thumbnailCacheMaxAge', async () => {
+    const options = {
+      types: getSourceTypes(),
+      thumbnailSize: { width: 100, height: 100 },
+      thumbnailCacheMaxAge: 60 * 1000
+    };
+    const first = await desktopCapturer.getSources(options);
+    const second = await desktopCapturer.getSources(options);
+    expect(second.map((source) => source.id)).to.include.members(first.map((source) => source.id));
+    for (const source of second) {
+      expect(source.thumbnail.isEmpty()).to.be.false();
+    }
+  });
+
+  describe('setMaxConcurrentRequests(limit)', () => {
+    afterEach(() => {
+      desktopCapturer.setMaxConcurrentRequests(Infinity);
+    });
+
+    it('queues requests beyond the limit', async () => {
+      desktopCapturer.setMaxConcurrentRequests(1);
+      const results = await Promise.all([
+        desktopCapturer.getSources({ types: getSourceTypes(), thumbnailSize: { width: 0, height: 0 } }),
+        desktopCapturer.getSources({ types: getSourceTypes(), thumbnailSize: { width: 10, height: 10 } })
+      ]);
+      for (const sources of results) {
+        expect(sources).to.be.an('array').that.is.not.empty();
+      }
+    });
+
+    it('rejects invalid limits', () => {
+      expect(() => desktopCapturer.setMaxConcurrentRequests(0)).to.throw(/positive integer/);
+      expect(() => desktopCapturer.setMaxConcurrentRequests(1.5)).to.throw(/positive integer/);
+    });
+  });
+
   // Linux doesn't return any window sources.
   ifit(process.platform !== 'linux')('getMediaSourceId should match DesktopCapturerSource.id', async function () {
     const w2 = new BrowserWindow({ show: false, width: 100, height: 100, webPreferences: { contextIsolation: false } });
@@ -125,6 +125,78 @@ describe('netLog module', () => {
     ).to.be.true('uuid present in dump');
   });
 
+  describe('ring buffer', () => {
+    const makeRequest = (url: string) => new Promise<void>((resolve) => {
+      const req = net.request({ url, session: session.fromPartition('net-log') });
+      req.on('response', (response) => {
+        response.on('data', () => {});
+        response.on('end', () => resolve());
+      });
+      req.end();
+    });
+
+    afterEach(async () => {
+      if (testNetLog().ringBufferActive) {
+        await testNetLog().stopRingBuffer();
+      }
+    });
+
+    it('records recent events and dumps them on demand', async () => {
+      await testNetLog().startRingBuffer();
+      expect(testNetLog().ringBufferActive).to.be.true('ring buffer active');
+      const unique = require('uuid').v4();
+      await makeRequest(`${serverUrl}/${unique}`);
+      await testNetLog().dumpRingBuffer(dumpFileDynamic);
+      const dump = JSON.parse(fs.readFileSync(dumpFileDynamic, 'utf8'));
+      expect(dump.constants).to.be.an('object');
+      expect(JSON.stringify(dump.events)).to.contain(unique);
+      // Recording continues after a dump.
+      expect(testNetLog().ringBufferActive).to.be.true('ring buffer active');
+      await testNetLog().stopRingBuffer();
+      expect(testNetLog().ringBufferActive).to.be.false('ring buffer active');
+    });
+
+    it('keeps its history across repeated dumps', async () => {
+      await testNetLog().startRingBuffer();
+      const unique = require('uuid').v4();
+      await makeRequest(`${serverUrl}/${unique}`);
+      for (let i = 0; i < 10; i++) {
+        await testNetLog().dumpRingBuffer(dumpFileDynamic);
+      }
+      const dump = JSON.parse(fs.readFileSync(dumpFileDynamic, 'utf8'));
+      expect(JSON.stringify(dump.events)).to.contain(unique);
+    });
+
+    it('filters dumped events by source type', async () => {
+      await testNetLog().startRingBuffer();
+      await makeRequest(serverUrl);
+      await testNetLog().dumpRingBuffer(dumpFileDynamic, { sourceTypes: ['URL_REQUEST'] });
+      const dump = JSON.parse(fs.readFileSync(dumpFileDynamic, 'utf8'));
+      const urlRequest = dump.constants.logSourceType.URL_REQUEST;
+      expect(dump.events).to.not.be.empty();
+      for (const event of dump.events) {
+        expect(event.source.type).to.equal(urlRequest);
+      }
+    });
+
+    it('rejects unknown type names', async () => {
+      await testNetLog().startRingBuffer();
+      await expect(testNetLog().dumpRingBuffer(dumpFileDynamic, { eventTypes: ['NOT_A_REAL_EVENT'] }))
+        .to.be.rejectedWith(/Unknown net log type/);
+    });
+
+    it('rejects when no ring buffer is running', async () => {
+      await expect(testNetLog().dumpRingBuffer(dumpFileDynamic)).to.be.rejectedWith('No net log ring buffer in progress');
+      await expect(testNetLog().stopRingBuffer()).to.be.rejectedWith('No net log ring buffer in progress');
+    });
+
+    it('throws when started twice or with invalid options', async () => {
+      expect(() => testNetLog().startRingBuffer({ duration: 'foo' as any })).to.throw(/Invalid value for duration/);
+      await testNetLog().startRingBuffer();
+      expect(() => testNetLog().startRingBuffer()).to.throw(/already a net log ring buffer running/);
+    });
+  });
+
   ifit(process.platform !== 'linux')(
     'should begin and end logging automatically when --log-net-log is passed',
     async () => {
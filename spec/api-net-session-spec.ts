@@ -671,6 +671,34 @@ describe('net module (session)', () => {
     });
   });
 
+  describe('network statistics', () => {
+    it('aggregates requests made through the session', async () => {
+      const sess = session.fromPartition(`net-stats-${Math.random()}`);
+      expect(sess.getNetworkStatistics()).to.include({ requests: 0, encodedBytesReceived: 0 });
+      const serverUrl = await respondNTimes.toSingleURL((request, response) => {
+        response.end('hello');
+      }, 2);
+      await (await sess.fetch(serverUrl)).text();
+      await (await sess.fetch(serverUrl)).text();
+      const stats = sess.getNetworkStatistics();
+      expect(stats.requests).to.equal(2);
+      expect(stats.failedRequests).to.equal(0);
+      expect(stats.decodedBytesReceived).to.equal(2 * 'hello'.length);
+      expect(stats.encodedBytesReceived).to.be.greaterThan(stats.decodedBytesReceived);
+      expect(stats.totalDuration).to.be.at.least(stats.totalTimeToFirstByte);
+      // Other sessions are unaffected.
+      expect(session.fromPartition(`net-stats-${Math.random()}`).getNetworkStatistics().requests).to.equal(0);
+    });
+
+    it('counts failed requests and can be cleared', async () => {
+      const sess = session.fromPartition(`net-stats-${Math.random()}`);
+      await expect(sess.fetch('http://127.0.0.1:1')).to.eventually.be.rejected();
+      expect(sess.getNetworkStatistics()).to.include({ requests: 1, failedRequests: 1 });
+      sess.clearNetworkStatistics();
+      expect(sess.getNetworkStatistics()).to.include({ requests: 0, failedRequests: 0 });
+    });
+  });
+
   describe('net.fetch', () => {
     it('should be able to use a session cookie store', async () => {
       const serverUrl = await respondOnce.toSingleURL((request, response) => {
@@ -1127,6 +1127,38 @@ describe('net module', () => {
         expect(netRequest.getUploadProgress()).to.deep.equal({ active: true, started: true, current: position, total });
       });
 
+      test('should report request timing and byte counts once finished', async () => {
+        const body = 'x'.repeat(1024);
+        const serverUrl = await respondOnce.toSingleURL((request, response) => {
+          response.end(body);
+        });
+        const urlRequest = net.request(serverUrl);
+        expect(urlRequest.getTiming()).to.be.null();
+        const response = await getResponse(urlRequest);
+        await collectStreamBody(response);
+        const timing = urlRequest.getTiming()!;
+        expect(timing).to.be.an('object');
+        expect(timing.startTime).to.be.closeTo(Date.now(), 60 * 1000);
+        for (const key of ['dns', 'connect', 'tls', 'send', 'ttfb', 'transfer', 'total'] as const) {
+          expect(timing[key]).to.be.a('number').and.to.be.at.least(0);
+        }
+        expect(timing.total).to.be.at.least(timing.ttfb);
+        expect(timing.tls).to.equal(0);
+        expect(timing.fromCache).to.be.false();
+        expect(timing.decodedBodyLength).to.equal(body.length);
+        expect(timing.encodedDataLength).to.be.greaterThan(body.length);
+      });
+
+      test('should report request timing when the request fails', async () => {
+        const serverUrl = await respondOnce.toSingleURL((request) => {
+          request.socket.destroy();
+        });
+        const urlRequest = net.request(serverUrl);
+        urlRequest.end();
+        await once(urlRequest, 'error');
+        expect(urlRequest.getTiming()).to.be.an('object');
+      });
+
       test('should emit error event on server socket destroy', async () => {
         const serverUrl = await respondOnce.toSingleURL((request) => {
           request.socket.destroy();
@@ -1804,6 +1836,39 @@ describe('net module', () => {
         );
       });
     });
+
+    describe('net.resolveHosts', () => {
+      test('resolves hosts in parallel and reports each in order', async () => {
+        const results = await net.resolveHosts(['ipv6.localhost2', 'notfound.localhost2', 'ipv4.localhost2']);
+        expect(results.map((r) => r.host)).to.deep.equal(['ipv6.localhost2', 'notfound.localhost2', 'ipv4.localhost2']);
+
+        expect(results[0].error).to.be.undefined();
+        expect(results[0].endpoints).to.deep.equal([{ family: 'ipv6', address: '::1' }]);
+
+        expect(results[1].error).to.match(/net::ERR_NAME_NOT_RESOLVED/);
+        expect(results[1].endpoints).to.be.empty();
+
+        expect(results[2].error).to.be.undefined();
+        expect(results[2].endpoints).to.deep.equal([{ family: 'ipv4', address: '10.0.0.1' }]);
+
+        for (const { latency } of results) {
+          expect(latency).to.be.a('number').that.is.at.least(0);
+        }
+      });
+
+      test('applies resolver options to every host', async () => {
+        const results = await net.resolveHosts(['ipv4.localhost2'], { queryType: 'AAAA' });
+        expect(results[0].error).to.match(/net::ERR_NAME_NOT_RESOLVED/);
+      });
+
+      test('resolves with an empty array when given no hosts', async () => {
+        expect(await net.resolveHosts([])).to.deep.equal([]);
+      });
+
+      test('rejects an out of range numSockets', () => {
+        expect(() => net.resolveHosts(['ipv4.localhost2'], { preconnect: true, numSockets: 7 })).to.throw(/numSockets/);
+      });
+    });
   }
 
   for (const test of [itIgnoringArgs]) {
@@ -310,6 +310,89 @@ describe('net.WebSocket', () => {
     });
   });
 
+  describe('batching and backpressure', () => {
+    it('delivers a burst of small messages in order', async () => {
+      const count = 1000;
+      const { url } = await startWSServer((ws) => {
+        for (let i = 0; i < count; i++) {
+          ws.send(i % 2 ? String(i) : Buffer.from([i & 0xff]));
+        }
+      });
+      const ws = new net.WebSocket(url);
+      defer(() => ws.close());
+      const received: (string | number)[] = [];
+      ws.addEventListener('message', (e: any) => {
+        received.push(typeof e.data === 'string' ? e.data : e.data[0]);
+      });
+      await new Promise<void>((resolve) => {
+        const check = () => {
+          if (received.length >= count) resolve();
+          else setTimeout(check, 10);
+        };
+        check();
+      });
+      expect(received).to.deep.equal(Array.from({ length: count }, (_, i) => (i % 2 ? String(i) : i & 0xff)));
+      ws.close();
+      await event(ws, 'close');
+    });
+
+    it('exposes each batched message as a standalone ArrayBuffer', async () => {
+      const { url } = await startWSServer((ws) => {
+        ws.send(Buffer.from([1, 2]));
+        ws.send(Buffer.from([3, 4, 5]));
+      });
+      const ws = new net.WebSocket(url);
+      defer(() => ws.close());
+      ws.binaryType = 'arraybuffer';
+      const received: number[][] = [];
+      await new Promise<void>((resolve) => {
+        ws.onmessage = (e: MessageEvent) => {
+          expect(e.data).to.be.an.instanceOf(ArrayBuffer);
+          received.push([...new Uint8Array(e.data)]);
+          if (received.length === 2) resolve();
+        };
+      });
+      expect(received).to.deep.equal([
+        [1, 2],
+        [3, 4, 5]
+      ]);
+      ws.close();
+      await event(ws, 'close');
+    });
+
+    it('fires bufferedamountlow once the send queue drains', async () => {
+      const { url } = await startWSServer();
+      const ws = new net.WebSocket(url);
+      defer(() => ws.close());
+      await event(ws, 'open');
+      expect(ws.bufferedAmountLowThreshold).to.equal(0);
+      ws.bufferedAmountLowThreshold = 1024;
+      expect(ws.bufferedAmountLowThreshold).to.equal(1024);
+      ws.send(Buffer.alloc(4 * 1024 * 1024));
+      expect(ws.bufferedAmount).to.be.greaterThan(1024);
+      await event(ws, 'bufferedamountlow');
+      expect(ws.bufferedAmount).to.be.at.most(1024);
+      ws.close();
+      await event(ws, 'close');
+    });
+
+    it('throws QuotaExceededError when maxBufferedAmount would be exceeded', async () => {
+      const { url } = await startWSServer();
+      const ws = new net.WebSocket(url, { maxBufferedAmount: 1024 * 1024 });
+      defer(() => ws.close());
+      await event(ws, 'open');
+      expect(() => ws.send(Buffer.alloc(2 * 1024 * 1024))).to.throw(DOMException, /maxBufferedAmount/);
+      expect(ws.bufferedAmount).to.equal(0);
+      ws.send(Buffer.alloc(1024));
+      ws.close();
+      await event(ws, 'close');
+    });
+
+    it('rejects an invalid maxBufferedAmount', () => {
+      expect(() => new net.WebSocket('ws://127.0.0.1:1', { maxBufferedAmount: -1 })).to.throw(TypeError);
+    });
+  });
+
   describe('Electron options', () => {
     it('sends extra headers with the handshake', async () => {
       let headers: http.IncomingHttpHeaders = {};
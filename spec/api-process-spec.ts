@@ -107,6 +107,81 @@ describe('process module', () => {
         expect(success).to.be.false();
       });
     });
+
+    describe('process.startCpuProfiler()', () => {
+      it('writes a .cpuprofile file', async () => {
+        const filePath = path.join(app.getPath('temp'), 'test.cpuprofile');
+        defer(() => {
+          try {
+            fs.unlinkSync(filePath);
+          } catch {
+            // ignore error
+          }
+        });
+
+        const started = await invoke(() => process.startCpuProfiler({ samplingInterval: 100 }));
+        expect(started).to.be.true();
+        await invoke((filePath: string) => process.stopCpuProfiler(filePath), filePath);
+        const profile = JSON.parse(fs.readFileSync(filePath, 'utf8'));
+        expect(profile.nodes[0].callFrame.functionName).to.equal('(root)');
+        expect(profile.startTime).to.be.at.most(profile.endTime);
+        expect(profile.samples).to.have.lengthOf(profile.timeDeltas.length);
+      });
+
+      it('returns false when already running', async () => {
+        const filePath = path.join(app.getPath('temp'), 'test-twice.cpuprofile');
+        defer(() => {
+          try {
+            fs.unlinkSync(filePath);
+          } catch {
+            // ignore error
+          }
+        });
+
+        await invoke(() => process.startCpuProfiler());
+        const started = await invoke(() => process.startCpuProfiler());
+        await invoke((filePath: string) => process.stopCpuProfiler(filePath), filePath);
+        expect(started).to.be.false();
+      });
+
+      it('throws on invalid options', async () => {
+        const start = async () => invoke(() => process.startCpuProfiler({ samplingInterval: 0 }));
+        await expect(start()).to.eventually.be.rejectedWith(/'samplingInterval' must be between 1 and 1000000/);
+      });
+
+      it('rejects stopping when not running', async () => {
+        await expect(invoke(() => process.stopCpuProfiler('unused.cpuprofile'))).to.eventually.be.rejectedWith(
+          'The CPU profiler is not running'
+        );
+      });
+    });
+
+    describe('process.startSamplingHeapProfiler()', () => {
+      it('returns the sampled allocations', async () => {
+        const profile = await invoke(() => {
+          process.startSamplingHeapProfiler({ samplingInterval: 1024 });
+          (globalThis as any).retained = Array.from({ length: 10000 }, (_, i) => ({ i }));
+          return process.stopSamplingHeapProfiler();
+        });
+        expect(profile.head.callFrame).to.have.property('functionName');
+        expect(profile.samples).to.be.an('array').that.is.not.empty();
+      });
+
+      it('returns false when already running', async () => {
+        const started = await invoke(() => {
+          process.startSamplingHeapProfiler();
+          const startedTwice = process.startSamplingHeapProfiler();
+          process.stopSamplingHeapProfiler();
+          return startedTwice;
+        });
+        expect(started).to.be.false();
+      });
+
+      it('returns null from stop when not running', async () => {
+        const profile = await invoke(() => process.stopSamplingHeapProfiler());
+        expect(profile).to.be.null();
+      });
+    });
   }
 
   describe('renderer process', () => {
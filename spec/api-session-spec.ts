@@ -6,6 +6,7 @@ import {
   ipcMain,
   Session,
   utilityProcess,
+  webContents,
   webFrameMain,
   WebFrameMain
 } from 'electron/main';
@@ -323,6 +324,108 @@ describe('session module', () => {
       expect(actual).to.deep.equal(expected);
     });
 
+    describe('ses.cookies.setMany()', () => {
+      it('sets many cookies and reports failures by index', async () => {
+        const { cookies } = session.fromPartition('cookies-set-many');
+        const result = await cookies.setMany([
+          { url, name: 'a', value: '1' },
+          { url: 'not a url', name: 'b', value: '2' },
+          { url, name: 'c', value: '3', sameSite: 'bogus' as any },
+          { url, name: 'd', value: '4' }
+        ]);
+        expect(result.succeeded).to.equal(2);
+        expect(result.failures.map(({ index }) => index)).to.deep.equal([1, 2]);
+        expect(result.failures[1].error).to.contain('bogus');
+        const list = await cookies.get({ url });
+        expect(list.map(({ name }) => name).sort()).to.deep.equal(['a', 'd']);
+      });
+
+      it('imports 10k cookies', async function () {
+        this.timeout(60000);
+        const { cookies } = session.fromPartition('cookies-set-many-bulk');
+        // Spread over 100 registrable domains to stay under the limit of 180
+        // cookies per domain. The store also keeps at most 3300 cookies in
+        // total and purges down to 3000 beyond that, so only the import
+        // itself sees all 10k.
+        const count = 10000;
+        const details = Array.from({ length: count }, (_, i) => ({
+          url: `http://host${i % 100}-test.com`,
+          name: `cookie${i}`,
+          value: `${i}`,
+          expirationDate: Date.now() / 1000 + 120
+        }));
+        const result = await cookies.setMany(details);
+        expect(result.succeeded).to.equal(count);
+        expect(result.failures).to.be.empty();
+        const stored = (await cookies.get({})).length;
+        expect(stored).to.be.within(3000, 3300);
+
+        const removed = await cookies.removeMany(details.map(({ url, name }) => ({ url, name })));
+        expect(removed).to.equal(stored);
+        expect(await cookies.get({})).to.be.empty();
+      });
+    });
+
+    describe('ses.cookies.removeMany()', () => {
+      it('removes the listed cookies', async () => {
+        const { cookies } = session.fromPartition('cookies-remove-many');
+        await cookies.setMany(['a', 'b', 'c'].map((name) => ({ url, name, value: name })));
+        const removed = await cookies.removeMany([
+          { url, name: 'a' },
+          { url, name: 'c' },
+          { url, name: 'missing' }
+        ]);
+        expect(removed).to.equal(2);
+        const list = await cookies.get({ url });
+        expect(list.map(({ name }) => name)).to.deep.equal(['b']);
+      });
+
+      it('rejects entries without a url or name', async () => {
+        const { cookies } = session.fromPartition('cookies-remove-many');
+        await expect(cookies.removeMany([{ url } as any])).to.be.rejectedWith(/'url' and a 'name'/);
+      });
+    });
+
+    describe('ses.cookies.changeBatchInterval', () => {
+      it('emits changes in batches instead of one event each', async () => {
+        const { cookies } = session.fromPartition('cookies-change-batch');
+        cookies.changeBatchInterval = 50;
+        defer(() => {
+          cookies.changeBatchInterval = 0;
+        });
+        let singleEvents = 0;
+        const onChanged = () => { singleEvents++; };
+        cookies.on('changed', onChanged);
+        defer(() => cookies.removeListener('changed', onChanged));
+
+        const batches: any[][] = [];
+        const received = new Promise<void>((resolve) => {
+          let total = 0;
+          cookies.on('changed-batch', (_event, changes) => {
+            batches.push(changes);
+            total += changes.length;
+            if (total === 3) resolve();
+          });
+        });
+        await cookies.setMany(['a', 'b', 'c'].map((name) => ({ url, name, value: name })));
+        await received;
+
+        expect(singleEvents).to.equal(0);
+        expect(batches.length).to.be.lessThan(3);
+        const changes = batches.flat();
+        expect(changes.map(({ cookie }) => cookie.name).sort()).to.deep.equal(['a', 'b', 'c']);
+        for (const change of changes) {
+          expect(change.cause).to.equal('inserted');
+          expect(change.removed).to.be.false();
+        }
+      });
+
+      it('rejects negative intervals', () => {
+        const { cookies } = session.fromPartition('cookies-change-batch');
+        expect(() => { cookies.changeBatchInterval = -1; }).to.throw(/non-negative/);
+      });
+    });
+
     describe('ses.cookies.flushStore()', async () => {
       it('flushes the cookies to disk', async () => {
         const name = 'foo';
@@ -2093,6 +2196,104 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.startIpcProfiling()', () => {
+    afterEach(closeAllWindows);
+
+    const createWindow = async () => {
+      const ses = session.fromPartition(`ipc-profiling-${Math.random()}`);
+      const w = new BrowserWindow({
+        show: false,
+        webPreferences: { session: ses, nodeIntegration: true, contextIsolation: false }
+      });
+      await w.loadURL('about:blank');
+      return { ses, w };
+    };
+
+    it('records messages per channel and type', async () => {
+      const { ses, w } = await createWindow();
+      ipcMain.handle('profiled-invoke', () => 'reply');
+      defer(() => ipcMain.removeHandler('profiled-invoke'));
+      ipcMain.on('profiled-sync', (event) => { event.returnValue = 'reply'; });
+      defer(() => ipcMain.removeAllListeners('profiled-sync'));
+
+      ses.startIpcProfiling();
+      const received = once(ipcMain, 'profiled-send');
+      await w.webContents.executeJavaScript(`(async () => {
+        const { ipcRenderer } = require('electron');
+        ipcRenderer.send('profiled-send', 'hello');
+        ipcRenderer.sendSync('profiled-sync', 'hello');
+        await ipcRenderer.invoke('profiled-invoke', 'hello');
+        await ipcRenderer.invoke('profiled-invoke', 'hello');
+      })()`);
+      await received;
+      ses.stopIpcProfiling();
+
+      const profile = ses.getIpcProfile();
+      const find = (channel: string, type: string) =>
+        profile.find(entry => entry.channel === channel && entry.type === type);
+
+      const send = find('profiled-send', 'send');
+      expect(send).to.not.be.undefined();
+      expect(send!.count).to.equal(1);
+      expect(send!.bytes).to.be.greaterThan(0);
+      expect(send!.replyBytes).to.be.undefined();
+      expect(send!.latency.count).to.equal(1);
+
+      const invoke = find('profiled-invoke', 'invoke');
+      expect(invoke).to.not.be.undefined();
+      expect(invoke!.count).to.equal(2);
+      expect(invoke!.replyBytes).to.be.greaterThan(0);
+      expect(invoke!.latency.count).to.equal(2);
+      expect(invoke!.latency.buckets.reduce((a, b) => a + b)).to.equal(2);
+
+      const sendSync = find('profiled-sync', 'send-sync');
+      expect(sendSync).to.not.be.undefined();
+      expect(sendSync!.count).to.equal(1);
+      expect(sendSync!.replyBytes).to.be.greaterThan(0);
+    });
+
+    it('counts messages passed in shared memory', async () => {
+      const { ses, w } = await createWindow();
+      ses.startIpcProfiling();
+      await w.webContents.executeJavaScript(`
+        require('electron').ipcRenderer.send('profiled-large', 'x'.repeat(1024 * 1024));
+      `);
+      await waitUntil(() => ses.getIpcProfile().length > 0);
+
+      const [entry] = ses.getIpcProfile().filter(entry => entry.channel === 'profiled-large');
+      expect(entry.count).to.equal(1);
+      expect(entry.sharedMemoryCount).to.equal(1);
+      expect(entry.sharedMemoryBytes).to.equal(entry.bytes);
+    });
+
+    it('discards what was recorded when started again', async () => {
+      const { ses, w } = await createWindow();
+      ses.startIpcProfiling();
+      w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'profiled-send\')');
+      await waitUntil(() => ses.getIpcProfile().length === 1);
+      ses.startIpcProfiling();
+      expect(ses.getIpcProfile()).to.deep.equal([]);
+    });
+
+    it('records nothing unless started', async () => {
+      const { ses, w } = await createWindow();
+      const received = once(ipcMain, 'profiled-send');
+      w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'profiled-send\')');
+      await received;
+      expect(ses.getIpcProfile()).to.deep.equal([]);
+    });
+
+    it('records nothing after being stopped', async () => {
+      const { ses, w } = await createWindow();
+      ses.startIpcProfiling();
+      ses.stopIpcProfiling();
+      const received = once(ipcMain, 'profiled-send');
+      w.webContents.executeJavaScript('require(\'electron\').ipcRenderer.send(\'profiled-send\')');
+      await received;
+      expect(ses.getIpcProfile()).to.deep.equal([]);
+    });
+  });
+
   describe('ses.isPersistent()', () => {
     afterEach(closeAllWindows);
 
@@ -2117,6 +2318,90 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setWarmWebContentsPool(options)', () => {
+    afterEach(closeAllWindows);
+
+    // Pooled WebContents are not enumerated, so look them up by the ids that
+    // follow the ones in use when the pool was set up.
+    const lastWebContentsId = () => Math.max(0, ...webContents.getAllWebContents().map((wc) => wc.id));
+    const pooledContents = (ses: Session, sinceId: number) =>
+      Array.from({ length: 20 }, (_, i) => webContents.fromId(sinceId + 1 + i))
+        .filter((wc): wc is Electron.WebContents => !!wc && wc.session === ses && !wc.isDestroyed());
+
+    it('lets a BrowserWindow with matching preferences adopt a warm WebContents', async () => {
+      const ses = session.fromPartition(`warm-pool-${Math.random()}`);
+      defer(() => ses.setWarmWebContentsPool(null));
+      const sinceId = lastWebContentsId();
+      const webPreferences = { sandbox: true, contextIsolation: true };
+      ses.setWarmWebContentsPool({ size: 1, webPreferences });
+      await waitUntil(() => ses.getWarmWebContentsPoolStats().ready === 1);
+      const [pooled] = pooledContents(ses, sinceId);
+      expect(pooled.getURL()).to.equal('about:blank');
+
+      const w = new BrowserWindow({ show: false, webPreferences: { ...webPreferences, session: ses } });
+      expect(w.webContents.id).to.equal(pooled.id);
+      const stats = ses.getWarmWebContentsPoolStats();
+      expect(stats.adopted).to.equal(1);
+      expect(stats.averageWarmupTime).to.be.greaterThan(0);
+      expect(stats.averageAdoptionTime).to.be.a('number');
+
+      await w.loadURL('about:blank#adopted');
+      expect(w.webContents.getURL()).to.equal('about:blank#adopted');
+
+      // The pool is refilled in the background.
+      await waitUntil(() => ses.getWarmWebContentsPoolStats().ready === 1);
+      expect(pooledContents(ses, sinceId)).to.have.lengthOf(2);
+    });
+
+    it('hides pooled WebContents until they are adopted', async () => {
+      const ses = session.fromPartition(`warm-pool-${Math.random()}`);
+      defer(() => ses.setWarmWebContentsPool(null));
+      const created: Electron.WebContents[] = [];
+      const onCreated = (_: Electron.Event, contents: Electron.WebContents) => { created.push(contents); };
+      app.on('web-contents-created', onCreated);
+      defer(() => app.off('web-contents-created', onCreated));
+
+      ses.setWarmWebContentsPool({ size: 1 });
+      await waitUntil(() => ses.getWarmWebContentsPoolStats().ready === 1);
+      expect(webContents.getAllWebContents().filter((wc) => wc.session === ses)).to.be.empty();
+      expect(created).to.be.empty();
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses } });
+      expect(ses.getWarmWebContentsPoolStats().adopted).to.equal(1);
+      expect(created).to.deep.equal([w.webContents]);
+      expect(webContents.getAllWebContents()).to.include(w.webContents);
+    });
+
+    it('does not hand out WebContents with different preferences', async () => {
+      const ses = session.fromPartition(`warm-pool-${Math.random()}`);
+      defer(() => ses.setWarmWebContentsPool(null));
+      const sinceId = lastWebContentsId();
+      ses.setWarmWebContentsPool({ size: 1, webPreferences: { sandbox: true } });
+      await waitUntil(() => ses.getWarmWebContentsPoolStats().ready === 1);
+      const [pooled] = pooledContents(ses, sinceId);
+
+      const w = new BrowserWindow({ show: false, webPreferences: { sandbox: false, session: ses } });
+      expect(w.webContents.id).to.not.equal(pooled.id);
+      expect(ses.getWarmWebContentsPoolStats()).to.include({ adopted: 0, misses: 1 });
+    });
+
+    it('destroys unadopted WebContents when the pool is emptied', async () => {
+      const ses = session.fromPartition(`warm-pool-${Math.random()}`);
+      const sinceId = lastWebContentsId();
+      ses.setWarmWebContentsPool({ size: 2 });
+      await waitUntil(() => ses.getWarmWebContentsPoolStats().ready === 2);
+      const pooled = pooledContents(ses, sinceId);
+      expect(pooled).to.have.lengthOf(2);
+      ses.setWarmWebContentsPool(null);
+      await waitUntil(() => pooled.every((wc) => wc.isDestroyed()));
+      expect(ses.getWarmWebContentsPoolStats().size).to.equal(0);
+    });
+
+    it('validates the pool size', () => {
+      expect(() => session.defaultSession.setWarmWebContentsPool({ size: 9 })).to.throw(/outside range/);
+    });
+  });
+
   describe('ses.setUserAgent()', () => {
     afterEach(closeAllWindows);
 
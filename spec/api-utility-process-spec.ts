@@ -13,7 +13,7 @@ import { setImmediate } from 'node:timers/promises';
 import { pathToFileURL } from 'node:url';
 
 import { respondOnce, randomString, kOneKiloByte } from './lib/net-helpers';
-import { ifit, listen, startRemoteControlApp } from './lib/spec-helpers';
+import { ifit, listen, startRemoteControlApp, waitUntil } from './lib/spec-helpers';
 import { closeWindow } from './lib/window-helpers';
 
 const fixturesPath = path.resolve(__dirname, 'fixtures', 'api', 'utility-process');
@@ -489,6 +489,303 @@ describe('utilityProcess module', () => {
       expect(child.kill()).to.be.true();
       await exit;
     });
+
+    describe('transferring ArrayBuffers', () => {
+      let child: Electron.UtilityProcess;
+      beforeEach(async () => {
+        child = utilityProcess.fork(path.join(fixturesPath, 'transfer-array-buffer.js'));
+        await once(child, 'spawn');
+      });
+      afterEach(async () => {
+        const exit = once(child, 'exit');
+        child.kill();
+        await exit;
+      });
+
+      for (const size of [1024, 1024 * 1024, 64 * 1024 * 1024]) {
+        it(`moves a buffer of ${size} bytes both ways`, async () => {
+          const buffer = new ArrayBuffer(size);
+          const bytes = new Uint8Array(buffer);
+          for (let i = 0; i < size; i += 4096) bytes[i] = i % 251;
+          const messages = once(child, 'message');
+          child.postMessage({ buffer }, [buffer]);
+          expect(buffer.byteLength).to.equal(0);
+
+          const [{ buffer: received }] = await messages;
+          expect(received).to.be.an.instanceOf(ArrayBuffer);
+          expect(received.byteLength).to.equal(size);
+          const receivedBytes = new Uint8Array(received);
+          for (let i = 0; i < size; i += 4096) {
+            expect(receivedBytes[i]).to.equal(~(i % 251) & 0xff);
+          }
+          const [{ byteLength }] = await once(child, 'message');
+          expect(byteLength).to.equal(0);
+        });
+      }
+
+      it('throws when a buffer is listed twice', () => {
+        const buffer = new ArrayBuffer(8);
+        expect(() => child.postMessage({ buffer }, [buffer, buffer])).to.throw(/ArrayBuffer at index 1 could not be transferred/);
+        expect(buffer.byteLength).to.equal(8);
+      });
+
+      it('throws when a buffer was already transferred', () => {
+        const buffer = new ArrayBuffer(8);
+        child.postMessage(null, [buffer]);
+        expect(() => child.postMessage(null, [buffer])).to.throw(/ArrayBuffer at index 0 could not be transferred/);
+      });
+
+      it('only lets the child transfer ArrayBuffers', async () => {
+        child.postMessage('transfer-non-array-buffer');
+        const [message] = await once(child, 'message');
+        expect(message).to.equal('Transferable at index 0 is not an ArrayBuffer');
+      });
+    });
+  });
+
+  describe('codeCache option', () => {
+    const scriptPath = path.join(fixturesPath, 'compile-cache-dir.js');
+    const getCompileCacheDir = async (options?: Electron.ForkOptions) => {
+      const child = utilityProcess.fork(scriptPath, [], options);
+      const [dir] = await once(child, 'message');
+      const exit = once(child, 'exit');
+      child.kill();
+      await exit;
+      return dir;
+    };
+
+    it('caches compiled modules in the code cache directory of the session', async () => {
+      // Node.js logs whether the cache it read for a module was accepted.
+      const fork = () => utilityProcess.fork(scriptPath, [], {
+        stdio: ['ignore', 'ignore', 'pipe'],
+        env: { ...process.env, NODE_DEBUG_NATIVE: 'COMPILE_CACHE' }
+      });
+      const kill = async (child: Electron.UtilityProcess) => {
+        const exit = once(child, 'exit');
+        child.kill();
+        await exit;
+      };
+
+      const first = fork();
+      first.stderr!.resume();
+      const [dir] = await once(first, 'message');
+      expect(dir).to.be.a('string');
+      expect(dir.startsWith(path.join(app.getPath('userData'), 'Code Cache', 'electron-utility'))).to.be.true();
+      // The cache is flushed once the entry script has run.
+      await waitUntil(() => first.getLaunchTiming().readyDuration !== undefined);
+      await waitUntil(async () => {
+        const entries = await fs.readdir(dir, { recursive: true }).catch(() => []);
+        return entries.length > 0;
+      });
+      await kill(first);
+
+      const second = fork();
+      let log = '';
+      second.stderr!.on('data', (chunk) => { log += chunk.toString('utf8'); });
+      await waitUntil(() => /cache for [^\n]*compile-cache-dir\.js was accepted/.test(log));
+      await kill(second);
+    });
+
+    it('does not cache when disabled', async () => {
+      expect(await getCompileCacheDir({ codeCache: false })).to.be.null();
+    });
+
+    it('does not cache for in-memory sessions', async () => {
+      expect(await getCompileCacheDir({ partition: 'utility-process-code-cache' })).to.be.null();
+    });
+  });
+
+  describe('keepSpare option', () => {
+    const scriptPath = path.join(fixturesPath, 'post-message.js');
+    let children: Electron.UtilityProcess[] = [];
+    const fork = (options?: Electron.ForkOptions) => {
+      const child = utilityProcess.fork(scriptPath, [], options);
+      children.push(child);
+      return child;
+    };
+    const waitForReady = (child: Electron.UtilityProcess) =>
+      waitUntil(() => child.getLaunchTiming().readyDuration !== undefined);
+
+    // Killing the last child forked with keepSpare also kills the spare.
+    afterEach(async () => {
+      await Promise.all(children.map(async (child) => {
+        if (child.pid === undefined) return;
+        const exit = once(child, 'exit');
+        child.kill();
+        await exit;
+      }));
+      children = [];
+    });
+
+    it('reports the launch timing of a process', async () => {
+      const child = fork();
+      await once(child, 'spawn');
+      await waitForReady(child);
+      const timing = child.getLaunchTiming();
+      expect(timing.fromSpare).to.be.false();
+      expect(timing.launchDuration).to.be.a('number').that.is.at.least(0);
+      expect(timing.readyDuration).to.be.a('number').that.is.at.least(0);
+    });
+
+    it('adopts the spare launched for a previous fork() with the same options', async () => {
+      const options = { keepSpare: true, serviceName: 'spare-test' };
+      const first = fork(options);
+      await waitForReady(first);
+
+      const second = fork(options);
+      expect(second.getLaunchTiming().fromSpare).to.be.true();
+      await once(second, 'spawn');
+      expect(second.pid).to.be.a('number').that.is.not.equal(first.pid);
+      second.postMessage('hello');
+      const [data] = await once(second, 'message');
+      expect(data).to.equal('hello');
+      await waitForReady(second);
+    });
+
+    it('does not adopt a spare launched with other options', async () => {
+      const first = fork({ keepSpare: true, serviceName: 'spare-test-a' });
+      await waitForReady(first);
+      const second = fork({ keepSpare: true, serviceName: 'spare-test-b' });
+      expect(second.getLaunchTiming().fromSpare).to.be.false();
+      await once(second, 'spawn');
+    });
+
+    it('replaces a spare that has not launched yet', async () => {
+      const first = fork({ keepSpare: true, serviceName: 'spare-test-unlaunched-a' });
+      await waitForReady(first);
+      // The spare for |first| is launched once it is ready, so this replaces
+      // it before its launch has completed.
+      const second = fork({ keepSpare: true, serviceName: 'spare-test-unlaunched-b' });
+      expect(second.getLaunchTiming().fromSpare).to.be.false();
+      await once(second, 'spawn');
+      second.postMessage('hello');
+      const [data] = await once(second, 'message');
+      expect(data).to.equal('hello');
+      await waitUntil(() => !app.getAppMetrics().some(metric => metric.name === 'spare-test-unlaunched-a' && metric.pid !== first.pid));
+    });
+
+    it('kills the spare once no process forked with keepSpare is left', async () => {
+      const serviceName = 'spare-test-release';
+      const countProcesses = () => app.getAppMetrics().filter(metric => metric.name === serviceName).length;
+      const child = fork({ keepSpare: true, serviceName });
+      await waitForReady(child);
+      await waitUntil(() => countProcesses() === 2);
+      const exit = once(child, 'exit');
+      child.kill();
+      await exit;
+      await waitUntil(() => countProcesses() === 0);
+    });
+
+    it('validates the option', () => {
+      expect(() => utilityProcess.fork(scriptPath, [], { keepSpare: 'yes' as any })).to.throw(/keepSpare must be a boolean/);
+    });
+  });
+
+  describe('utilityProcess.createPool()', () => {
+    const workerPath = path.join(fixturesPath, 'pool-worker.js');
+    let pools: Electron.UtilityProcessPool[] = [];
+    const createPool = (options?: Electron.CreatePoolOptions) => {
+      const pool = utilityProcess.createPool(workerPath, [], options);
+      pools.push(pool);
+      return pool;
+    };
+
+    afterEach(async () => {
+      await Promise.all(pools.map(pool => pool.close()));
+      pools = [];
+    });
+
+    it('throws when options are not valid', () => {
+      expect(() => utilityProcess.createPool('')).to.throw(/Missing UtilityProcessPool entry script/);
+      expect(() => utilityProcess.createPool(workerPath, [], { size: 0 })).to.throw(/size must be a positive integer/);
+      expect(() => utilityProcess.createPool(workerPath, [], { maxTasksPerWorker: 1.5 })).to.throw(/maxTasksPerWorker must be a positive integer/);
+      expect(() => utilityProcess.createPool(workerPath, [], { stdio: 'pipe' })).to.throw(/stdio must be one of the following values: inherit, ignore/);
+    });
+
+    it('resolves with the result of the task', async () => {
+      const pool = createPool({ size: 1 });
+      expect(await pool.run({ op: 'double', value: 21 })).to.equal(42);
+    });
+
+    it('rejects with the error the task throws', async () => {
+      const pool = createPool({ size: 1 });
+      await expect(pool.run({ op: 'throw', value: 'task failed' })).to.eventually.be.rejectedWith('task failed');
+      expect(pool.getStats().workers[0].failedTasks).to.equal(1);
+    });
+
+    it('runs tasks on different workers in parallel', async () => {
+      const pool = createPool({ size: 2 });
+      const pids = await Promise.all([
+        pool.run({ op: 'pid', delay: 500 }),
+        pool.run({ op: 'pid', delay: 500 })
+      ]);
+      expect(pids[0]).to.not.equal(pids[1]);
+    });
+
+    it('queues tasks until a worker has room for them', async () => {
+      const pool = createPool({ size: 1, maxTasksPerWorker: 2 });
+      const tasks = [1, 2, 3, 4].map(value => pool.run({ op: 'double', value, delay: 200 }));
+      const stats = pool.getStats();
+      expect(stats.queueDepth).to.equal(2);
+      expect(stats.workers[0].activeTasks).to.equal(2);
+      expect(await Promise.all(tasks)).to.deep.equal([2, 4, 6, 8]);
+
+      const { queueDepth, workers: [worker] } = pool.getStats();
+      expect(queueDepth).to.equal(0);
+      expect(worker.activeTasks).to.equal(0);
+      expect(worker.completedTasks).to.equal(4);
+      expect(worker.utilization).to.be.greaterThan(0).and.at.most(1);
+    });
+
+    it('restarts workers that crash', async () => {
+      const pool = createPool({ size: 1 });
+      await pool.run({ op: 'double', value: 1 });
+      const workerExit = once(pool, 'worker-exit');
+      await expect(pool.run({ op: 'crash' })).to.eventually.be.rejectedWith(/exited with code/);
+      const [details] = await workerExit;
+      expect(details.exitCode).to.not.equal(0);
+      expect(details.restarted).to.be.true();
+      expect(await pool.run({ op: 'double', value: 2 })).to.equal(4);
+    });
+
+    it('stops restarting workers that fail to load', async () => {
+      const pool = utilityProcess.createPool(path.join(fixturesPath, 'pool-worker-fails-to-load.js'), [], { size: 1, stdio: 'ignore' });
+      pools.push(pool);
+      const task = pool.run({ op: 'double', value: 1 });
+      let details: { restarted: boolean };
+      do {
+        [details] = await once(pool, 'worker-exit');
+      } while (details.restarted);
+      await expect(task).to.eventually.be.rejected();
+      await expect(pool.run({ op: 'double', value: 1 })).to.eventually.be.rejectedWith(/no workers left/);
+    });
+
+    it('transfers ports along with the task', async () => {
+      const pool = createPool({ size: 1 });
+      const { port1, port2 } = new MessageChannelMain();
+      port2.start();
+      const received = once(port2, 'message');
+      expect(await pool.run({ op: 'port', value: 'hello' }, [port1])).to.equal('sent');
+      const [{ data }] = await received;
+      expect(data).to.equal('hello');
+    });
+
+    it('does not emit tasks as parentPort messages', async () => {
+      const pool = createPool({ size: 1 });
+      await pool.run({ op: 'double', value: 1 });
+      expect(await pool.run({ op: 'message-count' })).to.equal(0);
+    });
+
+    it('rejects queued and later tasks once closed', async () => {
+      const pool = createPool({ size: 1 });
+      const running = pool.run({ op: 'double', value: 1, delay: 10000 });
+      const queued = pool.run({ op: 'double', value: 2 });
+      await pool.close();
+      await expect(running).to.eventually.be.rejected();
+      await expect(queued).to.eventually.be.rejectedWith(/closed/);
+      await expect(pool.run({ op: 'double', value: 3 })).to.eventually.be.rejectedWith(/closed/);
+      expect(pool.getStats().workers).to.deep.equal([]);
+    });
   });
 
   describe('behavior', () => {
@@ -700,6 +997,48 @@ describe('utilityProcess module', () => {
       expect(log).to.equal('hello\n');
     });
 
+    it('can write a CPU profile', async () => {
+      const filePath = path.join(app.getPath('temp'), 'utility.cpuprofile');
+      const child = utilityProcess.fork(path.join(fixturesPath, 'cpu-profile.js'));
+      await once(child, 'spawn');
+      child.postMessage(filePath);
+      const [data] = await once(child, 'message');
+      expect(data).to.equal('written');
+      try {
+        const profile = JSON.parse(await fs.readFile(filePath, 'utf8'));
+        expect(profile.nodes).to.be.an('array').that.is.not.empty();
+        expect(profile.samples).to.be.an('array').that.is.not.empty();
+      } finally {
+        await fs.rm(filePath, { force: true });
+      }
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+    });
+
+    it('can write a CPU profile when asked by the main process', async () => {
+      const filePath = path.join(app.getPath('temp'), 'utility-remote.cpuprofile');
+      const child = utilityProcess.fork(path.join(fixturesPath, 'spin.js'));
+      await once(child, 'spawn');
+      expect(await child.startCpuProfiler({ samplingInterval: 100 })).to.be.true();
+      expect(await child.startCpuProfiler()).to.be.false();
+      child.postMessage(100);
+      await once(child, 'message');
+      await child.stopCpuProfiler(filePath);
+      try {
+        const profile = JSON.parse(await fs.readFile(filePath, 'utf8'));
+        expect(profile.nodes).to.be.an('array').that.is.not.empty();
+        expect(profile.samples).to.be.an('array').that.is.not.empty();
+      } finally {
+        await fs.rm(filePath, { force: true });
+      }
+      await expect(child.stopCpuProfiler(filePath)).to.eventually.be.rejectedWith(/Failed to write the CPU profile/);
+      const exit = once(child, 'exit');
+      expect(child.kill()).to.be.true();
+      await exit;
+      await expect(child.startCpuProfiler()).to.eventually.be.rejectedWith(/not running/);
+    });
+
     it('does not crash when running eval', async () => {
       const child = utilityProcess.fork('./eval.js', [], {
         cwd: fixturesPath,
@@ -1557,6 +1557,101 @@ describe('webContents module', () => {
     );
   });
 
+  describe('DevTools workspace search', () => {
+    afterEach(closeAllWindows);
+
+    let nextRequestId = 100000;
+
+    async function openWorkspace() {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const devtoolsOpened = once(w.webContents, 'devtools-opened');
+      w.webContents.openDevTools({ mode: 'detach', activate: false });
+      await devtoolsOpened;
+      await waitUntil(() => w.webContents.devToolsWebContents!.executeJavaScript('typeof DevToolsAPI !== "undefined"'));
+
+      const workspace = fs.mkdtempSync(path.join(os.tmpdir(), 'devtools-workspace-'));
+      defer(() => fs.rmSync(workspace, { recursive: true, force: true }));
+      w.webContents.addWorkSpace(workspace);
+      return { w, workspace };
+    }
+
+    // Sends |method| to the embedder and resolves with the arguments of the
+    // DevToolsAPI |callback| that answers it.
+    function callEmbedder(w: BrowserWindow, method: string, callback: string, args: any[]): Promise<any[]> {
+      const requestId = nextRequestId++;
+      return w.webContents.devToolsWebContents!.executeJavaScript(`new Promise(resolve => {
+        const original = DevToolsAPI.${callback};
+        DevToolsAPI.${callback} = function (requestId, ...args) {
+          if (requestId !== ${requestId}) return original.call(this, requestId, ...args);
+          DevToolsAPI.${callback} = original;
+          resolve(args);
+        };
+        DevToolsAPI.sendMessageToEmbedder(${JSON.stringify(method)}, ${JSON.stringify([requestId, ...args])}, null);
+      })`);
+    }
+
+    const indexPath = (w: BrowserWindow, workspace: string, excludedFolders: string[] = []) =>
+      callEmbedder(w, 'indexPath', 'indexingDone', [workspace, JSON.stringify(excludedFolders)]);
+
+    const searchInPath = async (w: BrowserWindow, workspace: string, query: string): Promise<string[]> => {
+      const [, files] = await callEmbedder(w, 'searchInPath', 'searchCompleted', [workspace, query]);
+      return files;
+    };
+
+    it('finds the files that may contain the query', async () => {
+      const { w, workspace } = await openWorkspace();
+      fs.writeFileSync(path.join(workspace, 'a.js'), 'const needleInAHaystack = 1;');
+      fs.mkdirSync(path.join(workspace, 'lib'));
+      fs.writeFileSync(path.join(workspace, 'lib', 'b.js'), 'export const needleInAHaystack = 2;');
+      fs.writeFileSync(path.join(workspace, 'c.js'), 'const haystack = 3;');
+
+      await indexPath(w, workspace);
+      const files = await searchInPath(w, workspace, 'needleInAHaystack');
+      expect(files.sort()).to.deep.equal([
+        path.join(workspace, 'a.js'),
+        path.join(workspace, 'lib', 'b.js')
+      ].sort());
+    });
+
+    it('skips excluded folders', async () => {
+      const { w, workspace } = await openWorkspace();
+      fs.writeFileSync(path.join(workspace, 'a.js'), 'const needleInAHaystack = 1;');
+      fs.mkdirSync(path.join(workspace, 'node_modules'));
+      fs.writeFileSync(path.join(workspace, 'node_modules', 'b.js'), 'const needleInAHaystack = 2;');
+
+      await indexPath(w, workspace, ['/node_modules/']);
+      expect(await searchInPath(w, workspace, 'needleInAHaystack')).to.deep.equal([path.join(workspace, 'a.js')]);
+    });
+
+    it('picks up changes when indexing again', async () => {
+      const { w, workspace } = await openWorkspace();
+      fs.writeFileSync(path.join(workspace, 'a.js'), 'const needleInAHaystack = 1;');
+      fs.writeFileSync(path.join(workspace, 'b.js'), 'const haystack = 2;');
+      await indexPath(w, workspace);
+
+      fs.rmSync(path.join(workspace, 'a.js'));
+      fs.writeFileSync(path.join(workspace, 'b.js'), 'const needleInAHaystack = 2;');
+      fs.writeFileSync(path.join(workspace, 'c.js'), 'const needleInAHaystack = 3;');
+      await indexPath(w, workspace);
+      const files = await searchInPath(w, workspace, 'needleInAHaystack');
+      expect(files.sort()).to.deep.equal([path.join(workspace, 'b.js'), path.join(workspace, 'c.js')].sort());
+    });
+
+    it('keeps the index current while the folder changes', async () => {
+      const { w, workspace } = await openWorkspace();
+      fs.writeFileSync(path.join(workspace, 'a.js'), 'const haystack = 1;');
+      await indexPath(w, workspace);
+      expect(await searchInPath(w, workspace, 'needleInAHaystack')).to.be.empty();
+
+      fs.writeFileSync(path.join(workspace, 'a.js'), 'const needleInAHaystack = 1;');
+      await waitUntil(async () => {
+        const files = await searchInPath(w, workspace, 'needleInAHaystack');
+        return files.includes(path.join(workspace, 'a.js'));
+      }, { rate: 100 });
+    });
+  });
+
   describe('DevTools native integration', () => {
     afterEach(closeAllWindows);
 
@@ -1964,6 +2059,86 @@ describe('webContents module', () => {
     });
   });
 
+  describe('sendInputEvents(events)', () => {
+    afterEach(closeAllWindows);
+
+    const moves = (count: number) => {
+      const events = new Float64Array(count * 8);
+      for (let i = 0; i < count; i++) {
+        events.set([i, 2, 10 + (i % 100), 10 + (i % 50), 0, 0, 0, 0], i * 8);
+      }
+      return events;
+    };
+    const countMouseEvents = `new Promise((resolve) => {
+      let moves = 0;
+      document.addEventListener('mousemove', () => { moves++; });
+      document.addEventListener('mousedown', () => resolve(moves));
+    })`;
+
+    it('sends a sequence of event descriptors in order', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'key-events.html'));
+      const keys: string[] = [];
+      const received = new Promise<void>((resolve) => {
+        ipcMain.on('keydown', function listener (_event, key) {
+          keys.push(key);
+          if (keys.length === 3) {
+            ipcMain.removeListener('keydown', listener);
+            resolve();
+          }
+        });
+      });
+      const { dispatched } = await w.webContents.sendInputEvents([
+        { type: 'keyDown', keyCode: 'A' },
+        { type: 'keyDown', keyCode: 'B' },
+        { type: 'keyDown', keyCode: 'C' }
+      ]);
+      expect(dispatched).to.equal(3);
+      await received;
+      expect(keys).to.deep.equal(['a', 'b', 'c']);
+    });
+
+    for (const offscreen of [false, true]) {
+      it(`sends packed mouse events to a ${offscreen ? 'offscreen' : 'windowed'} page`, async () => {
+        const w = new BrowserWindow({ show: false, webPreferences: { offscreen } });
+        await w.loadURL('about:blank');
+        const counted = w.webContents.executeJavaScript(countMouseEvents);
+        const count = 10000;
+        const events = new Float64Array(count * 8 + 8);
+        events.set(moves(count));
+        events.set([count, 0, 20, 20, 0, 0, 1, 0], count * 8);
+        const { dispatched, duration } = await w.webContents.sendInputEvents(events);
+        expect(dispatched).to.equal(count + 1);
+        expect(duration).to.be.a('number').that.is.at.least(0);
+        // Consecutive moves may be coalesced by the renderer.
+        expect(await counted).to.be.greaterThan(0);
+      });
+    }
+
+    it('replays events with their original timing', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const events = new Float64Array([
+        0, 2, 10, 10, 0, 0, 0, 0,
+        200, 2, 20, 20, 0, 0, 0, 0
+      ]);
+      const { dispatched, duration } = await w.webContents.sendInputEvents(events, { timing: 'original' });
+      expect(dispatched).to.equal(2);
+      expect(duration).to.be.at.least(150);
+    });
+
+    it('throws on invalid events without sending any', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => w.webContents.sendInputEvents([{ type: 'keyDown', keyCode: 'A' }, { type: 'bogus' } as any])).to.throw(
+        /Invalid event at index 1/
+      );
+      expect(() => w.webContents.sendInputEvents(new Float64Array([0, 42, 0, 0, 0, 0, 0, 0]))).to.throw(
+        /Invalid event at index 0/
+      );
+      expect(() => w.webContents.sendInputEvents(new Float64Array(7))).to.throw(/8 values per event/);
+    });
+  });
+
   describe('insertCSS', () => {
     afterEach(closeAllWindows);
     it('supports inserting CSS', async () => {
@@ -3918,6 +4093,239 @@ describe('webContents module', () => {
     });
   });
 
+  describe('getEventEmissionStats()', () => {
+    afterEach(closeAllWindows);
+
+    const statsFor = (w: BrowserWindow, event: string) =>
+      w.webContents.getEventEmissionStats().find((s) => s.event === event)!;
+
+    it('skips console messages while nothing listens and delivers them once something does', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const before = statsFor(w, 'console-message');
+      await w.webContents.executeJavaScript('console.log("unheard")');
+      await waitUntil(() => statsFor(w, 'console-message').skipped > before.skipped);
+      expect(statsFor(w, 'console-message').delivered).to.equal(before.delivered);
+
+      const message = new Promise<string>((resolve) => {
+        w.webContents.on('console-message', (e) => {
+          if (e.message === 'heard') resolve(e.message);
+        });
+      });
+      await w.webContents.executeJavaScript('console.log("heard")');
+      await message;
+      expect(statsFor(w, 'console-message').delivered).to.be.greaterThan(before.delivered);
+    });
+
+    it('stops delivering once the last listener is removed', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const listener = () => {};
+      w.webContents.on('console-message', listener);
+      w.webContents.removeListener('console-message', listener);
+      const before = statsFor(w, 'console-message');
+      await w.webContents.executeJavaScript('console.log("unheard")');
+      await waitUntil(() => statsFor(w, 'console-message').skipped > before.skipped);
+      expect(statsFor(w, 'console-message').delivered).to.equal(before.delivered);
+    });
+
+    it('delivers to listeners added after removeAllListeners()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.removeAllListeners();
+      const message = new Promise<string>((resolve) => {
+        w.webContents.on('console-message', (e) => {
+          if (e.message === 'heard') resolve(e.message);
+        });
+      });
+      await w.webContents.executeJavaScript('console.log("heard")');
+      expect(await message).to.equal('heard');
+    });
+
+    it('reports every tracked event', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(w.webContents.getEventEmissionStats().map((s) => s.event).sort()).to.deep.equal([
+        'before-input-event',
+        'before-mouse-event',
+        'console-message',
+        'cursor-changed',
+        'input-event',
+        'update-target-url'
+      ]);
+    });
+  });
+
+  describe('page lifecycle', () => {
+    afterEach(closeAllWindows);
+    afterEach(() => webContents.setMemoryPressurePolicy(null));
+
+    const nextState = (w: BrowserWindow, state: string) => new Promise<string>((resolve) => {
+      w.webContents.on('lifecycle-state-changed', function listener (_event, newState, previousState) {
+        if (newState === state) {
+          w.webContents.removeListener('lifecycle-state-changed', listener);
+          resolve(previousState);
+        }
+      });
+    });
+
+    it('reports hidden pages and becomes active when shown', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getLifecycleState()).to.equal('hidden');
+      const shown = nextState(w, 'active');
+      w.show();
+      expect(await shown).to.equal('hidden');
+      expect(w.webContents.getLifecycleState()).to.equal('active');
+    });
+
+    it('freezes hidden pages and unfreezes them', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      expect(w.webContents.freeze()).to.be.true();
+      expect(w.webContents.getLifecycleState()).to.equal('frozen');
+      expect(w.webContents.freeze()).to.be.false();
+      expect(w.webContents.unfreeze()).to.be.true();
+      expect(w.webContents.getLifecycleState()).to.equal('hidden');
+      expect(w.webContents.unfreeze()).to.be.false();
+    });
+
+    it('freezes a hidden page after freezeDelay', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const frozen = nextState(w, 'frozen');
+      w.webContents.setLifecyclePolicy({ freezeDelay: 100 });
+      expect(await frozen).to.equal('hidden');
+    });
+
+    it('discards a hidden page and reloads it when shown', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(fixturesPath, 'pages', 'base-page.html'));
+      const url = w.webContents.getURL();
+      expect(w.webContents.discard()).to.be.true();
+      expect(w.webContents.getLifecycleState()).to.equal('discarded');
+      expect(await w.webContents.getMemoryEstimate()).to.have.property('estimate', 0);
+      expect(w.webContents.navigationHistory.length()).to.be.greaterThan(0);
+
+      const loaded = once(w.webContents, 'did-finish-load');
+      w.show();
+      await loaded;
+      expect(w.webContents.getLifecycleState()).to.equal('active');
+      expect(w.webContents.getURL()).to.equal(url);
+    });
+
+    it('does not discard visible pages', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const shown = nextState(w, 'active');
+      w.show();
+      await shown;
+      expect(w.webContents.discard()).to.be.false();
+      expect(w.webContents.freeze()).to.be.false();
+    });
+
+    it('estimates the memory used by a page', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const estimate = await w.webContents.getMemoryEstimate();
+      expect(estimate.privateFootprint).to.be.greaterThan(0);
+      expect(estimate.estimate).to.be.at.most(estimate.privateFootprint);
+      expect(estimate.sharedWith).to.be.a('number');
+    });
+
+    it('discards discardable pages under memory pressure', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setLifecyclePolicy({ discardable: true });
+      const discarded = nextState(w, 'discarded');
+      // A threshold no machine can satisfy makes every check count as pressure.
+      webContents.setMemoryPressurePolicy({ availableMemoryThreshold: Number.MAX_SAFE_INTEGER, checkInterval: 100 });
+      await discarded;
+    });
+
+    it('validates the memory pressure policy', () => {
+      expect(() => webContents.setMemoryPressurePolicy({ availableMemoryThreshold: 0 })).to.throw(/must be a positive number/);
+    });
+  });
+
+  describe('setConsoleMessageLogging(options)', () => {
+    afterEach(closeAllWindows);
+
+    const logMessages = (w: BrowserWindow, messages: string[]) =>
+      w.webContents.executeJavaScript(`
+        ${JSON.stringify(messages)}.forEach((m) => console.log(m));
+        console.error('done');
+      `);
+
+    it('keeps the most recent messages in memory', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setConsoleMessageLogging({ maxEntries: 3 });
+      await logMessages(w, ['a', 'b', 'c', 'd']);
+      await waitUntil(() => w.webContents.getConsoleMessages().some((m) => m.message === 'done'));
+      const messages = w.webContents.getConsoleMessages();
+      expect(messages.map((m) => m.message)).to.deep.equal(['c', 'd', 'done']);
+      expect(messages[2].level).to.equal('error');
+      expect(messages[2].timestamp).to.be.a('number');
+    });
+
+    it('filters messages below the given level', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setConsoleMessageLogging({ level: 'warning' });
+      await logMessages(w, ['ignored']);
+      await waitUntil(() => w.webContents.getConsoleMessages().length > 0);
+      expect(w.webContents.getConsoleMessages().map((m) => m.message)).to.deep.equal(['done']);
+    });
+
+    it('does not emit console-message unless emitEvents is set', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      const seen: string[] = [];
+      w.webContents.on('console-message', (e) => seen.push(e.message));
+      w.webContents.setConsoleMessageLogging({});
+      await logMessages(w, ['quiet']);
+      await waitUntil(() => w.webContents.getConsoleMessages().length === 2);
+      expect(seen).to.be.empty();
+
+      w.webContents.setConsoleMessageLogging({ emitEvents: true });
+      await logMessages(w, ['loud']);
+      await waitUntil(() => seen.includes('done'));
+      expect(seen).to.deep.equal(['loud', 'done']);
+    });
+
+    it('writes messages to a file and rotates it', async () => {
+      const dir = await fs.promises.mkdtemp(path.join(os.tmpdir(), 'electron-console-log-'));
+      defer(() => fs.promises.rm(dir, { recursive: true, force: true }));
+      const logPath = path.join(dir, 'console.log');
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setConsoleMessageLogging({ path: logPath, maxFileSize: 1024 });
+      await logMessages(w, Array.from({ length: 50 }, (_, i) => `line ${i} ${'x'.repeat(40)}`));
+      await waitUntil(() => w.webContents.getConsoleMessages().some((m) => m.message === 'done'));
+      await w.webContents.flushConsoleMessageLog();
+      const current = await fs.promises.readFile(logPath, 'utf8');
+      const backup = await fs.promises.readFile(`${logPath}.1`, 'utf8');
+      expect(current).to.match(/\[error\] done/);
+      expect(backup).to.match(/\[info\] line \d+ x+/);
+      expect(Buffer.byteLength(backup)).to.be.at.most(1024);
+    });
+
+    it('stops recording when passed null', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+      w.webContents.setConsoleMessageLogging({});
+      w.webContents.setConsoleMessageLogging(null);
+      expect(w.webContents.getConsoleMessages()).to.deep.equal([]);
+      await w.webContents.flushConsoleMessageLog();
+    });
+
+    it('validates its options', () => {
+      const w = new BrowserWindow({ show: false });
+      expect(() => w.webContents.setConsoleMessageLogging({ path: 'relative.log' })).to.throw(/must be absolute/);
+      expect(() => w.webContents.setConsoleMessageLogging({ level: 'loud' as any })).to.throw(/'level' must be one of/);
+    });
+  });
+
   describe('ipc-message event', () => {
     afterEach(closeAllWindows);
     it('emits when the renderer process sends an asynchronous message', async () => {
@@ -4160,6 +4568,104 @@ describe('webContents module', () => {
         'Failed to take heap snapshot with nonexistent render frame'
       );
     });
+
+    it('streams a complete snapshot and reports progress', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      const filePath = path.join(app.getPath('temp'), 'test-progress.heapsnapshot');
+      defer(() => {
+        try {
+          fs.unlinkSync(filePath);
+        } catch {
+          // ignore error
+        }
+      });
+
+      const stages = new Set<string>();
+      w.webContents.on('heap-snapshot-progress', (event, details) => {
+        stages.add(details.stage);
+        expect(details.done).to.be.a('number');
+        if (details.stage === 'build') {
+          expect(details.total).to.be.a('number');
+        }
+      });
+      await w.webContents.takeHeapSnapshot(filePath);
+
+      const snapshot = JSON.parse(fs.readFileSync(filePath, 'utf8'));
+      expect(snapshot).to.have.property('snapshot');
+      expect(snapshot.nodes).to.be.an('array').that.is.not.empty();
+      expect(stages.has('build')).to.be.true();
+    });
+  });
+
+  describe('startSamplingHeapProfiler() / stopSamplingHeapProfiler()', () => {
+    afterEach(closeAllWindows);
+
+    it('returns the sampled allocations of the renderer', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { sandbox: true } });
+      await w.loadURL('about:blank');
+
+      await w.webContents.startSamplingHeapProfiler({ samplingInterval: 1024 });
+      await w.webContents.executeJavaScript(
+        'window.retained = Array.from({ length: 10000 }, (_, i) => ({ i })); true'
+      );
+      const profile = await w.webContents.stopSamplingHeapProfiler();
+      expect(profile.head.callFrame).to.have.property('functionName');
+      expect(profile.head.children).to.be.an('array');
+      expect(profile.samples).to.be.an('array').that.is.not.empty();
+    });
+
+    it('does not drop messages sent to the frame meanwhile', async () => {
+      const w = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript(`
+        window.received = [];
+        require('electron').ipcRenderer.on('ping', (event, i) => window.received.push(i));
+      `);
+
+      const count = 20;
+      for (let i = 0; i < count; i++) {
+        w.webContents.mainFrame.send('ping', i);
+        if (i % 2) {
+          await w.webContents.startSamplingHeapProfiler();
+        } else if (i > 0) {
+          await w.webContents.stopSamplingHeapProfiler();
+        }
+      }
+      await w.webContents.stopSamplingHeapProfiler().catch(() => {});
+      await waitUntil(async () => (await w.webContents.executeJavaScript('window.received.length')) === count);
+      expect(await w.webContents.executeJavaScript('window.received')).to.deep.equal([...Array(count).keys()]);
+    });
+
+    it('rejects when started twice', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      await w.webContents.startSamplingHeapProfiler();
+      defer(() => w.webContents.stopSamplingHeapProfiler().catch(() => {}));
+      await expect(w.webContents.startSamplingHeapProfiler()).to.eventually.be.rejectedWith(
+        'The sampling heap profiler is already running'
+      );
+    });
+
+    it('rejects when stopped without being started', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      await expect(w.webContents.stopSamplingHeapProfiler()).to.eventually.be.rejectedWith(
+        'The sampling heap profiler is not running'
+      );
+    });
+
+    it('rejects invalid options', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadURL('about:blank');
+
+      await expect(w.webContents.startSamplingHeapProfiler({ stackDepth: 0 })).to.eventually.be.rejectedWith(
+        "'stackDepth' must be between 1 and 1024"
+      );
+    });
   });
 
   describe('setBackgroundThrottling()', () => {
@@ -4543,6 +5049,91 @@ describe('webContents module', () => {
     });
   });
 
+  ifdescribe(features.isPrintingEnabled())('webContents.createPrintToPDFQueue()', () => {
+    const page = (text: string) => `data:text/html,<h1>${text}</h1>`;
+
+    it('throws for an invalid concurrency', () => {
+      expect(() => webContents.createPrintToPDFQueue({ concurrency: 0 })).to.throw(/concurrency must be a positive integer/);
+      expect(() => webContents.createPrintToPDFQueue({ concurrency: 1.5 })).to.throw(/concurrency must be a positive integer/);
+    });
+
+    it('renders documents concurrently up to the limit', async () => {
+      const queue = webContents.createPrintToPDFQueue({ concurrency: 2 });
+      const jobs = ['one', 'two', 'three'].map((text) => queue.add(page(text)));
+      expect(queue.running).to.equal(2);
+      expect(queue.pending).to.equal(1);
+      const results = await Promise.all(jobs);
+      expect(queue.running).to.equal(0);
+      expect(queue.pending).to.equal(0);
+      for (const [i, text] of ['one', 'two', 'three'].entries()) {
+        const pdfInfo = await readPDF(results[i] as Buffer);
+        expect(containsText(pdfInfo.textContent, new RegExp(text))).to.be.true();
+      }
+    });
+
+    it('does not leave WebContents behind', async () => {
+      const before = webContents.getAllWebContents().length;
+      const queue = webContents.createPrintToPDFQueue();
+      await Promise.all([queue.add(page('a')), queue.add(page('b'))]);
+      expect(webContents.getAllWebContents()).to.have.lengthOf(before);
+    });
+
+    describe('with output', () => {
+      let tmpDir: string;
+      beforeEach(async () => {
+        tmpDir = await fs.promises.mkdtemp(path.join(os.tmpdir(), 'electron-pdf-spec-'));
+      });
+      afterEach(async () => {
+        await fs.promises.rm(tmpDir, { recursive: true, force: true });
+      });
+
+      it('writes to a path and resolves with the byte count', async () => {
+        const queue = webContents.createPrintToPDFQueue();
+        const outputPath = path.join(tmpDir, 'out.pdf');
+        const size = await queue.add(page('path'), { output: outputPath });
+        expect(size).to.equal(fs.statSync(outputPath).size);
+        const pdfInfo = await readPDF(fs.readFileSync(outputPath));
+        expect(containsText(pdfInfo.textContent, /path/)).to.be.true();
+      });
+
+      it('writes to a file descriptor and leaves it open', async () => {
+        const queue = webContents.createPrintToPDFQueue();
+        const outputPath = path.join(tmpDir, 'out.pdf');
+        const fd = fs.openSync(outputPath, 'w');
+        try {
+          const size = await queue.add(page('fd'), { output: fd });
+          expect(() => fs.fstatSync(fd)).to.not.throw();
+          expect(size).to.equal(fs.fstatSync(fd).size);
+        } finally {
+          fs.closeSync(fd);
+        }
+        const pdfInfo = await readPDF(fs.readFileSync(outputPath));
+        expect(containsText(pdfInfo.textContent, /fd/)).to.be.true();
+      });
+
+      it('writes to a stream', async () => {
+        const queue = webContents.createPrintToPDFQueue();
+        const outputPath = path.join(tmpDir, 'out.pdf');
+        const stream = fs.createWriteStream(outputPath);
+        const size = await queue.add(page('stream'), { output: stream });
+        expect(stream.writableFinished).to.be.true();
+        expect(size).to.equal(fs.statSync(outputPath).size);
+      });
+
+      it('rejects an invalid output', async () => {
+        const queue = webContents.createPrintToPDFQueue();
+        await expect(queue.add(page('x'), { output: {} as any })).to.eventually.be.rejectedWith(/output must be/);
+      });
+
+      it('rejects and cleans up when the path cannot be written', async () => {
+        const queue = webContents.createPrintToPDFQueue();
+        const outputPath = path.join(tmpDir, 'missing', 'out.pdf');
+        await expect(queue.add(page('x'), { output: outputPath })).to.eventually.be.rejectedWith(/Failed to write PDF/);
+        expect(queue.running).to.equal(0);
+      });
+    });
+  });
+
   describe('PictureInPicture video', () => {
     afterEach(closeAllWindows);
     it('works as expected', async function () {
@@ -286,6 +286,68 @@ describe('webFrameMain module', () => {
     });
   });
 
+  describe('WebFrame.executeJavaScriptBatch', () => {
+    it('runs scripts in order and resolves with their results', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const { results, roundTripTime } = await w.webContents.mainFrame.executeJavaScriptBatch([
+        'window.counter = 1',
+        'window.counter += 1',
+        'new Promise(resolve => setTimeout(() => resolve(window.counter * 10), 100))',
+        '({ a: [1, "b"] })'
+      ]);
+      expect(results).to.deep.equal([
+        { status: 'fulfilled', value: 1 },
+        { status: 'fulfilled', value: 2 },
+        { status: 'fulfilled', value: 20 },
+        { status: 'fulfilled', value: { a: [1, 'b'] } }
+      ]);
+      expect(roundTripTime).to.be.a('number').that.is.at.least(0);
+    });
+
+    it('rejects failing scripts without affecting the others', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const { results } = await w.webContents.mainFrame.executeJavaScriptBatch([
+        'console.log(test)',
+        'Promise.reject(new Error("nope"))',
+        '42'
+      ]);
+      expect(results.map(({ status }) => status)).to.deep.equal(['rejected', 'rejected', 'fulfilled']);
+      expect(results[0].reason).to.be.an.instanceOf(Error);
+      expect(results[2].value).to.equal(42);
+    });
+
+    it('resolves with no results for an empty batch', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      const { results } = await w.webContents.mainFrame.executeJavaScriptBatch([]);
+      expect(results).to.deep.equal([]);
+    });
+
+    it('throws for invalid scripts', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame.html'));
+      expect(() => w.webContents.mainFrame.executeJavaScriptBatch('1 + 1' as any)).to.throw();
+    });
+
+    it('runs in every frame with webContents.executeJavaScriptInAllFrames()', async () => {
+      const w = new BrowserWindow({ show: false });
+      await w.loadFile(path.join(subframesPath, 'frame-with-frame-container.html'));
+      const frameResults = await w.webContents.executeJavaScriptInAllFrames(['location.href', '1 + 1']);
+      expect(frameResults.map(({ frame }) => frame)).to.deep.equal(w.webContents.mainFrame.framesInSubtree);
+      expect(frameResults.map(({ results }) => results[0].value)).to.deep.equal([
+        fileUrl('frame-with-frame-container.html'),
+        fileUrl('frame-with-frame.html'),
+        fileUrl('frame.html')
+      ]);
+      for (const { results, roundTripTime } of frameResults) {
+        expect(results[1]).to.deep.equal({ status: 'fulfilled', value: 2 });
+        expect(roundTripTime).to.be.a('number');
+      }
+    });
+  });
+
   describe('WebFrame.reload', () => {
     it('reloads a frame', async () => {
       const w = new BrowserWindow({ show: false });
@@ -0,0 +1,3 @@
+const { getCompileCacheDir } = require('node:module');
+
+process.parentPort.postMessage(getCompileCacheDir() ?? null);
@@ -0,0 +1,7 @@
+process.parentPort.once('message', async ({ data: filePath }) => {
+  process.startCpuProfiler({ samplingInterval: 100 });
+  const end = Date.now() + 100;
+  while (Date.now() < end);
+  await process.stopCpuProfiler(filePath);
+  process.parentPort.postMessage('written');
+});
@@ -0,0 +1 @@
+throw new Error('failed to load');
@@ -0,0 +1,26 @@
+const { setTimeout } = require('node:timers/promises');
+
+let messageCount = 0;
+process.parentPort.on('message', () => {
+  messageCount++;
+});
+
+process.parentPort.setTaskHandler(async ({ op, value, delay }, ports) => {
+  if (delay) await setTimeout(delay);
+  switch (op) {
+    case 'double':
+      return value * 2;
+    case 'pid':
+      return process.pid;
+    case 'throw':
+      throw new Error(value);
+    case 'crash':
+      process.crash();
+      break;
+    case 'message-count':
+      return messageCount;
+    case 'port':
+      ports[0].postMessage(value);
+      return 'sent';
+  }
+});
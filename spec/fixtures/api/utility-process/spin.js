@@ -0,0 +1,5 @@
+process.parentPort.on('message', ({ data: duration }) => {
+  const end = Date.now() + duration;
+  while (Date.now() < end);
+  process.parentPort.postMessage('done');
+});
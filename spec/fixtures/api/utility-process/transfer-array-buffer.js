@@ -0,0 +1,17 @@
+process.parentPort.on('message', ({ data }) => {
+  if (data === 'transfer-non-array-buffer') {
+    try {
+      process.parentPort.postMessage(null, [new Uint8Array(1)]);
+    } catch (error) {
+      process.parentPort.postMessage(error.message);
+    }
+    return;
+  }
+  if (!data) return;
+  const { buffer } = data;
+  // Flip the bytes so the parent can tell the buffer made the round trip.
+  const bytes = new Uint8Array(buffer);
+  for (let i = 0; i < bytes.length; i++) bytes[i] = ~bytes[i];
+  process.parentPort.postMessage({ buffer }, [buffer]);
+  process.parentPort.postMessage({ byteLength: buffer.byteLength });
+});
@@ -138,8 +138,10 @@ declare namespace NodeJS {
     send(isText: boolean, data: Uint8Array): void;
     close(code?: number, reason?: string): void;
     getBufferedAmount(): number;
+    setBufferedAmountLowThreshold(threshold: number): void;
     on(eventName: 'open', listener: (event: any, protocol: string, extensions: string) => void): this;
-    on(eventName: 'message', listener: (event: any, isText: boolean, data: Buffer) => void): this;
+    on(eventName: 'messages', listener: (event: any, data: Buffer, entries: Uint32Array) => void): this;
+    on(eventName: 'bufferedamountlow', listener: (event: any) => void): this;
     on(eventName: 'closing', listener: (event: any) => void): this;
     on(eventName: 'close', listener: (event: any, wasClean: boolean, code: number, reason: string) => void): this;
     on(eventName: 'error', listener: (event: any) => void): this;
@@ -265,8 +267,11 @@ declare namespace NodeJS {
       eventName: 'response-started',
       listener: (event: any, finalUrl: string, responseHead: ResponseHead) => void
     ): this;
-    on(eventName: 'complete', listener: (event: any) => void): this;
-    on(eventName: 'error', listener: (event: any, netErrorString: string) => void): this;
+    on(eventName: 'complete', listener: (event: any, timing: Electron.RequestTiming) => void): this;
+    on(
+      eventName: 'error',
+      listener: (event: any, netErrorString: string, timing?: Electron.RequestTiming) => void
+    ): this;
     on(
       eventName: 'login',
       listener: (
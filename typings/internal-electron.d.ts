@@ -97,6 +97,8 @@ declare namespace Electron {
 
   interface WebContents {
     _awaitNextLoad(expectedUrl: string): Promise<void>;
+    _setEventListened(name: string, listened: boolean): void;
+    _isWarmPooled(): boolean;
     _loadURL(url: string, options: ElectronInternal.LoadURLOptions): void;
     getOwnerBrowserWindow(): Electron.BrowserWindow | null;
     getLastWebPreferences(): Electron.WebPreferences | null;
@@ -118,7 +120,7 @@ declare namespace Electron {
     ): void;
     _send(internal: boolean, channel: string, args: any): boolean;
     _sendInternal(channel: string, ...args: any[]): void;
-    _printToPDF(options: any): Promise<Buffer>;
+    _printToPDF(options: any): Promise<Buffer | number>;
     _print(options: any, callback?: (success: boolean, failureReason: string) => void): void;
     _init(): void;
     _getNavigationEntryAtIndex(index: number): Electron.NavigationEntry | null;
@@ -148,7 +150,7 @@ declare namespace Electron {
     _send(internal: boolean, channel: string, args: any): void;
     _sendInternal(channel: string, ...args: any[]): void;
     _postMessage(channel: string, message: any, transfer?: any[]): void;
-    _printToPDF(options: any): Promise<Buffer>;
+    _printToPDF(options: any): Promise<Buffer | number>;
     _lifecycleStateForTesting: string;
   }
 
@@ -364,10 +366,13 @@ declare namespace ElectronInternal {
       captureWindow: boolean,
       captureScreen: boolean,
       thumbnailSize: Electron.Size,
-      fetchWindowIcons: boolean
+      fetchWindowIcons: boolean,
+      streamSources: boolean,
+      thumbnailCacheMaxAge: number
     ): void;
     _onerror?: (error: string) => void;
     _onfinished?: (sources: Electron.DesktopCapturerSource[], fetchWindowIcons: boolean) => void;
+    _onsource?: (source: Electron.DesktopCapturerSource) => void;
   }
 
   interface GetSourcesOptions {
@@ -375,6 +380,7 @@ declare namespace ElectronInternal {
     captureScreen: boolean;
     thumbnailSize: Electron.Size;
     fetchWindowIcons: boolean;
+    thumbnailCacheMaxAge: number;
   }
 
   interface GetSourcesResult {
@@ -435,6 +441,9 @@ declare namespace ElectronInternal {
     readonly pid: number | undefined;
     kill(): boolean;
     postMessage(message: any, transfer?: any[]): void;
+    getLaunchTiming(): Electron.UtilityProcessLaunchTiming;
+    startCpuProfiler(options?: Electron.CpuProfilerOptions): Promise<boolean>;
+    stopCpuProfiler(filePath: string): Promise<void>;
   }
 
   interface ParentPort extends NodeJS.EventEmitter {